@@ -8,7 +8,25 @@
 #ifndef GLAUBERMODEL_H_
 #define GLAUBERMODEL_H_
 
+#include <gsl/gsl_spline.h>
+
+/*
+ * Nuclear thickness function T_A of a Woods-Saxon nucleus with A nucleons, tabulated once against the
+ * transverse distance r from its centre and interpolated with a cubic spline; zero for r >= rmax.
+ */
+struct NuclearThicknessTable
+{
+	double A;
+	double rmax;
+	gsl_spline *spline;
+};
+
 double woodsSaxonDistribution(double r, double A);
+// T_A(x,y) by direct quadrature of the Woods-Saxon distribution
+double nuclearThicknessFunction(double x, double y, double A);
+void tabulateNuclearThicknessFunction(struct NuclearThicknessTable *table, double A);
+void freeNuclearThicknessTable(struct NuclearThicknessTable *table);
+double interpolateNuclearThicknessFunction(const struct NuclearThicknessTable *table, double x, double y);
 void energyDensityTransverseProfileAA(double * const __restrict__ energyDensityTransverse, 
 int nx, int ny, double dx, double dy, void * initCondParams);
 
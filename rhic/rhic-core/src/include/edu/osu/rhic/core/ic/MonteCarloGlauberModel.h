@@ -8,8 +8,39 @@
 #ifndef MONTECARLOGLAUBERMODEL_H_
 #define MONTECARLOGLAUBERMODEL_H_
 
-void 
-monteCarloGlauberEnergyDensityTransverseProfile(double * const __restrict__ energyDensityTransverse, 
+#include "edu/osu/rhic/core/util/RandomStream.h"
+
+// Transverse positions of the A nucleons of a Woods-Saxon nucleus drawn from rs
+void sampleWoodsSaxon(int A, double * const __restrict__ x, double * const __restrict__ y, struct RandomStream *rs);
+
+/*
+ * Nucleons of either nucleus within the interaction distance sqrt(snn/pi) of a nucleon of the other, found by
+ * hashing the nucleons of the second nucleus into a transverse grid of that spacing; their positions are
+ * written to x and y (up to 2A) and their number returned.
+ */
+int findWoundedNucleons(int A, const double * const x1, const double * const y1, const double * const x2, const double * const y2,
+		double snn, double * const __restrict__ x, double * const __restrict__ y);
+
+// Wounded nucleons of a collision at impact parameter b, a function of the seed and event index only
+int sampleWoundedNucleons(int A, double b, double snn, int seed, int event, double * const __restrict__ x, double * const __restrict__ y);
+
+/*
+ * Samples the wounded nucleons of the Monte Carlo Glauber events of the array initCondParams in parallel, each the
+ * same as sampleWoundedNucleons alone, and attaches their positions to the events, so that setting their initial
+ * conditions only deposits them. Returns the buffer of the positions, to be freed once the events are set.
+ */
+double * sampleEventsWoundedNucleons(int numEvents, void * initCondParams);
+
+/*
+ * Sets the transverse profile to the sum of Gaussians of width sigma centred on the nucleons, each added only to
+ * the cells within cutoffRadius of its centre, or to every cell if cutoffRadius <= 0. The nucleons are summed in an
+ * order fixed by their index, so that the profile does not depend on the number of threads.
+ */
+void depositWoundedNucleons(double * const __restrict__ energyDensityTransverse, int nx, int ny, double dx, double dy,
+		int nNucleons, const double * const xp, const double * const yp, double sigma, double cutoffRadius);
+
+void
+monteCarloGlauberEnergyDensityTransverseProfile(double * const __restrict__ energyDensityTransverse,
 int nx, int ny, double dx, double dy, void * initCondParams
 );
 
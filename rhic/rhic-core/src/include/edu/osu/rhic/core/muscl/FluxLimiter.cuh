@@ -10,7 +10,7 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION approximateDerivative(PRECISION x, PRECISION y, PRECISION z);
 
 #endif /* FLUXLIMITER_CUH_ */
@@ -10,13 +10,13 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION rightHalfCellExtrapolationForward(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp);
-__device__ 
+__host__ __device__ 
 PRECISION rightHalfCellExtrapolationBackwards(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp);
-__device__ 
+__host__ __device__ 
 PRECISION leftHalfCellExtrapolationForward(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp);
-__device__ 
+__host__ __device__ 
 PRECISION leftHalfCellExtrapolationBackwards(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp);
 
 #endif /* HALFSITEEXTRAPOLATION_CUH_ */
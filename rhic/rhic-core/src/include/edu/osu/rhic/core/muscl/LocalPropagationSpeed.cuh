@@ -10,7 +10,7 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION localPropagationSpeed(PRECISION utr, PRECISION uxr, PRECISION uyr, PRECISION unr,
 		PRECISION utl, PRECISION uxl, PRECISION uyl, PRECISION unl,
 		PRECISION (*spectralRadius)(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un)
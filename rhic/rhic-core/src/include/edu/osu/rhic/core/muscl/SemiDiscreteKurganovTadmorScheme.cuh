@@ -10,7 +10,8 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void flux(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result,
 		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
 		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
@@ -19,7 +20,8 @@ void flux(const PRECISION * const __restrict__ data, PRECISION * const __restric
 		PRECISION t, PRECISION ePrev
 );
 
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void flux2(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result,
 		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
 		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
@@ -0,0 +1,41 @@
+/*
+ * RandomStream.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef RANDOMSTREAM_H_
+#define RANDOMSTREAM_H_
+
+#include <stdint.h>
+
+/*
+ * Counter-based random numbers: the n-th number of a stream is a hash of its key and n (the SplitMix64
+ * finalizer), so a stream has no state to share between threads and any (seed, event, stream) triple
+ * reproduces the same numbers wherever and in whatever order it is drawn.
+ */
+struct RandomStream
+{
+	uint64_t key;
+	uint64_t counter;
+};
+
+inline uint64_t mixRandomBits(uint64_t z) {
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+inline void initializeRandomStream(struct RandomStream *rs, uint64_t seed, uint64_t event, uint64_t stream) {
+	const uint64_t gamma = 0x9e3779b97f4a7c15ULL;
+	rs->key = mixRandomBits(mixRandomBits(mixRandomBits(seed + gamma) + event * gamma) + stream * gamma);
+	rs->counter = 0;
+}
+
+// Uniform in [0,1) with 53 random bits
+inline double uniformRandom(struct RandomStream *rs) {
+	uint64_t bits = mixRandomBits(rs->key + 0x9e3779b97f4a7c15ULL * ++rs->counter);
+	return (bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+#endif /* RANDOMSTREAM_H_ */
@@ -5,10 +5,20 @@
  *      Author: bazow
  */
 
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
 #include "edu/osu/rhic/core/ic/GlauberModel.h"
 #include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
 
 #include <gsl/gsl_integration.h>
+#include <gsl/gsl_spline.h>
+
+// T_A(r) is tabulated at NUCLEAR_THICKNESS_TABLE_SIZE radii 0 <= r <= NUCLEAR_THICKNESS_TABLE_RMAX [fm]
+#define NUCLEAR_THICKNESS_TABLE_SIZE 401
+#define NUCLEAR_THICKNESS_TABLE_RMAX 20.
 
 struct nuclearThicknessFunctionParams {
 	double x;
@@ -49,6 +59,36 @@ double nuclearThicknessFunction(double x, double y, double A) {
 	return 2*result;
 }
 
+void tabulateNuclearThicknessFunction(struct NuclearThicknessTable *table, double A) {
+	int n = NUCLEAR_THICKNESS_TABLE_SIZE;
+	double dr = NUCLEAR_THICKNESS_TABLE_RMAX / (n - 1);
+	double *r = (double *) malloc(n * sizeof(double));
+	double *TA = (double *) malloc(n * sizeof(double));
+	// each quadrature has its own workspace
+	#pragma omp parallel for
+	for (int m = 0; m < n; ++m) {
+		r[m] = m * dr;
+		TA[m] = nuclearThicknessFunction(r[m], 0, A);
+	}
+	table->A = A;
+	table->rmax = NUCLEAR_THICKNESS_TABLE_RMAX;
+	table->spline = gsl_spline_alloc(gsl_interp_cspline, n);
+	gsl_spline_init(table->spline, r, TA, n);
+	free(r);
+	free(TA);
+}
+
+void freeNuclearThicknessTable(struct NuclearThicknessTable *table) {
+	gsl_spline_free(table->spline);
+}
+
+double interpolateNuclearThicknessFunction(const struct NuclearThicknessTable *table, double x, double y) {
+	double r = sqrt(x * x + y * y);
+	if (r >= table->rmax) return 0;
+	// without an accelerator the spline may be evaluated from several threads
+	return gsl_spline_eval(table->spline, r, NULL);
+}
+
 double binaryCollisionPairs(double x, double y, double TAplus, double TBminus, double snn) {
 	return snn * TAplus * TBminus;
 }
@@ -76,10 +116,15 @@ int nx, int ny, double dx, double dy, void * initCondParams) {
 	double b = initCond->impactParameter;
 	double snn = initCond->scatteringCrossSectionNN;
 	double alpha = initCond->fractionOfBinaryCollisions;
+
+	double start = monotonicTime();
+	// T_A depends only on the distance from the centre of the nucleus
+	struct NuclearThicknessTable TA;
+	tabulateNuclearThicknessFunction(&TA, A);
 ///*
 	// Normalization factors
-	double TAminusNorm = nuclearThicknessFunction(0,0,A);
-	double TAplusNorm = nuclearThicknessFunction(0,0,A);
+	double TAminusNorm = interpolateNuclearThicknessFunction(&TA,0,0);
+	double TAplusNorm = TAminusNorm;
 	double TBminusNorm = TAminusNorm;
 	double TBplusNorm = TAplusNorm;
 	double nbcNorm = 1./binaryCollisionPairs(0,0,TAplusNorm,TBminusNorm,snn);
@@ -89,12 +134,13 @@ int nx, int ny, double dx, double dy, void * initCondParams) {
 	double nbcNorm = 1.;
 	double wnNorm = 1.;
 //*/
+	#pragma omp parallel for collapse(2)
 	for(int i = 0; i < nx; ++i) {
-		double x = (i - (nx-1)/2.)*dx;
 		for(int j = 0; j < ny; ++j) {
+			double x = (i - (nx-1)/2.)*dx;
 			double y = (j - (ny-1)/2.)*dy;
-			double TAminus = nuclearThicknessFunction(x-b/2,y,A);
-			double TAplus = nuclearThicknessFunction(x+b/2,y,A);
+			double TAminus = interpolateNuclearThicknessFunction(&TA,x-b/2,y);
+			double TAplus = interpolateNuclearThicknessFunction(&TA,x+b/2,y);
 			double TBminus = TAminus;
 			double TBplus = TAplus;
 			// Binary collision energy density profile
@@ -105,4 +151,7 @@ int nx, int ny, double dx, double dy, void * initCondParams) {
 			energyDensityTransverse[i+j*nx] = ed;
 		}
 	}
+	freeNuclearThicknessTable(&TA);
+
+	printf("Optical Glauber profile of %d x %d cells in %.3f ms.\n", nx, ny, monotonicTime() - start);
 }
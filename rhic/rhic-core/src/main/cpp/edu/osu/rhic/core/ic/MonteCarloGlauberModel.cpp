@@ -5,26 +5,36 @@
  *      Author: bazow
  */
 
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
 #include "edu/osu/rhic/core/ic/GlauberModel.h"
 #include "edu/osu/rhic/core/ic/MonteCarloGlauberModel.h"
 #include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
 
 #include <gsl/gsl_integration.h>
 
+// Partial profiles of depositWoundedNucleons, which bound the threads it uses
+#define DEPOSITION_PARTIAL_SUMS 16
+
 // generates A samples corresponding to Woods-Saxon nucleus with A nucleons
 // results are loaded into x and y arrays (z is not used in current context)
-// note: assumes that the the random number generator has already been seeded
-void sampleWoodsSaxon(int A, double * const __restrict__ x, double * const __restrict__ y) {
+void sampleWoodsSaxon(int A, double * const __restrict__ x, double * const __restrict__ y, struct RandomStream *rs) {
 	const double M = 1.01*4.5310551374155095;
 	const double rmax = 20;
+	// woodsSaxonDistribution(r,A) without recomputing the radius for every draw
+	const double n0 = 0.17;
+	const double Rn = 1.12*pow(A,1./3.) - 0.86*pow(A,-1./3.);
+	const double d = 0.54;
 	int m = 0;
 	double r,v,f,u;
 	while (m<A) {
-		r = rmax*((double) rand())/((double)RAND_MAX);
-		u = ((double) rand())/((double)RAND_MAX);
-		if (u < r*r*woodsSaxonDistribution(r,A)/M) {
-			v = 2*(((double) rand())/((double)RAND_MAX)-0.5);
-			f = 2*M_PI*((double) rand())/((double)RAND_MAX);
+		r = rmax*uniformRandom(rs);
+		u = uniformRandom(rs);
+		if (u < r*r*(n0/(1+exp((r-Rn)/d)))/M) {
+			v = 2*(uniformRandom(rs)-0.5);
+			f = 2*M_PI*uniformRandom(rs);
 			x[m] = r*sqrt(1-v*v)*cos(f);
 			y[m] = r*sqrt(1-v*v)*sin(f);
 			m++;
@@ -32,31 +42,59 @@ void sampleWoodsSaxon(int A, double * const __restrict__ x, double * const __res
 	}
 }
 
-int numberWoundedNucleons(int A, double b, double * const __restrict__ x, double * const __restrict__ y, double snn) {
-	double x1[A], y1[A], x2[A], y2[A];
-	int l1[A], l2[A];
-	sampleWoodsSaxon(A,x1,y1);
-	sampleWoodsSaxon(A,x2,y2);
-	for (int i=0; i<A; i++) {
-		x1[i] -= b/2;
-		x2[i] += b/2;
-	}
+int findWoundedNucleons(int A, const double * const x1, const double * const y1, const double * const x2, const double * const y2,
+		double snn, double * const __restrict__ x, double * const __restrict__ y) {
 	double dn = sqrt(0.1*snn/M_PI);
+	double dn2 = dn*dn;
+
+	// cells of width dn over the second nucleus, so that only the 3 x 3 cells around a nucleon can hold its partners
+	double xmin = x2[0], xmax = x2[0], ymin = y2[0], ymax = y2[0];
+	for(int j = 1; j < A; ++j) {
+		xmin = fmin(xmin, x2[j]);
+		xmax = fmax(xmax, x2[j]);
+		ymin = fmin(ymin, y2[j]);
+		ymax = fmax(ymax, y2[j]);
+	}
+	int ncx = (int) ((xmax-xmin)/dn) + 1;
+	int ncy = (int) ((ymax-ymin)/dn) + 1;
+	int *cellStart = (int *) calloc(ncx*ncy+1, sizeof(int));
+	int cell[A], order[A];
+	for(int j = 0; j < A; ++j) {
+		cell[j] = (int) ((x2[j]-xmin)/dn) + ncx * (int) ((y2[j]-ymin)/dn);
+		cellStart[cell[j]+1]++;
+	}
+	for(int c = 0; c < ncx*ncy; ++c) cellStart[c+1] += cellStart[c];
+	int fill[ncx*ncy];
+	for(int c = 0; c < ncx*ncy; ++c) fill[c] = cellStart[c];
+	for(int j = 0; j < A; ++j) order[fill[cell[j]]++] = j;
+
+	int l1[A], l2[A];
 	for(int i = 0; i < A; ++i) {
 		l1[i] = 0;
 		l2[i] = 0;
 	}
 	for(int i = 0; i < A; ++i) {
-		for (int j = 0; j < A; ++j) {
-			double dist = pow(x1[i]-x2[j],2);
-			dist += pow(y1[i]-y2[j],2);
-			dist = sqrt(dist);
-			if (dist < dn) {
-				l1[i] += 1;
-				l2[j] += 1;
+		int cx = (int) floor((x1[i]-xmin)/dn);
+		int cy = (int) floor((y1[i]-ymin)/dn);
+		for(int ky = cy-1; ky <= cy+1; ++ky) {
+			if (ky < 0 || ky >= ncy) continue;
+			for(int kx = cx-1; kx <= cx+1; ++kx) {
+				if (kx < 0 || kx >= ncx) continue;
+				int c = kx + ncx*ky;
+				for(int m = cellStart[c]; m < cellStart[c+1]; ++m) {
+					int j = order[m];
+					double ddx = x1[i]-x2[j];
+					double ddy = y1[i]-y2[j];
+					if (ddx*ddx + ddy*ddy < dn2) {
+						l1[i] += 1;
+						l2[j] += 1;
+					}
+				}
 			}
 		}
 	}
+	free(cellStart);
+
 	int n = 0;
 	for(int i = 0; i < A; ++i) {
 		if (l1[i] > 0) {
@@ -73,36 +111,120 @@ int numberWoundedNucleons(int A, double b, double * const __restrict__ x, double
 	return n;
 }
 
-void 
-monteCarloGlauberEnergyDensityTransverseProfile(double * const __restrict__ energyDensityTransverse, 
+int sampleWoundedNucleons(int A, double b, double snn, int seed, int event, double * const __restrict__ x, double * const __restrict__ y) {
+	double x1[A], y1[A], x2[A], y2[A];
+	// one stream per nucleus
+	struct RandomStream rs;
+	initializeRandomStream(&rs, seed, event, 0);
+	sampleWoodsSaxon(A,x1,y1,&rs);
+	initializeRandomStream(&rs, seed, event, 1);
+	sampleWoodsSaxon(A,x2,y2,&rs);
+	for (int i=0; i<A; i++) {
+		x1[i] -= b/2;
+		x2[i] += b/2;
+	}
+	return findWoundedNucleons(A,x1,y1,x2,y2,snn,x,y);
+}
+
+double * sampleEventsWoundedNucleons(int numEvents, void * initCondParams) {
+	struct InitialConditionParameters * events = (struct InitialConditionParameters *) initCondParams;
+	// every Monte Carlo Glauber event (initialConditionType 4) has room for the 2A nucleons of its nuclei
+	size_t *offsets = (size_t *) malloc((numEvents+1) * sizeof(size_t));
+	offsets[0] = 0;
+	for(int n = 0; n < numEvents; ++n)
+		offsets[n+1] = offsets[n] + (events[n].initialConditionType == 4 ? 2*events[n].numberOfNucleonsPerNuclei : 0);
+	double *positions = (double *) malloc(2 * offsets[numEvents] * sizeof(double));
+	// the rejection sampling takes a varying number of draws per event
+	#pragma omp parallel for schedule(dynamic)
+	for(int n = 0; n < numEvents; ++n) {
+		if (events[n].initialConditionType != 4) continue;
+		int NA = events[n].numberOfNucleonsPerNuclei;
+		double *x = positions + 2*offsets[n];
+		double *y = x + 2*NA;
+		events[n].numWoundedNucleons = sampleWoundedNucleons(NA, events[n].impactParameter, events[n].scatteringCrossSectionNN,
+				events[n].randomSeed, events[n].eventIndex, x, y);
+		events[n].woundedNucleonsX = x;
+		events[n].woundedNucleonsY = y;
+	}
+	free(offsets);
+	return positions;
+}
+
+void depositWoundedNucleons(double * const __restrict__ energyDensityTransverse, int nx, int ny, double dx, double dy,
+		int nNucleons, const double * const xp, const double * const yp, double sigma, double cutoffRadius) {
+	int numCells = nx*ny;
+	double x0 = -(nx-1.)/2.*dx;
+	double y0 = -(ny-1.)/2.*dy;
+	bool truncated = cutoffRadius > 0;
+	double R2 = cutoffRadius*cutoffRadius;
+	// contiguous ranges of nucleons are accumulated into partial profiles, summed in the order of the ranges
+	int numPartialSums = nNucleons < DEPOSITION_PARTIAL_SUMS ? nNucleons : DEPOSITION_PARTIAL_SUMS;
+	double *buffers = (double *) calloc((size_t) numPartialSums*numCells, sizeof(double));
+	#pragma omp parallel
+	{
+		double wx[nx], wy[ny], rx2[nx], ry2[ny];
+		#pragma omp for schedule(dynamic)
+		for (int m = 0; m < numPartialSums; ++m) {
+			double *partial = buffers + (size_t) m*numCells;
+			for (int n = m*nNucleons/numPartialSums; n < (m+1)*nNucleons/numPartialSums; ++n) {
+				// cells within the cutoff along either axis
+				int i0 = 0, i1 = nx-1, j0 = 0, j1 = ny-1;
+				if (truncated) {
+					i0 = (int) fmax(0., ceil((xp[n]-cutoffRadius-x0)/dx));
+					i1 = (int) fmin(nx-1., floor((xp[n]+cutoffRadius-x0)/dx));
+					j0 = (int) fmax(0., ceil((yp[n]-cutoffRadius-y0)/dy));
+					j1 = (int) fmin(ny-1., floor((yp[n]+cutoffRadius-y0)/dy));
+				}
+				// the Gaussian is the product of its profiles in x and y
+				for (int i = i0; i <= i1; ++i) {
+					double x = (i - ((double)nx-1.)/2.)*dx - xp[n];
+					rx2[i] = x*x;
+					wx[i] = exp(-x*x/2/sigma/sigma);
+				}
+				for (int j = j0; j <= j1; ++j) {
+					double y = (j - ((double)ny-1.)/2.)*dy - yp[n];
+					ry2[j] = y*y;
+					wy[j] = exp(-y*y/2/sigma/sigma);
+				}
+				for (int j = j0; j <= j1; ++j) {
+					for (int i = i0; i <= i1; ++i) {
+						if (truncated && rx2[i] + ry2[j] > R2) continue;
+						partial[i + nx*j] += wx[i]*wy[j];
+					}
+				}
+			}
+		}
+		#pragma omp for
+		for (int s = 0; s < numCells; ++s) {
+			double sum = 0;
+			for (int m = 0; m < numPartialSums; ++m) sum += buffers[(size_t) m*numCells + s];
+			energyDensityTransverse[s] = sum;
+		}
+	}
+	free(buffers);
+}
+
+void
+monteCarloGlauberEnergyDensityTransverseProfile(double * const __restrict__ energyDensityTransverse,
 int nx, int ny, double dx, double dy, void * initCondParams
 ) {
 	struct InitialConditionParameters * initCond = (struct InitialConditionParameters *) initCondParams;
 	int NA = initCond->numberOfNucleonsPerNuclei;
 	double b = initCond->impactParameter;
-	double e0 = initCond->initialEnergyDensity;
 	double snn = initCond->scatteringCrossSectionNN;
-	double etaFlat = initCond->rapidityMean;
-	double etaVariance = initCond->rapidityVariance;
 	double SIG0 = 0.46;
 
-	double xp[2*NA], yp[2*NA];
-   srand(1328398221);
-	int nNucleons = numberWoundedNucleons(NA,b,xp,yp,snn);
-	printf("==> Found %d wounded nucleons.\n", nNucleons);
-	for(int i = 0; i < nx; ++i) {
-   	for(int j = 0; j < ny; ++j) {
-      	energyDensityTransverse[i + nx*j] = 0;
-      }
-	}
-	for(int i = 0; i < nx; ++i) {
-   	for(int j = 0; j < ny; ++j) {
-      	for (int n = 0; n < nNucleons; ++n) {
-         	double x = (i - ((double)nx-1.)/2.)*dx - xp[n]; 
-            double y = (j - ((double)ny-1.)/2.)*dy - yp[n]; 
-				// assumes gaussion bump in density
-            energyDensityTransverse[i + nx*j] += exp(-x*x/2/SIG0/SIG0-y*y/2/SIG0/SIG0);
-         }
-		}
+	double x[2*NA], y[2*NA];
+	const double *xp = x, *yp = y;
+	int nNucleons;
+	// sampled beforehand with the other events of a batch
+	if (initCond->woundedNucleonsX != NULL) {
+		nNucleons = initCond->numWoundedNucleons;
+		xp = initCond->woundedNucleonsX;
+		yp = initCond->woundedNucleonsY;
 	}
+	else nNucleons = sampleWoundedNucleons(NA,b,snn,initCond->randomSeed,initCond->eventIndex,x,y);
+	printf("==> Found %d wounded nucleons in event %d (seed %d).\n", nNucleons, initCond->eventIndex, initCond->randomSeed);
+	// assumes gaussion bump in density
+	depositWoundedNucleons(energyDensityTransverse, nx, ny, dx, dy, nNucleons, xp, yp, SIG0, initCond->depositionCutoffRadius);
 }
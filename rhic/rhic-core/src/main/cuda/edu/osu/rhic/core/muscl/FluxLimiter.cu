@@ -14,23 +14,23 @@
 
 #define THETA 1.8
 
-__device__ 
+__host__ __device__ 
 inline PRECISION sign(PRECISION x) {
 	if (x<0) return -1;
 	else return 1;
 }
 
-__device__ 
+__host__ __device__ 
 inline PRECISION minmod(PRECISION x, PRECISION y) {
-	return (sign(x)+sign(y))*fminf(fabsf(x),fabsf(y))/2;
+	return (sign(x)+sign(y))*fmin(fabs(x),fabs(y))/2;
 }
 
-__device__ 
+__host__ __device__ 
 PRECISION minmod3(PRECISION x, PRECISION y, PRECISION z) {
    return minmod(x, minmod(y,z));
 }
 
-__device__ 
+__host__ __device__ 
 PRECISION approximateDerivative(PRECISION x, PRECISION y, PRECISION z) {
 	PRECISION left = THETA * (y - x);
 	PRECISION ctr = (z - x) / 2;
@@ -5,6 +5,8 @@
  *      Author: bazow
  */
 
+#include <math.h>
+
 #include <cuda.h>
 #include <cuda_runtime.h>
 
@@ -12,13 +14,13 @@
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
 // maximal local speed at the cell boundaries x_{j\pm 1/2}
-__device__ 
+__host__ __device__ 
 PRECISION localPropagationSpeed(PRECISION utr, PRECISION uxr, PRECISION uyr, PRECISION unr,
 		PRECISION utl, PRECISION uxl, PRECISION uyl, PRECISION unl,
 		PRECISION (*spectralRadius)(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un)
 ) {
 	PRECISION rhoLeftMovingWave = spectralRadius(utl,uxl,uyl,unl);
 	PRECISION rhoRightMovingWave = spectralRadius(utr,uxr,uyr,unr);
-	PRECISION a = fmaxf(rhoLeftMovingWave, rhoRightMovingWave);
+	PRECISION a = fmax(rhoLeftMovingWave, rhoRightMovingWave);
 	return a;
 }
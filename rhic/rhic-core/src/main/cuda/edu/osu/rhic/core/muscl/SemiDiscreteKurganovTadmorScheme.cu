@@ -12,7 +12,8 @@
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/core/muscl/LocalPropagationSpeed.cuh"
 
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void flux(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result,
 		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
 		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
@@ -21,12 +22,12 @@ void flux(const PRECISION * const __restrict__ data, PRECISION * const __restric
 		PRECISION t, PRECISION ePrev
 ) {
 	// left and right cells
-	PRECISION qR[NUMBER_CONSERVED_VARIABLES], qL[NUMBER_CONSERVED_VARIABLES];
+	PRECISION qR[NUMBER_CONSERVED_VARIABLES(MODE)], qL[NUMBER_CONSERVED_VARIABLES(MODE)];
 
 	// left and right extrapolated values of the conserved variables
 	int ptr = 0;
 	PRECISION qmm, qm, q, qp, qpp;
-	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
 		qmm 	= *(data+ptr);
 		qm 	= *(data+ptr+1);
 		q 		= *(data+ptr+2);
@@ -39,13 +40,13 @@ void flux(const PRECISION * const __restrict__ data, PRECISION * const __restric
 
 	// left and right extrapolated values of the primary variables
 	PRECISION eR,pR,utR,uxR,uyR,unR;
-	getInferredVariables(t,qR,ePrev,&eR,&pR,&utR,&uxR,&uyR,&unR);
+	getInferredVariables<MODE>(t,qR,ePrev,&eR,&pR,&utR,&uxR,&uyR,&unR);
 	PRECISION eL,pL,utL,uxL,uyL,unL;
-	getInferredVariables(t,qL,ePrev,&eL,&pL,&utL,&uxL,&uyL,&unL);
+	getInferredVariables<MODE>(t,qL,ePrev,&eL,&pL,&utL,&uxL,&uyL,&unL);
 
 	PRECISION a,qR_n,qL_n,FqR,FqL,res;
 	a = localPropagationSpeed(utR,uxR,uyR,unR,utL,uxL,uyL,unL,spectralRadius);
-	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
 		qR_n = qR[n];
 		qL_n = qL[n];
 		FqR = fluxFunction(qR_n, utR, uxR, uyR, unR);
@@ -56,7 +57,8 @@ void flux(const PRECISION * const __restrict__ data, PRECISION * const __restric
 	}
 }
 
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void flux2(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result,
 		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
 		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp),
@@ -65,10 +67,10 @@ void flux2(const PRECISION * const __restrict__ data, PRECISION * const __restri
 		PRECISION t, int ptr, int stride, PRECISION ePrev
 ) {
 	// left and right cells
-	PRECISION qR[NUMBER_CONSERVED_VARIABLES], qL[NUMBER_CONSERVED_VARIABLES];
+	PRECISION qR[NUMBER_CONSERVED_VARIABLES(MODE)], qL[NUMBER_CONSERVED_VARIABLES(MODE)];
 
 	// left and right extrapolated values of the conserved variables
-	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
 		PRECISION q = *(data + ptr);		
 		PRECISION qmm 	= *(data + ptr - 2);
 		PRECISION qm 	= *(data + ptr - 1);
@@ -81,13 +83,13 @@ void flux2(const PRECISION * const __restrict__ data, PRECISION * const __restri
 
 	// left and right extrapolated values of the primary variables
 	PRECISION eR,pR,utR,uxR,uyR,unR;
-	getInferredVariables(t,qR,ePrev,&eR,&pR,&utR,&uxR,&uyR,&unR);
+	getInferredVariables<MODE>(t,qR,ePrev,&eR,&pR,&utR,&uxR,&uyR,&unR);
 	PRECISION eL,pL,utL,uxL,uyL,unL;
-	getInferredVariables(t,qL,ePrev,&eL,&pL,&utL,&uxL,&uyL,&unL);
+	getInferredVariables<MODE>(t,qL,ePrev,&eL,&pL,&utL,&uxL,&uyL,&unL);
 
 	PRECISION a,qR_n,qL_n,FqR,FqL,res;
 	a = localPropagationSpeed(utR,uxR,uyR,unR,utL,uxL,uyL,unL,spectralRadius);
-	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
 		qR_n = qR[n];
 		qL_n = qL[n];
 		FqR = fluxFunction(qR_n, utR, uxR, uyR, unR);
@@ -97,3 +99,18 @@ void flux2(const PRECISION * const __restrict__ data, PRECISION * const __restri
 		result[n] = res; 
 	}
 }
+
+#define INSTANTIATE_FLUX(MODE) \
+template __host__ __device__ void flux<MODE>(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result, \
+		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp), \
+		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp), \
+		PRECISION (* const spectralRadius)(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un), \
+		PRECISION (* const fluxFunction)(PRECISION q, PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un), \
+		PRECISION t, PRECISION ePrev); \
+template __host__ __device__ void flux2<MODE>(const PRECISION * const __restrict__ data, PRECISION * const __restrict__ result, \
+		PRECISION (* const rightHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp), \
+		PRECISION (* const leftHalfCellExtrapolation)(PRECISION qmm, PRECISION qm, PRECISION q, PRECISION qp, PRECISION qpp), \
+		PRECISION (* const spectralRadius)(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un), \
+		PRECISION (* const fluxFunction)(PRECISION q, PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un), \
+		PRECISION t, int ptr, int stride, PRECISION ePrev);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_FLUX)
@@ -0,0 +1,43 @@
+/*
+ * GlauberModelTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+#include "edu/osu/rhic/core/ic/GlauberModel.h"
+#include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
+
+TEST(GlauberModel, TabulatedThicknessFunction) {
+	double A = 208;
+	struct NuclearThicknessTable table;
+	tabulateNuclearThicknessFunction(&table, A);
+	double T0 = nuclearThicknessFunction(0, 0, A);
+	for (double r = 0; r < 12; r += 0.37) {
+		double x = r * cos(1.3 * r), y = r * sin(1.3 * r);
+		EXPECT_NEAR(nuclearThicknessFunction(x, y, A), interpolateNuclearThicknessFunction(&table, x, y), 1.e-6 * T0);
+	}
+	EXPECT_EQ(0, interpolateNuclearThicknessFunction(&table, 30, 0));
+	freeNuclearThicknessTable(&table);
+}
+
+TEST(GlauberModel, CentralCollisionProfile) {
+	struct InitialConditionParameters initCond;
+	initCond.numberOfNucleonsPerNuclei = 208;
+	initCond.scatteringCrossSectionNN = 62;
+	initCond.impactParameter = 0;
+	initCond.fractionOfBinaryCollisions = 0.5;
+	int nx = 41, ny = 41;
+	double eT[41 * 41];
+	energyDensityTransverseProfileAA(eT, nx, ny, 0.5, 0.5, &initCond);
+	// normalized to one at the centre, and symmetric under reflections
+	EXPECT_NEAR(1, eT[20 + 20 * nx], 1.e-12);
+	for (int i = 0; i < nx; ++i)
+		for (int j = 0; j < ny; ++j) {
+			EXPECT_LE(eT[i + j * nx], 1 + 1.e-12);
+			EXPECT_DOUBLE_EQ(eT[i + j * nx], eT[nx - 1 - i + j * nx]);
+			EXPECT_DOUBLE_EQ(eT[i + j * nx], eT[j + i * nx]);
+		}
+}
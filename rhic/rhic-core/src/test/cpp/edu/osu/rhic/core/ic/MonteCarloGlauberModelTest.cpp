@@ -0,0 +1,129 @@
+/*
+ * MonteCarloGlauberModelTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <math.h>
+#include <omp.h>
+
+#include "edu/osu/rhic/core/ic/MonteCarloGlauberModel.h"
+#include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
+
+TEST(MonteCarloGlauberModel, GridHashFindsAllCollisions) {
+	int A = 208;
+	double snn = 62;
+	double x1[208], y1[208], x2[208], y2[208], x[416], y[416];
+	struct RandomStream rs;
+	initializeRandomStream(&rs, 7, 0, 0);
+	for (int event = 0; event < 5; ++event) {
+		sampleWoodsSaxon(A, x1, y1, &rs);
+		sampleWoodsSaxon(A, x2, y2, &rs);
+		for (int i = 0; i < A; ++i) {
+			x1[i] -= event;
+			x2[i] += event;
+		}
+		// all pairs
+		double dn = sqrt(0.1*snn/M_PI);
+		int expected = 0;
+		for (int i = 0; i < A; ++i) {
+			bool wounded1 = false, wounded2 = false;
+			for (int j = 0; j < A; ++j) {
+				if (hypot(x1[i]-x2[j], y1[i]-y2[j]) < dn) wounded1 = true;
+				if (hypot(x1[j]-x2[i], y1[j]-y2[i]) < dn) wounded2 = true;
+			}
+			expected += wounded1 + wounded2;
+		}
+		EXPECT_EQ(expected, findWoundedNucleons(A, x1, y1, x2, y2, snn, x, y));
+	}
+}
+
+TEST(MonteCarloGlauberModel, EventsAreReproducible) {
+	struct InitialConditionParameters events[16];
+	int numEvents = 16;
+	for (int n = 0; n < numEvents; ++n) {
+		events[n].initialConditionType = 4;
+		events[n].numberOfNucleonsPerNuclei = 208;
+		events[n].impactParameter = 7;
+		events[n].scatteringCrossSectionNN = 62;
+		events[n].randomSeed = 1328398221;
+		events[n].eventIndex = 100 + n;
+		events[n].woundedNucleonsX = NULL;
+		events[n].woundedNucleonsY = NULL;
+	}
+	// not a Monte Carlo Glauber event
+	events[3].initialConditionType = 2;
+	double *positions = sampleEventsWoundedNucleons(numEvents, events);
+
+	double x[416], y[416];
+	bool differ = false;
+	for (int n = 0; n < numEvents; ++n) {
+		if (n == 3) {
+			EXPECT_TRUE(events[n].woundedNucleonsX == NULL);
+			continue;
+		}
+		// the same event sampled alone
+		int nw = sampleWoundedNucleons(208, 7, 62, 1328398221, 100 + n, x, y);
+		ASSERT_EQ(nw, events[n].numWoundedNucleons);
+		for (int m = 0; m < nw; ++m) {
+			EXPECT_EQ(x[m], events[n].woundedNucleonsX[m]);
+			EXPECT_EQ(y[m], events[n].woundedNucleonsY[m]);
+		}
+		if (n > 0 && nw != events[0].numWoundedNucleons) differ = true;
+	}
+	EXPECT_TRUE(differ);
+	free(positions);
+}
+
+TEST(MonteCarloGlauberModel, TruncatedDepositionMatchesFullSum) {
+	double xp[416], yp[416];
+	int nNucleons = sampleWoundedNucleons(208, 7, 62, 1328398221, 0, xp, yp);
+	int nx = 121, ny = 101;
+	double dx = 0.15, dy = 0.2, sigma = 0.46;
+	double *eT = (double *) malloc(nx * ny * sizeof(double));
+	double *full = (double *) malloc(nx * ny * sizeof(double));
+	double maximum = 0;
+	for (int i = 0; i < nx; ++i)
+		for (int j = 0; j < ny; ++j) {
+			double sum = 0;
+			for (int n = 0; n < nNucleons; ++n) {
+				double x = (i - (nx-1.)/2.)*dx - xp[n];
+				double y = (j - (ny-1.)/2.)*dy - yp[n];
+				sum += exp(-x*x/2/sigma/sigma-y*y/2/sigma/sigma);
+			}
+			full[i + nx*j] = sum;
+			maximum = fmax(maximum, sum);
+		}
+
+	depositWoundedNucleons(eT, nx, ny, dx, dy, nNucleons, xp, yp, sigma, 0);
+	for (int s = 0; s < nx * ny; ++s) EXPECT_NEAR(full[s], eT[s], 1.e-12 * maximum);
+	// beyond six widths a Gaussian is below 2e-8 of its peak
+	depositWoundedNucleons(eT, nx, ny, dx, dy, nNucleons, xp, yp, sigma, 6 * sigma);
+	for (int s = 0; s < nx * ny; ++s) {
+		EXPECT_LE(eT[s], full[s] + 1.e-12 * maximum);
+		EXPECT_NEAR(full[s], eT[s], 1.e-7 * maximum);
+	}
+	free(eT);
+	free(full);
+}
+
+TEST(MonteCarloGlauberModel, DepositionIsIndependentOfThreads) {
+	double xp[416], yp[416];
+	int nNucleons = sampleWoundedNucleons(208, 7, 62, 1328398221, 0, xp, yp);
+	int nx = 61, ny = 61;
+	double *eT = (double *) malloc(nx * ny * sizeof(double));
+	double *serial = (double *) malloc(nx * ny * sizeof(double));
+	int numThreads = omp_get_max_threads();
+	omp_set_num_threads(1);
+	depositWoundedNucleons(serial, nx, ny, 0.3, 0.3, nNucleons, xp, yp, 0.46, 2.76);
+	for (int threads = 2; threads <= 5; ++threads) {
+		omp_set_num_threads(threads);
+		depositWoundedNucleons(eT, nx, ny, 0.3, 0.3, nNucleons, xp, yp, 0.46, 2.76);
+		for (int s = 0; s < nx * ny; ++s) ASSERT_EQ(serial[s], eT[s]) << threads << " threads";
+	}
+	omp_set_num_threads(numThreads);
+	free(eT);
+	free(serial);
+}
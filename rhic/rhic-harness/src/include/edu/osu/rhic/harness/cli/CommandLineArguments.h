@@ -11,6 +11,11 @@
 #include <stdbool.h>
 #include <argp.h>
 
+#define GPU_BACKEND 0
+#define CPU_BACKEND 1
+
+#define DEFAULT_EOS_BENCHMARK_CALLS 10000000
+
 struct CommandLineArguments
 {
   char *args[2];            /* ARG1 and ARG2 */
@@ -18,6 +23,20 @@ struct CommandLineArguments
   bool runHydro;
   char *configDirectory;              /* The -v flag */
   char *outputDirectory;            /* Argument for -o */
+  int backend;            /* GPU_BACKEND or CPU_BACKEND, argument for -b */
+  int numThreads;            /* Argument for -n, 0 uses the OpenMP default */
+  int eulerStepStrategy;            /* Argument for -e */
+  int autotuneSteps;            /* Argument for -a, 0 disables the autotuner */
+  int stepBenchmarkSteps;            /* Argument for -D, 0 skips the lattice dimensions benchmark */
+  char *snapshotToConvert;            /* Argument for -x */
+  char *restartFile;            /* Argument for -r */
+  int eosBenchmarkCalls;            /* Argument for -E, 0 skips the EoS benchmark */
+  char *eventList;            /* Argument for -l, NULL runs the single event of ic.properties */
+  char *referenceDirectory;            /* Argument for -R */
+  bool profile;            /* The -P flag */
+  int kernelBenchmarkRepeats;            /* Argument for -K, 0 skips the kernel microbenchmarks */
+  bool regression;            /* The -G flag */
+  bool recordBaseline;            /* The -B flag */
 };
 
 error_t loadCommandLineArguments(int argc, char **argv, void * cli_params, const char *version, const char *address);
@@ -12,13 +12,19 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
+// Where the evolution is stopped once the temperature is below the freeze-out temperature
+#define FREEZEOUT_CENTER 0			// at the center cell, checked at the output steps
+#define FREEZEOUT_MAXIMUM 1			// everywhere, checked every time step
+
 struct HydroParameters
 {
 	double initialProperTimePoint;
 	double shearViscosityToEntropyDensity;
 	double freezeoutTemperatureGeV;
+	int freezeoutCriterion;
 	int initializePimunuNavierStokes;
 	int initializePiNavierStokes;
+	int physicsMode;
 };
 
 void loadHydroParameters(config_t *cfg, const char* configDirectory, void * params);
@@ -8,6 +8,12 @@
 #ifndef HYDROPLUGIN_H_
 #define HYDROPLUGIN_H_
 
-void run(void * latticeParams, void * initCondParams, void * hydroParams, const char *rootDirectory, const char *outputDir);
+struct OutputParameters;
+
+// Whether any of the requested fields is one of the validity domain, which is otherwise neither allocated nor computed
+bool writesValidityFields(const struct OutputParameters * output);
+
+void run(void * latticeParams, void * initCondParams, void * hydroParams, void * outputParams, void * cliParams,
+		const char *rootDirectory);
 
 #endif /* HYDROPLUGIN_H_ */
@@ -24,8 +24,25 @@ struct InitialConditionParameters
 	// longitudinal energy density profile parameters
 	double rapidityVariance; // \sigma^{2}_{\eta}
 	double rapidityMean; // flat region around \ets_s = 0
+
+	// Monte Carlo Glauber event, a function of the seed and event index only
+	int randomSeed;
+	int eventIndex;
+	// wounded nucleons only add energy density within this distance [fm] of their position (no cutoff if <= 0)
+	double depositionCutoffRadius;
+	// wounded nucleons of the event if they were sampled with the other events of a batch by
+	// sampleEventsWoundedNucleons, else NULL and sampled when the initial conditions are set
+	int numWoundedNucleons;
+	const double *woundedNucleonsX, *woundedNucleonsY;
 };
 
 void loadInitialConditionParameters(config_t *cfg, const char* configDirectory, void * params);
 
+/*
+ * Reads a batch of events from fname, one per line: the ic.properties settings on a line, e.g.
+ * "eventIndex = 3; impactParameter = 7.5;", override those of baseParams for that event. Blank lines
+ * and lines starting with # are skipped. Returns the number of events, allocated in *events, or -1.
+ */
+int loadInitialConditionEvents(const char *fname, const void * baseParams, struct InitialConditionParameters **events);
+
 #endif /* INITIALCONDITIONPARAMETERS_H_ */
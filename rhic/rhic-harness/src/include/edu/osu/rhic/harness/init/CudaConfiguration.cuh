@@ -11,6 +11,23 @@
 // Parameters put in constant memory
 extern __constant__ int d_nx,d_ny,d_nz,d_ncx,d_ncy,d_ncz,d_nElements,d_nCompElements;
 extern __constant__ PRECISION d_dt,d_dx,d_dy,d_dz,d_etabar;
+// proper time between the fluid velocity and the previous fluid velocity, used for time derivatives of u
+extern __constant__ PRECISION d_dtp;
+// number of events packed side by side in x, each d_ncx/d_ensembleSize computational points wide
+extern __constant__ int d_ensembleSize;
+
+// Host copies of the constant memory parameters (used by the host backend)
+extern int h_nx,h_ny,h_nz,h_ncx,h_ncy,h_ncz,h_nElements,h_nCompElements;
+extern PRECISION h_dt,h_dx,h_dy,h_dz,h_etabar;
+extern PRECISION h_dtp;
+extern int h_ensembleSize;
+
+// Selects the device or host copy of a parameter inside __host__ __device__ functions
+#ifdef __CUDA_ARCH__
+#define CONST_PARAM(name) d_##name
+#else
+#define CONST_PARAM(name) h_##name
+#endif
 
 // One-dimension kernel launch parameters
 extern int gridSizeConvexComb, blockSizeConvexComb;
@@ -73,7 +90,12 @@ extern dim3 BSX,GSX,BSY,GSY,BSZ,GSZ;
 extern int grid_1D,block_1D,gridX_1D,blockX_1D,gridY_1D,blockY_1D,gridZ_1D,blockZ_1D;
 //===========================================
 
+template <int MODE>
 void initializeCUDALaunchParameters(void * latticeParams);
 void initializeCUDAConstantParameters(void * latticeParams, void * initCondParams, void * hydroParams);
+void initializeHostConstantParameters(void * latticeParams, void * initCondParams, void * hydroParams);
+// Update the host copy and, unless host is true, the constant memory when the value changes
+void setTimeStep(PRECISION dt, bool host);
+void setPreviousTimeStep(PRECISION dtp, bool host);
 
 #endif /* CUDACONFIGURATION_CUH_ */
@@ -0,0 +1,54 @@
+/*
+ * Checkpoint.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <stdint.h>
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+/*
+ * Full state of the evolution after a number of time steps, written to <outputDir>/checkpoint.bin
+ * (checkpoint.bin.<rank> for each slab of a domain decomposition)
+ *
+ *		CheckpointHeader
+ *		PRECISION[ncx*ncy*ncz] per array		e, p, u, up, q (the evolved components only)
+ *
+ * The arrays include the ghost cells and are written in the machine's native representation,
+ * so a restart continues with exactly the values the interrupted run would have used.
+ */
+#define CHECKPOINT_MAGIC "GPUVHCKP"
+#define CHECKPOINT_VERSION 4
+
+struct CheckpointHeader
+{
+	char magic[8];
+	uint32_t version;
+	int32_t physicsMode;
+	int32_t ncx, ncy, ncz;
+	uint32_t precisionBytes;
+	int32_t eulerStepStrategy;	// fused and split steps round differently
+	int32_t adaptiveTimeStep;
+	char timeIntegrator[TIME_INTEGRATOR_NAME_LENGTH];
+	int32_t step;			// time steps taken since the initial conditions
+	double t;
+	double dt;				// configured time step
+	double cflNumber;		// CFL number and bounds of an adaptive time step
+	double minDt, maxDt;
+	double dtp;				// last time step taken, by which up lags u
+};
+
+// Writes through a temporary file that replaces the previous checkpoint once it is complete
+int writeCheckpoint(const char *pathToOutDir, int step, double t, double dtp, void * latticeParams,
+		const CONSERVED_VARIABLES *q, const PRECISION *e, const PRECISION *p, const FLUID_VELOCITY *u, const FLUID_VELOCITY *up);
+// Fails if the checkpoint was written for another lattice, time step, physics mode, precision, Euler step or
+// time integrator
+int readCheckpoint(const char *fname, int *step, double *t, double *dtp, void * latticeParams,
+		CONSERVED_VARIABLES *q, PRECISION *e, PRECISION *p, FLUID_VELOCITY *u, FLUID_VELOCITY *up);
+
+#endif /* CHECKPOINT_H_ */
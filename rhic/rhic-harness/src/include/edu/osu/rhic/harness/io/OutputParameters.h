@@ -0,0 +1,36 @@
+/*
+ * OutputParameters.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef OUTPUTPARAMETERS_H_
+#define OUTPUTPARAMETERS_H_
+
+#include <libconfig.h>
+
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+#include "edu/osu/rhic/harness/io/TimeSeries.h"
+
+#define OUTPUT_FIELD_LIST_LENGTH 1024
+#define MAX_PROBES 16
+
+struct OutputParameters
+{
+	int outputFrequency;			// time steps between outputs
+	double outputTimeInterval;		// proper time between outputs [fm/c], used instead of outputFrequency if positive
+	int outputRegion;				// SNAPSHOT_FULL_GRID, SNAPSHOT_ETA_SLICE or SNAPSHOT_Y_SLICE
+	int outputStride;				// write every outputStride-th cell in each direction
+	int numOutputFields;
+	char outputFields[SNAPSHOT_MAX_FIELDS][SNAPSHOT_FIELD_NAME_LENGTH];
+	int checkpointFrequency;		// time steps between checkpoints, 0 disables checkpoints
+	int observablesFormat;			// TIME_SERIES_NONE, TIME_SERIES_CSV or TIME_SERIES_BINARY
+	int observablesFrequency;		// time steps between the rows of the observables
+	int numProbes;
+	char probeNames[MAX_PROBES][SNAPSHOT_FIELD_NAME_LENGTH];
+	double probePositions[MAX_PROBES][3];	// (x, y, eta) [fm]
+};
+
+void loadOutputParameters(config_t *cfg, const char* configDirectory, void * params);
+
+#endif /* OUTPUTPARAMETERS_H_ */
@@ -0,0 +1,63 @@
+/*
+ * OutputWriter.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef OUTPUTWRITER_H_
+#define OUTPUTWRITER_H_
+
+#include <pthread.h>
+
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+
+// number of snapshots that can be queued or in flight before the evolution blocks
+#define OUTPUT_WRITER_BUFFERS 2
+
+/*
+ * Snapshot staged for the writer thread. The fields are packed (ghost cells stripped, float)
+ * on the calling thread, so the evolution can overwrite the host arrays as soon as the buffer
+ * is submitted.
+ */
+struct OutputBuffer
+{
+	double t;
+	int numFields;
+	char names[SNAPSHOT_MAX_FIELDS][SNAPSHOT_FIELD_NAME_LENGTH];
+	float *fields[SNAPSHOT_MAX_FIELDS];		// allocated on first use and reused
+	struct OutputBuffer *next;
+};
+
+/*
+ * Writes snapshots on a background thread. Buffers cycle through a free list and a FIFO queue;
+ * acquireOutputBuffer blocks while every buffer is queued or being written. With a domain
+ * decomposition every rank packs the part of the region in its slab and the root rank gathers
+ * and writes the snapshots; the other ranks have neither a thread nor a queue.
+ */
+struct OutputWriter
+{
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t bufferFreed, bufferQueued;
+	struct OutputBuffer buffers[OUTPUT_WRITER_BUFFERS];
+	struct OutputBuffer *freeList;
+	struct OutputBuffer *head, *tail;
+	int shutdown;
+	int errors;
+	const char *pathToOutDir;
+	void *latticeParams;
+	struct SnapshotRegion region;
+	struct SnapshotRegion slabRegion;	// cells of region in the slab of this rank
+	int ncx;							// row length of the fields added, wider than the lattice's in an ensemble
+};
+
+// latticeParams is the whole lattice; region may be NULL to write the full grid
+int startOutputWriter(struct OutputWriter *writer, const char *pathToOutDir, void * latticeParams,
+		const struct SnapshotRegion *region);
+struct OutputBuffer * acquireOutputBuffer(struct OutputWriter *writer, double t);
+int addOutputField(struct OutputWriter *writer, struct OutputBuffer *buffer, const char *name, const PRECISION * const var);
+void submitOutputBuffer(struct OutputWriter *writer, struct OutputBuffer *buffer);
+// Writes every queued snapshot, joins the writer thread and returns the number of failed snapshots
+int stopOutputWriter(struct OutputWriter *writer);
+
+#endif /* OUTPUTWRITER_H_ */
@@ -0,0 +1,127 @@
+/*
+ * Snapshot.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <dirent.h>
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*
+ * Binary snapshot of the fluid at one time step, written to <outputDir>/snapshot_<t>.bin
+ *
+ *		SnapshotHeader										88 bytes
+ *		SnapshotField[SNAPSHOT_MAX_FIELDS]					field table, unused entries zeroed
+ *		float[nx*ny*nz] per field							at SnapshotField::offset
+ *
+ * All values are little-endian. The arrays hold the written region of the physical lattice
+ * without ghost cells, x running fastest (s = i + nx*(j + ny*k)), and start on SNAPSHOT_ALIGNMENT
+ * byte boundaries so that a mapped file can be read in place. Cell (i,j,k) sits at
+ * (x0 + i*dx, y0 + j*dy, z0 + k*dz).
+ */
+#define SNAPSHOT_MAGIC "GPUVHSNP"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_MAX_FIELDS 64
+#define SNAPSHOT_FIELD_NAME_LENGTH 24
+#define SNAPSHOT_ALIGNMENT 64
+
+struct SnapshotHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t numFields;
+	int32_t nx, ny, nz;
+	uint32_t fieldBytes;		// bytes per value
+	double t;
+	double dx, dy, dz;
+	double x0, y0, z0;
+};
+
+struct SnapshotField
+{
+	char name[SNAPSHOT_FIELD_NAME_LENGTH];
+	uint64_t offset;
+};
+
+// Regions of the lattice that can be written
+#define SNAPSHOT_FULL_GRID 0
+#define SNAPSHOT_ETA_SLICE 1		// transverse plane at eta = 0
+#define SNAPSHOT_Y_SLICE 2			// x-eta plane at y = 0
+
+// Every sx-th, sy-th, sz-th physical cell starting from (i0, j0, k0), nx x ny x nz cells in all
+struct SnapshotRegion
+{
+	int i0, j0, k0;
+	int nx, ny, nz;
+	int sx, sy, sz;
+};
+
+// Snapshot being written; fields are appended one at a time and the table is written on close
+struct SnapshotWriter
+{
+	FILE *fp;
+	struct SnapshotHeader header;
+	struct SnapshotField fields[SNAPSHOT_MAX_FIELDS];
+	uint64_t end;
+	int ncx, ncy;
+	struct SnapshotRegion region;
+	float *buffer;
+};
+
+// Snapshot mapped read-only into memory
+struct Snapshot
+{
+	void *data;
+	size_t size;
+	const struct SnapshotHeader *header;
+	const struct SnapshotField *fields;
+};
+
+// Region of the lattice written with the given region type, keeping every stride-th cell centred on the origin
+void setSnapshotRegion(struct SnapshotRegion *region, void * latticeParams, int regionType, int stride);
+// Cells of region in the rapidity points first <= k < first + count, with k0 counted from first; slab->nz may be 0
+void restrictSnapshotRegion(const struct SnapshotRegion *region, int first, int count, struct SnapshotRegion *slab);
+
+// region may be NULL to write the full grid
+int openSnapshotWriter(struct SnapshotWriter *writer, double t, const char *pathToOutDir, void * latticeParams,
+		const struct SnapshotRegion *region);
+int writeSnapshotField(struct SnapshotWriter *writer, const char *name, const PRECISION * const var);
+// Same as writeSnapshotField for an array already stripped of ghost cells by packSnapshotField
+int writePackedSnapshotField(struct SnapshotWriter *writer, const char *name, const float * const packed);
+int closeSnapshotWriter(struct SnapshotWriter *writer);
+
+// Copies the cells of region from var (ncx x ncy x ncz with ghost cells) into packed
+void packSnapshotField(const PRECISION * const var, float * const packed, const struct SnapshotRegion *region, int ncx, int ncy);
+
+int openSnapshot(const char *fname, struct Snapshot *snapshot);
+const float * getSnapshotField(const struct Snapshot *snapshot, const char *name);
+void closeSnapshot(struct Snapshot *snapshot);
+
+// Writes every field of the snapshot to name_<t>.dat in the text format of output()
+int convertSnapshotToText(const char *fname, const char *pathToOutDir);
+
+// Deviation of a field from its reference; infinite if one holds a NaN where the other does not
+struct SnapshotDeviation
+{
+	char name[SNAPSHOT_FIELD_NAME_LENGTH+1];
+	double deviation;			// max |var - reference| over the larger of max |var| and max |reference|
+	double difference;			// max |var - reference|
+};
+
+// Sets the deviation and difference of the n values of var from reference
+void snapshotFieldDeviation(const float * const var, const float * const reference, size_t n, struct SnapshotDeviation *deviation);
+// Deviation of every field of the snapshot also in the reference snapshot; returns their number or -1
+int compareSnapshots(const char *fname, const char *referenceFname, struct SnapshotDeviation *deviations);
+// Entries of the snapshot_<t>.bin files of pathToOutDir in alphabetical order, to be freed by the caller; returns their number or -1
+int listSnapshotFiles(const char *pathToOutDir, struct dirent ***entries);
+// Prints the largest deviation of each field over the snapshots of pathToOutDir with a same-named file in pathToReferenceDir
+int compareSnapshotDirectories(const char *pathToOutDir, const char *pathToReferenceDir);
+
+#endif /* SNAPSHOT_H_ */
@@ -0,0 +1,57 @@
+/*
+ * TimeSeries.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TIMESERIES_H_
+#define TIMESERIES_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Time series of scalar observables, one row of numColumns doubles per record. TIME_SERIES_CSV writes a
+ * header line of the column names followed by one comma separated line per row, TIME_SERIES_BINARY
+ *
+ *		char[8] magic, uint32_t numColumns
+ *		char[TIME_SERIES_NAME_LENGTH] per column
+ *		double[numColumns] per row
+ *
+ * in little-endian byte order.
+ */
+#define TIME_SERIES_NONE 0
+#define TIME_SERIES_CSV 1
+#define TIME_SERIES_BINARY 2
+
+#define TIME_SERIES_MAGIC "GPUVHTSR"
+#define TIME_SERIES_NAME_LENGTH 32
+
+struct TimeSeries
+{
+	FILE *fp;
+	int format;
+	int numColumns;
+};
+
+// With append the rows follow those already in the file (of a run being restarted), which keeps its header
+int openTimeSeries(struct TimeSeries *series, const char *fname, int format, int numColumns, const char * const *names, bool append);
+void writeTimeSeriesRow(struct TimeSeries *series, const double * const values);
+void closeTimeSeries(struct TimeSeries *series);
+
+// Time series read back from a CSV file, the rows one after the other in values
+struct TimeSeriesTable
+{
+	int numColumns;
+	int numRows;
+	char (*names)[TIME_SERIES_NAME_LENGTH];
+	double *values;
+};
+
+// Reads a TIME_SERIES_CSV file; returns -1 if it cannot be read or a row does not have a value per column
+int readTimeSeries(const char *fname, struct TimeSeriesTable *table);
+// Index of the column with the given name, -1 if there is none
+int getTimeSeriesColumn(const struct TimeSeriesTable *table, const char *name);
+void freeTimeSeriesTable(struct TimeSeriesTable *table);
+
+#endif /* TIMESERIES_H_ */
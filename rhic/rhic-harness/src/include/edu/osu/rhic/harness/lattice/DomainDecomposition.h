@@ -0,0 +1,50 @@
+/*
+ * DomainDecomposition.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef DOMAINDECOMPOSITION_H_
+#define DOMAINDECOMPOSITION_H_
+
+/*
+ * With USE_MPI (make MPI=1) every process evolves a slab of consecutive rapidity points of the lattice,
+ * with N_GHOST_CELLS_M planes of its neighbours' slabs in place of the ghost cells on either side
+ * (see HaloExchange.cuh). Without MPI there is a single slab holding the whole lattice and the
+ * collective operations below leave their arguments unchanged.
+ */
+struct DomainDecomposition
+{
+	int rank;
+	int numRanks;
+	int localRank;					// among the ranks on the same node, to pick a GPU
+	int numLatticePointsRapidity;	// of the whole lattice
+	int firstRapidityPoint;			// of the slab of this rank
+	int lowerRank;					// ranks holding the neighbouring slabs, -1 at the ends of the lattice
+	int upperRank;
+};
+
+extern struct DomainDecomposition domain;
+
+// Starts MPI; the standard output of all ranks but the root is discarded
+void initializeDomainDecomposition(int *argc, char ***argv);
+void finalizeDomainDecomposition();
+
+// Slab of the given rank, the first nz % numRanks slabs are one point longer than the others
+void getRapiditySlab(int nz, int numRanks, int rank, int *first, int *count);
+// Rank whose slab holds rapidity point k
+int getRapiditySlabRank(int nz, int numRanks, int k);
+// Restricts the lattice to the slab of this rank; fails if the slabs are too thin for the halo exchange
+int decomposeLattice(void * latticeParams);
+
+bool isRootRank();
+// Element-wise maximum, minimum and sum of x over all ranks, left in x on every rank
+void maximumOverRanks(double * const x, int n);
+void minimumOverRanks(double * const x, int n);
+void sumOverRanks(unsigned long long * const x, int n);
+void sumOverRanks(double * const x, int n);
+void broadcastFromRank(double * const x, int n, int root);
+// Appends the bytes of the other ranks, in rank order, to the first bytes of data on the root rank
+void gatherOnRootRank(void * const data, int bytes);
+
+#endif /* DOMAINDECOMPOSITION_H_ */
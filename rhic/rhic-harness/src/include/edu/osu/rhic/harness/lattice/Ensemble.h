@@ -0,0 +1,27 @@
+/*
+ * Ensemble.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ENSEMBLE_H_
+#define ENSEMBLE_H_
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*
+ * An ensemble evolves several events of the same lattice as one lattice, packed side by side in x:
+ * event n holds the computational points n*ncx <= i < (n+1)*ncx of the packed lattice, ncx being that
+ * of a single event, ghost cells included. The steps treat the packed lattice as a whole, and the ghost
+ * cells set on the x faces of every event after each stage (see GhostCells.cu) keep the events apart.
+ * The N_GHOST_CELLS columns between two events are evolved as well and overwritten, which adds
+ * N_GHOST_CELLS/nx to the cost of a step.
+ */
+
+// Widens the lattice in place to ensembleSize events
+void packLatticeEnsemble(void * latticeParams, int ensembleSize);
+
+// Copies var of a single event, ghost cells included, into the columns of event n of the packed lattice
+void packEventRows(PRECISION * const packed, const PRECISION * const var, int n, void * packedLatticeParams);
+
+#endif /* ENSEMBLE_H_ */
@@ -14,6 +14,8 @@
 #define N_GHOST_CELLS_P 2
 #define N_GHOST_CELLS 4
 
+#define TIME_INTEGRATOR_NAME_LENGTH 16
+
 struct LatticeParameters
 {
 	int numLatticePointsX;
@@ -28,6 +30,19 @@ struct LatticeParameters
 	double latticeSpacingY;
 	double latticeSpacingRapidity;
 	double latticeSpacingProperTime;
+
+	// with adaptiveTimeStep != 0 the time step follows the CFL condition (see courantTimeStep) and the
+	// run ends at numProperTimePoints * latticeSpacingProperTime after the initial proper time
+	int adaptiveTimeStep;
+	double cflNumber;
+	double minLatticeSpacingProperTime;
+	double maxLatticeSpacingProperTime;
+
+	// Runge-Kutta scheme of the time step, rk2 or ssp_rk3
+	char timeIntegrator[TIME_INTEGRATOR_NAME_LENGTH];
+
+	// events of an event list evolved together, packed side by side in x (see Ensemble.h)
+	int ensembleSize;
 };
 
 void loadLatticeParameters(config_t *cfg, const char* configDirectory, void * params);
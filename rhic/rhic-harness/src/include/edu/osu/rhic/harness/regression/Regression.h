@@ -0,0 +1,62 @@
+/*
+ * Regression.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef REGRESSION_H_
+#define REGRESSION_H_
+
+#include <libconfig.h>
+
+#include "edu/osu/rhic/harness/io/TimeSeries.h"
+
+// Columns whose root mean square is below this magnitude are compared as absolute rather than relative deviations
+#define TIME_SERIES_DEVIATION_FLOOR 1.e-4
+
+// Limits of a test problem, from regression.properties in its configuration directory
+struct RegressionThresholds
+{
+	double maxAnalyticError;		// relative L1 error of the energy density from the analytic solution
+	double maxReferenceDeviation;	// relative L2 deviation of an observable from reference.csv
+	double maxThroughputDrop;		// fraction of the cell updates per second of the baseline that may be lost
+};
+
+void loadRegressionThresholds(config_t *cfg, const char* configDirectory, struct RegressionThresholds *thresholds);
+
+// Relative error norms of the energy density of a snapshot
+struct SolutionError
+{
+	double l1;			// sum |e - ea| over sum |ea|
+	double l2;			// root of sum (e - ea)^2 over sum ea^2
+	double lInf;		// max |e - ea| over max |ea|
+};
+
+/*
+ * Errors of the energy density of the snapshot from the analytic solution of the test problem set up by the initial
+ * conditions: the ideal Gubser flow and the Sod shock tubes (in Cartesian coordinates, along the normal of the
+ * diaphragm). Returns 0, 1 if the initial conditions have no analytic solution, or -1 if the snapshot cannot be read.
+ */
+int analyticSolutionError(const char *fname, void * initCondParams, void * hydroParams, struct SolutionError *error);
+
+/*
+ * Largest relative L2 deviation over the rows of a column of series from the same-named column of reference,
+ * all but n, and its column name; infinite if the numbers of rows differ
+ */
+double timeSeriesDeviation(const struct TimeSeriesTable *series, const struct TimeSeriesTable *reference, const char **column);
+
+// Whether the throughputs of two profile.json files may be compared: both recorded on the same host with as many threads
+bool isComparableBaseline(const char *profileFname, const char *baselineFname);
+
+/*
+ * Checks the run in pathToOutDir against the thresholds of configDirectory: the energy density of its snapshots
+ * against the analytic solution, its observables.csv against configDirectory/reference.csv and the cell updates per
+ * second of its profile.json against configDirectory/baseline_<backend>.json. A missing snapshot, observables or
+ * profile file fails the check. The throughput is not checked without a baseline, or with a baseline of another host
+ * or thread count, since it only measures the machine it was recorded on; recordBaseline writes profile.json as the
+ * new baseline instead of comparing with it. Prints a report and returns 0 if the run passes, 1 if it regressed.
+ */
+int checkRegression(const char *pathToOutDir, const char *configDirectory, void * initCondParams, void * hydroParams,
+		bool recordBaseline);
+
+#endif /* REGRESSION_H_ */
@@ -0,0 +1,13 @@
+/*
+ * MonotonicClock.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef MONOTONICCLOCK_H_
+#define MONOTONICCLOCK_H_
+
+// Milliseconds of a monotonic wall clock, which unlike gettimeofday does not jump with adjustments of the system time
+double monotonicTime();
+
+#endif /* MONOTONICCLOCK_H_ */
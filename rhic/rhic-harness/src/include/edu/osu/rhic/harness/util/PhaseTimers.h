@@ -0,0 +1,79 @@
+/*
+ * PhaseTimers.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef PHASETIMERS_H_
+#define PHASETIMERS_H_
+
+#include <stdbool.h>
+
+/*
+ * Wall-clock durations of the phases of the evolution, recorded between beginPhase and endPhase while the
+ * timers are enabled (--profile). Phases may nest: the Euler step is timed as a whole and, with the split
+ * strategies, as its source term and flux kernels. On the GPU the device is synchronized at the phase
+ * boundaries so that a phase is charged for its own kernels, which also keeps the halo exchange from
+ * overlapping with the interior planes.
+ */
+#define PHASE_EVOLUTION 0			// the time evolution loop of an ensemble, once per ensemble
+#define PHASE_TIME_STEP 1			// a step of the time integrator
+#define PHASE_EULER_STEP 2			// source terms and fluxes
+#define PHASE_SOURCE_TERMS 3		// source kernel of the split strategies
+#define PHASE_FLUXES 4				// X, Y and Z kernels of the split strategies
+#define PHASE_INFERRED_VARIABLES 5	// energy density, pressure and fluid velocity from the conserved variables
+#define PHASE_REGULATION 6			// regulation of the dissipative currents
+#define PHASE_GHOST_CELLS 7
+#define PHASE_HALO_EXCHANGE 8		// the start and the completion of an exchange, timed separately
+#define PHASE_CONVEX_COMBINATION 9	// averaging stages of the Runge-Kutta schemes
+#define PHASE_CFL_TIME_STEP 10		// maximum spectral radii of an adaptive time step
+#define PHASE_VALIDITY 11			// validity diagnostics at the output steps
+#define PHASE_OBSERVABLES 12		// reductions and probes, over the ranks as well
+#define PHASE_DEVICE_TO_HOST 13		// field copies for the snapshots and checkpoints
+#define PHASE_OUTPUT 14				// snapshots (queued to the writer), checkpoints and time series
+#define NUMBER_PHASES 15
+
+// Clears the recorded durations
+void resetPhaseTimers();
+// Starts recording, synchronizing the device at the phase boundaries unless cpu
+void enablePhaseTimers(bool cpu);
+void disablePhaseTimers();
+
+void beginPhase(int phase);
+void endPhase(int phase);
+
+const char * getPhaseName(int phase);
+
+// Count, total and order statistics of the recorded durations of a phase in ms (all 0 if there are none)
+struct PhaseStatistics
+{
+	int count;
+	double total;
+	double mean;
+	double min, p50, p90, p99, max;
+};
+
+void getPhaseStatistics(int phase, struct PhaseStatistics *stats);
+
+// The run a report describes
+struct PhaseReport
+{
+	const char *host;			// name of the machine, throughputs of other machines are not comparable
+	int threads;				// OpenMP threads of the cpu backend, 0 on the gpu backend
+	const char *backend;
+	const char *precision;
+	const char *timeIntegrator;
+	const char *eulerStep;
+	int lattice[3];
+	int numEvents;
+	double cellsPerStep;		// physical cells advanced by a time step, all events of an ensemble together
+	double wallTime;			// ms from the start of the run to the report
+};
+
+/*
+ * Writes the statistics of every recorded phase as JSON, with its fraction of the evolution time, and the
+ * steps and cell updates per second of the time integrator. Returns -1 if the file cannot be written.
+ */
+int writePhaseReport(const char *fname, const struct PhaseReport * const report);
+
+#endif /* PHASETIMERS_H_ */
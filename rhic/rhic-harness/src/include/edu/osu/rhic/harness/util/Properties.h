@@ -8,9 +8,12 @@
 #ifndef PROPERTIES_H_
 #define PROPERTIES_H_
 
+#include <stddef.h>
 #include <libconfig.h>
 
 void getIntegerProperty(config_t *cfg, const char* propName, int *propValue, int defaultValue);
 void getDoubleProperty(config_t *cfg, const char* propName, double *propValue, double defaultValue);
+// copies at most length-1 characters, since the configuration owns the string it returns
+void getStringProperty(config_t *cfg, const char* propName, char *propValue, size_t length, const char *defaultValue);
 
 #endif /* PROPERTIES_H_ */
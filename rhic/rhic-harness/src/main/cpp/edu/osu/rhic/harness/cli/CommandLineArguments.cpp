@@ -5,7 +5,12 @@
  *      Author: bazow
  */
 
+#include <stdlib.h> // for atoi
+#include <string.h> // for strcmp
+
 #include "edu/osu/rhic/harness/cli/CommandLineArguments.h"
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+#include "edu/osu/rhic/trunk/hydro/KernelBenchmark.cuh"
 
 const char *argp_program_version;
 const char *argp_program_bug_address;
@@ -20,6 +25,20 @@ static struct argp_option options[] =
 		{"hydro",  'h', "RUN_HYDRO", OPTION_ARG_OPTIONAL, "Run hydrodynamic simulation"},
 		{"output",  'o', "OUTPUT_DIRECTORY", 0, "Path to output directory"},
 		{"config", 'c', "CONFIG_DIRECTORY", 0, "Path to configuration directory"},
+		{"backend", 'b', "BACKEND", 0, "Execution backend for the time evolution: gpu (default) or cpu"},
+		{"threads", 'n', "NUM_THREADS", 0, "Number of host threads used by the cpu backend"},
+		{"euler-step", 'e', "STRATEGY", 0, "Euler step implementation: fused, fused_1d, split or split_1d (default)"},
+		{"autotune", 'a', "STEPS", OPTION_ARG_OPTIONAL, "Time every Euler step implementation over STEPS steps (default 5) and use the fastest"},
+		{"step-benchmark", 'D', "STEPS", OPTION_ARG_OPTIONAL, "Time STEPS (default 20) Euler steps on the 3D lattice and specialized for a 1D or 2D lattice"},
+		{"convert", 'x', "SNAPSHOT", 0, "Convert a binary snapshot to per-field text files in the output directory"},
+		{"restart", 'r', "CHECKPOINT", 0, "Resume the hydrodynamic evolution from a checkpoint instead of the initial conditions"},
+		{"eos-benchmark", 'E', "CALLS", OPTION_ARG_OPTIONAL, "Report the error of the EoS table and time CALLS (default 10000000) parametrized and tabulated EoS calls"},
+		{"events", 'l', "EVENT_LIST", 0, "Evolve one event per line of EVENT_LIST, each line overriding ic.properties settings, into OUTPUT_DIRECTORY/event_<n>"},
+		{"compare", 'R', "REFERENCE_DIRECTORY", 0, "Report the deviation of the snapshots in OUTPUT_DIRECTORY from the same-named snapshots in REFERENCE_DIRECTORY"},
+		{"profile", 'P', 0, 0, "Time the phases of the evolution, synchronizing the GPU between them, and write OUTPUT_DIRECTORY/profile.json"},
+		{"kernel-benchmark", 'K', "REPEATS", OPTION_ARG_OPTIONAL, "Time the building blocks of the Euler step on the host over the evolved lattice, fastest of REPEATS (default 5), and write OUTPUT_DIRECTORY/microbenchmarks.json"},
+		{"regression", 'G', 0, 0, "Check the run in OUTPUT_DIRECTORY against the analytic solution, CONFIG_DIRECTORY/reference.csv and the throughput baseline, exiting with 1 if it regressed"},
+		{"record-baseline", 'B', 0, 0, "With --regression, write the throughput of OUTPUT_DIRECTORY/profile.json to CONFIG_DIRECTORY/baseline_BACKEND.json instead of checking it"},
 		{0}
 };
 
@@ -45,6 +64,63 @@ parse_opt(int key, char *arg, struct argp_state *state) {
 	case 'c':
 		cli->configDirectory = arg;
 		break;
+	case 'b':
+		if (strcmp(arg, "gpu") == 0)
+			cli->backend = GPU_BACKEND;
+		else if (strcmp(arg, "cpu") == 0)
+			cli->backend = CPU_BACKEND;
+		else
+			argp_error(state, "unknown backend '%s' (expected gpu or cpu)", arg);
+		break;
+	case 'n':
+		cli->numThreads = atoi(arg);
+		break;
+	case 'e':
+		cli->eulerStepStrategy = findEulerStepStrategy(arg);
+		if (cli->eulerStepStrategy < 0)
+			argp_error(state, "unknown Euler step '%s' (expected fused, fused_1d, split or split_1d)", arg);
+		break;
+	case 'a':
+		cli->autotuneSteps = arg ? atoi(arg) : DEFAULT_AUTOTUNE_STEPS;
+		if (cli->autotuneSteps <= 0)
+			argp_error(state, "number of autotuning steps must be positive");
+		break;
+	case 'D':
+		cli->stepBenchmarkSteps = arg ? atoi(arg) : DEFAULT_STEP_BENCHMARK_STEPS;
+		if (cli->stepBenchmarkSteps <= 0)
+			argp_error(state, "number of benchmark steps must be positive");
+		break;
+	case 'x':
+		cli->snapshotToConvert = arg;
+		break;
+	case 'r':
+		cli->restartFile = arg;
+		break;
+	case 'E':
+		cli->eosBenchmarkCalls = arg ? atoi(arg) : DEFAULT_EOS_BENCHMARK_CALLS;
+		if (cli->eosBenchmarkCalls <= 0)
+			argp_error(state, "number of EoS calls must be positive");
+		break;
+	case 'l':
+		cli->eventList = arg;
+		break;
+	case 'R':
+		cli->referenceDirectory = arg;
+		break;
+	case 'P':
+		cli->profile = true;
+		break;
+	case 'K':
+		cli->kernelBenchmarkRepeats = arg ? atoi(arg) : DEFAULT_KERNEL_BENCHMARK_REPEATS;
+		if (cli->kernelBenchmarkRepeats <= 0)
+			argp_error(state, "number of kernel benchmark repeats must be positive");
+		break;
+	case 'G':
+		cli->regression = true;
+		break;
+	case 'B':
+		cli->recordBaseline = true;
+		break;
 //	case ARGP_KEY_ARG:
 //		if (state->arg_num >= 2) {
 //			argp_usage(state);
@@ -96,6 +172,20 @@ error_t loadCommandLineArguments(int argc, char **argv, void * cli_params, const
 	cli->runHydro = false;
 	cli->outputDirectory = NULL;
 	cli->configDirectory = NULL;
+	cli->backend = GPU_BACKEND;
+	cli->numThreads = 0;
+	cli->eulerStepStrategy = DEFAULT_EULER_STEP_STRATEGY;
+	cli->autotuneSteps = 0;
+	cli->stepBenchmarkSteps = 0;
+	cli->snapshotToConvert = NULL;
+	cli->restartFile = NULL;
+	cli->eosBenchmarkCalls = 0;
+	cli->eventList = NULL;
+	cli->referenceDirectory = NULL;
+	cli->profile = false;
+	cli->kernelBenchmarkRepeats = 0;
+	cli->regression = false;
+	cli->recordBaseline = false;
 
   argp_parse (&argp, argc, argv, 0, 0, cli);
 
@@ -17,9 +17,14 @@
 
 #include "edu/osu/rhic/harness/cli/CommandLineArguments.h"
 #include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
 #include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
 #include "edu/osu/rhic/harness/hydro/HydroParameters.h"
+#include "edu/osu/rhic/harness/io/OutputParameters.h"
 #include "edu/osu/rhic/harness/hydro/HydroPlugin.h"
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+#include "edu/osu/rhic/harness/regression/Regression.h"
+#include "edu/osu/rhic/trunk/eos/EquationOfStateTable.cuh"
 
 const char *version = "";
 const char *address = "bazow.1{at}osu.edu";
@@ -29,8 +34,9 @@ int runTest(int argc, char **argv) {
 	return RUN_ALL_TESTS();
 }
 
-void runHydro(void * latticeParams, void * initCondParams, void * hydroParams, const char *rootDirectory, const char *outputDir) {
-	run(latticeParams, initCondParams, hydroParams, rootDirectory, outputDir);
+void runHydro(void * latticeParams, void * initCondParams, void * hydroParams, void * outputParams, void * cliParams,
+		const char *rootDirectory) {
+	run(latticeParams, initCondParams, hydroParams, outputParams, cliParams, rootDirectory);
 }
 
 int main(int argc, char **argv) {
@@ -39,7 +45,9 @@ int main(int argc, char **argv) {
 	struct LatticeParameters latticeParams;
 	struct InitialConditionParameters initCondParams;
 	struct HydroParameters hydroParams;
+	struct OutputParameters outputParams;
 
+	initializeDomainDecomposition(&argc, &argv);
 	loadCommandLineArguments(argc, argv, &cli, version, address);
 
 	char *rootDirectory = NULL;
@@ -57,11 +65,15 @@ int main(int argc, char **argv) {
 		printf("runTest = True\n");
 	else
 		printf("runTest = False\n");
+	if (cli.backend == CPU_BACKEND)
+		printf("backend = cpu\n");
+	else
+		printf("backend = gpu\n");
 
 	//=========================================
 	// Set parameters from configuration files
 	//=========================================
-	config_t latticeConfig, initCondConfig, hydroConfig;
+	config_t latticeConfig, initCondConfig, hydroConfig, outputConfig;
 
 	// Set lattice parameters from configuration file
 	config_init(&latticeConfig);
@@ -75,6 +87,10 @@ int main(int argc, char **argv) {
 	config_init(&hydroConfig);
 	loadHydroParameters(&hydroConfig, cli.configDirectory, &hydroParams);
 	config_destroy (&hydroConfig);
+	// Set output parameters from configuration file
+	config_init(&outputConfig);
+	loadOutputParameters(&outputConfig, cli.configDirectory, &outputParams);
+	config_destroy(&outputConfig);
 
 	//=========================================
 	// Run tests
@@ -84,16 +100,47 @@ int main(int argc, char **argv) {
 		printf("Done tests.\n");
 	}
 
+	//=========================================
+	// Convert a snapshot to text files
+	//=========================================
+	if (cli.snapshotToConvert != NULL) {
+		convertSnapshotToText(cli.snapshotToConvert, cli.outputDirectory != NULL ? cli.outputDirectory : ".");
+	}
+
+	//=========================================
+	// Benchmark the equation of state
+	//=========================================
+	if (cli.eosBenchmarkCalls > 0) {
+		benchmarkEquationOfState(cli.eosBenchmarkCalls, cli.backend == CPU_BACKEND);
+	}
+
 	//=========================================
 	// Run hydro
 	//=========================================
 	if (cli.runHydro) {
-		runHydro(&latticeParams, &initCondParams, &hydroParams, rootDirectory, cli.outputDirectory);
+		runHydro(&latticeParams, &initCondParams, &hydroParams, &outputParams, &cli, rootDirectory);
 		printf("Done hydro.\n");
 	}
 
+	//=========================================
+	// Compare the snapshots with a reference run
+	//=========================================
+	if (cli.referenceDirectory != NULL) {
+		compareSnapshotDirectories(cli.outputDirectory != NULL ? cli.outputDirectory : ".", cli.referenceDirectory);
+	}
+
+	//=========================================
+	// Check the run for accuracy and throughput regressions
+	//=========================================
+	int exitStatus = 0;
+	if (cli.regression) {
+		exitStatus = checkRegression(cli.outputDirectory != NULL ? cli.outputDirectory : ".", cli.configDirectory != NULL ? cli.configDirectory : ".",
+				&initCondParams, &hydroParams, cli.recordBaseline);
+	}
+
 	// TODO: Probably should free host memory here since the freezeout plugin will need
 	// to access the energy density, pressure, and fluid velocity.
 
-	return 0;
+	finalizeDomainDecomposition();
+	return exitStatus;
 }
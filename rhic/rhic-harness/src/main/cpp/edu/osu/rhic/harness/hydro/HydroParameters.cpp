@@ -11,8 +11,10 @@
 double initialProperTimePoint;
 double shearViscosityToEntropyDensity;
 double freezeoutTemperatureGeV;
+int freezeoutCriterion;
 int initializePimunuNavierStokes;
 int initializePiNavierStokes;
+int hydroPhysicsMode;
 
 void loadHydroParameters(config_t *cfg, const char* configDirectory, void * params) {
 	// Read the file
@@ -26,14 +28,18 @@ void loadHydroParameters(config_t *cfg, const char* configDirectory, void * para
 	getDoubleProperty(cfg, "initialProperTimePoint", &initialProperTimePoint, 0.1);
 	getDoubleProperty(cfg, "shearViscosityToEntropyDensity", &shearViscosityToEntropyDensity, 0.0795775);
 	getDoubleProperty(cfg, "freezeoutTemperatureGeV", &freezeoutTemperatureGeV, 0.155);
+	getIntegerProperty(cfg, "freezeoutCriterion", &freezeoutCriterion, FREEZEOUT_CENTER);
 
 	getIntegerProperty(cfg, "initializePimunuNavierStokes", &initializePimunuNavierStokes, 1);
 	getIntegerProperty(cfg, "initializePiNavierStokes", &initializePiNavierStokes, 1);
+	getIntegerProperty(cfg, "physicsMode", &hydroPhysicsMode, IDEAL_HYDRO);
 
 	struct HydroParameters * hydro = (struct HydroParameters *) params;
 	hydro->initialProperTimePoint = initialProperTimePoint;
 	hydro->shearViscosityToEntropyDensity = shearViscosityToEntropyDensity;
 	hydro->freezeoutTemperatureGeV = freezeoutTemperatureGeV;
+	hydro->freezeoutCriterion = freezeoutCriterion;
 	hydro->initializePimunuNavierStokes = initializePimunuNavierStokes;
 	hydro->initializePiNavierStokes = initializePiNavierStokes;
+	hydro->physicsMode = hydroPhysicsMode;
 }
@@ -7,102 +7,429 @@
 
 #include <stdlib.h>
 #include <stdio.h> // for printf
+#include <string.h>
 #include <cmath>
 
-// for timing
-#include <ctime>
 #include <iostream>
+#include <errno.h>
+#include <sys/stat.h> // for mkdir
+#include <unistd.h> // for gethostname
+
+#include <omp.h>
 
 #include <cuda.h>
 #include <cuda_runtime.h>
 
 #include "edu/osu/rhic/harness/hydro/HydroPlugin.h"
+#include "edu/osu/rhic/harness/cli/CommandLineArguments.h"
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 #include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+#include "edu/osu/rhic/harness/lattice/Ensemble.h"
 #include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
 #include "edu/osu/rhic/harness/hydro/HydroParameters.h"
 #include "edu/osu/rhic/harness/io/FileIO.h"
+#include "edu/osu/rhic/harness/io/OutputParameters.h"
+#include "edu/osu/rhic/harness/io/OutputWriter.h"
+#include "edu/osu/rhic/harness/io/Checkpoint.h"
+#include "edu/osu/rhic/harness/io/TimeSeries.h"
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
 #include "edu/osu/rhic/trunk/ic/InitialConditions.h"
+#include "edu/osu/rhic/core/ic/MonteCarloGlauberModel.h"
 #include "edu/osu/rhic/trunk/hydro/FullyDiscreteKurganovTadmorScheme.cuh"
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+#include "edu/osu/rhic/trunk/hydro/TimeIntegrator.cuh"
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfStateTable.cuh"
 #include "edu/osu/rhic/trunk/hydro/GhostCells.cuh"
 #include "edu/osu/rhic/trunk/hydro/HydrodynamicValidity.cuh"
+#include "edu/osu/rhic/trunk/hydro/TimeStep.cuh"
+#include "edu/osu/rhic/trunk/hydro/Observables.cuh"
+#include "edu/osu/rhic/trunk/hydro/HaloExchange.cuh"
+#include "edu/osu/rhic/trunk/hydro/KernelBenchmark.cuh"
 
-#define FREQ 10
-
-void outputDynamicalQuantities(double t, const char *outputDir, void * latticeParams) {
-	output(e, t, outputDir, "e", latticeParams);
-//	/*
-	output(p, t, outputDir, "p", latticeParams);
-	output(u->ux, t, outputDir, "ux", latticeParams);	
-	output(u->uy, t, outputDir, "uy", latticeParams);	
-	output(u->un, t, outputDir, "un", latticeParams);
-	output(u->ut, t, outputDir, "ut", latticeParams);
-	output(q->ttt, t, outputDir, "ttt", latticeParams);	
-	output(q->ttn, t, outputDir, "ttn", latticeParams);
-#ifdef PIMUNU	
-///*
-	output(q->pixx, t, outputDir, "pixx", latticeParams);	
-	output(q->pixy, t, outputDir, "pixy", latticeParams);	
-	output(q->pixn, t, outputDir, "pixn", latticeParams);	
-	output(q->piyy, t, outputDir, "piyy", latticeParams);	
-	output(q->piyn, t, outputDir, "piyn", latticeParams);	
-
-	output(q->pitt, t, outputDir, "pitt", latticeParams);	
-	output(q->pitx, t, outputDir, "pitx", latticeParams);	
-	output(q->pity, t, outputDir, "pity", latticeParams);	
-	output(q->pitn, t, outputDir, "pitn", latticeParams);
-	output(q->pinn, t, outputDir, "pinn", latticeParams);	
-#endif
-#ifdef PI
-	output(q->Pi, t, outputDir, "Pi", latticeParams);	
-#endif
-///*
-	output(validityDomain->regulations, t, outputDir, "regulations", latticeParams);
-	output(validityDomain->inverseReynoldsNumberPimunu, t, outputDir, "Rpi", latticeParams);
-	output(validityDomain->inverseReynoldsNumberTilde2Pimunu, t, outputDir, "R2pi", latticeParams);
-	output(validityDomain->inverseReynoldsNumberPi, t, outputDir, "RPi", latticeParams);
-	output(validityDomain->inverseReynoldsNumberTilde2Pi, t, outputDir, "R2Pi", latticeParams);
-	output(validityDomain->knudsenNumberTaupi, t, outputDir, "KnTaupi", latticeParams);
-	output(validityDomain->knudsenNumberTauPi, t, outputDir, "KnTauPi", latticeParams);
+// Host array written under the given name, or NULL if it is not evolved in this physics mode.
+// Looked up at every output step since the conserved variables are swapped after each step.
+const PRECISION * getOutputField(const char *name) {
+	if (strcmp(name, "e") == 0) return e;
+	if (strcmp(name, "p") == 0) return p;
+	if (strcmp(name, "ux") == 0) return u->ux;
+	if (strcmp(name, "uy") == 0) return u->uy;
+	if (strcmp(name, "un") == 0) return u->un;
+	if (strcmp(name, "ut") == 0) return u->ut;
+	if (strcmp(name, "ttt") == 0) return q->ttt;
+	if (strcmp(name, "ttx") == 0) return q->ttx;
+	if (strcmp(name, "tty") == 0) return q->tty;
+	if (strcmp(name, "ttn") == 0) return q->ttn;
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		if (strcmp(name, "pitt") == 0) return q->pitt;
+		if (strcmp(name, "pitx") == 0) return q->pitx;
+		if (strcmp(name, "pity") == 0) return q->pity;
+		if (strcmp(name, "pitn") == 0) return q->pitn;
+		if (strcmp(name, "pixx") == 0) return q->pixx;
+		if (strcmp(name, "pixy") == 0) return q->pixy;
+		if (strcmp(name, "pixn") == 0) return q->pixn;
+		if (strcmp(name, "piyy") == 0) return q->piyy;
+		if (strcmp(name, "piyn") == 0) return q->piyn;
+		if (strcmp(name, "pinn") == 0) return q->pinn;
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		if (strcmp(name, "Pi") == 0) return q->Pi;
+	}
+	if (strcmp(name, "regulations") == 0) return validityDomain->regulations;
+	if (strcmp(name, "Rpi") == 0) return validityDomain->inverseReynoldsNumberPimunu;
+	if (strcmp(name, "R2pi") == 0) return validityDomain->inverseReynoldsNumberTilde2Pimunu;
+	if (strcmp(name, "RPi") == 0) return validityDomain->inverseReynoldsNumberPi;
+	if (strcmp(name, "R2Pi") == 0) return validityDomain->inverseReynoldsNumberTilde2Pi;
+	if (strcmp(name, "KnTaupi") == 0) return validityDomain->knudsenNumberTaupi;
+	if (strcmp(name, "KnTauPi") == 0) return validityDomain->knudsenNumberTauPi;
 	// for debugging purposes
-	output(validityDomain->taupi, t, outputDir, "taupi", latticeParams);
-	output(validityDomain->dxux, t, outputDir, "dxux", latticeParams);
-	output(validityDomain->dyuy, t, outputDir, "dyuy", latticeParams);
-	output(validityDomain->theta, t, outputDir, "theta", latticeParams);
-//*/
+	if (strcmp(name, "taupi") == 0) return validityDomain->taupi;
+	if (strcmp(name, "dxux") == 0) return validityDomain->dxux;
+	if (strcmp(name, "dyuy") == 0) return validityDomain->dyuy;
+	if (strcmp(name, "theta") == 0) return validityDomain->theta;
+	return NULL;
+}
+
+static const char * const validityFields[] = {
+	"regulations", "Rpi", "R2pi", "RPi", "R2Pi", "KnTaupi", "KnTauPi", "taupi", "dxux", "dyuy", "theta"
+};
+
+// Whether any of the requested fields is one of the validity domain, which is otherwise neither allocated nor computed
+bool writesValidityFields(const struct OutputParameters * output) {
+	for (int n = 0; n < output->numOutputFields; ++n)
+		for (int m = 0; m < (int) (sizeof(validityFields) / sizeof(validityFields[0])); ++m)
+			if (strcmp(output->outputFields[n], validityFields[m]) == 0) return true;
+	return false;
+}
+
+// Drops the requested fields that are not available, so that the output steps need not check them
+void selectOutputFields(struct OutputParameters * output) {
+	int numFields = 0;
+	for (int n = 0; n < output->numOutputFields; ++n) {
+		if (getOutputField(output->outputFields[n]) == NULL) {
+			fprintf(stderr, "Output field %s is not available in this physics mode, skipped.\n", output->outputFields[n]);
+			continue;
+		}
+		if (numFields != n) strcpy(output->outputFields[numFields], output->outputFields[n]);
+		++numFields;
+	}
+	output->numOutputFields = numFields;
+}
+
+// Every outputFrequency steps, or the step closest to each multiple of outputTimeInterval
+bool isOutputStep(int n, double t, double dt, const struct OutputParameters * output, double *nextOutputTime) {
+	if (output->outputTimeInterval <= 0) return ((n-1) % output->outputFrequency == 0);
+	if (t < *nextOutputTime - 0.5*dt) return false;
+	while (*nextOutputTime < t + 0.5*dt) *nextOutputTime += output->outputTimeInterval;
+	return true;
+}
+
+// Every checkpointFrequency steps, except for the step the run started from
+bool isCheckpointStep(int n, int firstStep, const struct OutputParameters * output) {
+	if (output->checkpointFrequency <= 0 || n-1 == firstStep) return false;
+	return ((n-1) % output->checkpointFrequency == 0);
+}
+
+// Stages the output fields for the writer thread; blocks while the previous snapshots are still being written.
+// offset is the first column of the event in an ensemble.
+void outputDynamicalQuantities(double t, struct OutputWriter *writer, const struct OutputParameters * output, int offset) {
+	if (output->numOutputFields == 0) return;
+	struct OutputBuffer *snapshot = acquireOutputBuffer(writer, t);
+	for (int n = 0; n < output->numOutputFields; ++n)
+		addOutputField(writer, snapshot, output->outputFields[n], getOutputField(output->outputFields[n]) + offset);
+	submitOutputBuffer(writer, snapshot);
+}
+
+// Linear index in the slab of the cell of event m nearest to (x, y, eta), -1 if it is not in the slab of this rank
+static int probeCellIndex(const double * const position, int m, void * latticeParams, void * slabParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	struct LatticeParameters * slab = (struct LatticeParameters *) slabParams;
+	int i = (int) lround(position[0]/lattice->latticeSpacingX + (lattice->numLatticePointsX-1)/2.);
+	int j = (int) lround(position[1]/lattice->latticeSpacingY + (lattice->numLatticePointsY-1)/2.);
+	int k = (int) lround(position[2]/lattice->latticeSpacingRapidity + (lattice->numLatticePointsRapidity-1)/2.) - domain.firstRapidityPoint;
+	if (i < 0 || i >= lattice->numLatticePointsX || j < 0 || j >= lattice->numLatticePointsY || k < 0 || k >= slab->numLatticePointsRapidity)
+		return -1;
+	return columnMajorLinearIndex(i + N_GHOST_CELLS_M + m * lattice->numComputationalLatticePointsX, j + N_GHOST_CELLS_M, k + N_GHOST_CELLS_M,
+			slab->numComputationalLatticePointsX, slab->numComputationalLatticePointsY);
+}
+
+// Combines the observables of the slabs, a probe cell being read on one rank and 0 on the others
+static void reduceObservablesOverRanks(struct FluidReductions * const reductions, int numEvents, double * const probeValues, int numProbeValues) {
+	if (domain.numRanks == 1) return;
+	double *maxima = (double *) malloc(numEvents * sizeof(double));
+	double *minima = (double *) malloc(numEvents * sizeof(double));
+	double *sums = (double *) malloc((4 * numEvents + numProbeValues) * sizeof(double));
+	for (int m = 0; m < numEvents; ++m) {
+		maxima[m] = reductions[m].eMax;
+		minima[m] = reductions[m].eMin;
+		sums[4*m] = reductions[m].eSum;
+		sums[4*m+1] = reductions[m].TSum;
+		sums[4*m+2] = reductions[m].tttSum;
+		sums[4*m+3] = reductions[m].entropySum;
+	}
+	memcpy(sums + 4 * numEvents, probeValues, numProbeValues * sizeof(double));
+	maximumOverRanks(maxima, numEvents);
+	minimumOverRanks(minima, numEvents);
+	sumOverRanks(sums, 4 * numEvents + numProbeValues);
+	for (int m = 0; m < numEvents; ++m) {
+		reductions[m].eMax = maxima[m];
+		reductions[m].eMin = minima[m];
+		reductions[m].eSum = sums[4*m];
+		reductions[m].TSum = sums[4*m+1];
+		reductions[m].tttSum = sums[4*m+2];
+		reductions[m].entropySum = sums[4*m+3];
+	}
+	memcpy(probeValues, sums + 4 * numEvents, numProbeValues * sizeof(double));
+	free(maxima);
+	free(minima);
+	free(sums);
+}
+
+#define NUM_OBSERVABLE_COLUMNS 10
+static const char * const observableColumns[NUM_OBSERVABLE_COLUMNS] = {
+	"n", "t", "e_max", "e_min", "e_mean", "T_max", "T_min", "T_mean", "energy", "entropy"
+};
+static const char * const probeColumns[PROBE_FIELDS + 1] = { "e", "p", "T", "ux", "uy", "un" };
+
+// Opens <outputDir>/observables.csv or .bin with the columns of the reductions followed by those of the probes
+static int openObservables(struct TimeSeries *series, const char *outputDir, const struct OutputParameters * output, bool append) {
+	int numColumns = NUM_OBSERVABLE_COLUMNS + (PROBE_FIELDS + 1) * output->numProbes;
+	char (*probeNames)[TIME_SERIES_NAME_LENGTH] = (char (*)[TIME_SERIES_NAME_LENGTH]) malloc((numColumns - NUM_OBSERVABLE_COLUMNS) * TIME_SERIES_NAME_LENGTH);
+	const char **names = (const char **) malloc(numColumns * sizeof(const char *));
+	for (int c = 0; c < NUM_OBSERVABLE_COLUMNS; ++c) names[c] = observableColumns[c];
+	for (int n = 0; n < output->numProbes; ++n) {
+		for (int f = 0; f < PROBE_FIELDS + 1; ++f) {
+			int c = (PROBE_FIELDS + 1) * n + f;
+			snprintf(probeNames[c], TIME_SERIES_NAME_LENGTH, "%s_%s", output->probeNames[n], probeColumns[f]);
+			names[NUM_OBSERVABLE_COLUMNS + c] = probeNames[c];
+		}
+	}
+	char fname[255];
+	sprintf(fname, "%s/observables.%s", outputDir, output->observablesFormat == TIME_SERIES_CSV ? "csv" : "bin");
+	int status = openTimeSeries(series, fname, output->observablesFormat, numColumns, names, append);
+	free(probeNames);
+	free(names);
+	return status;
+}
+
+/*
+ * Writes the row of step n in GeV/fm^3 (e), GeV (T and the energy) and the units of the lattice, the sums being
+ * integrated over tau dx dy deta, or per unit rapidity on a lattice of a single rapidity point
+ */
+static void writeObservables(struct TimeSeries *series, int n, double t, const struct FluidReductions * r, const double * const probeValues,
+		int numProbes, void * latticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	const double hbarc = 0.197326938;
+	int nz = lattice->numLatticePointsRapidity;
+	double numCells = (double) lattice->numLatticePointsX * lattice->numLatticePointsY * nz;
+	double volume = t * lattice->latticeSpacingX * lattice->latticeSpacingY * (nz > 1 ? lattice->latticeSpacingRapidity : 1);
+
+	double *row = (double *) malloc((NUM_OBSERVABLE_COLUMNS + (PROBE_FIELDS + 1) * numProbes) * sizeof(double));
+	row[0] = n;
+	row[1] = t;
+	row[2] = r->eMax * hbarc;
+	row[3] = r->eMin * hbarc;
+	row[4] = r->eSum / numCells * hbarc;
+	row[5] = effectiveTemperature((PRECISION) r->eMax) * hbarc;
+	row[6] = effectiveTemperature((PRECISION) r->eMin) * hbarc;
+	row[7] = r->TSum / numCells * hbarc;
+	row[8] = r->tttSum * volume * hbarc;
+	row[9] = r->entropySum * volume;
+	for (int c = 0; c < numProbes; ++c) {
+		const double *values = probeValues + PROBE_FIELDS * c;
+		double *columns = row + NUM_OBSERVABLE_COLUMNS + (PROBE_FIELDS + 1) * c;
+		columns[0] = values[0] * hbarc;
+		columns[1] = values[1] * hbarc;
+		columns[2] = effectiveTemperature((PRECISION) values[0]) * hbarc;
+		columns[3] = values[2];
+		columns[4] = values[3];
+		columns[5] = values[4];
+	}
+	writeTimeSeriesRow(series, row);
+	free(row);
+}
+
+// Energy density solves since the last call, also added to total; the counters are reset
+struct InferredVariablesStatistics collectInferredVariablesStatistics(struct InferredVariablesStatistics * total, bool cpu) {
+	struct InferredVariablesStatistics stats;
+	getInferredVariablesStatistics(&stats, cpu);
+	resetInferredVariablesStatistics(cpu);
+	// summed over the slabs of all ranks
+	unsigned long long counts[4] = { stats.cells, stats.iterations, stats.bisected, stats.notConverged };
+	double maxIterations = stats.maxIterations;
+	sumOverRanks(counts, 4);
+	maximumOverRanks(&maxIterations, 1);
+	stats.cells = counts[0];
+	stats.iterations = counts[1];
+	stats.bisected = counts[2];
+	stats.notConverged = counts[3];
+	stats.maxIterations = (unsigned int) maxIterations;
+	total->cells += stats.cells;
+	total->iterations += stats.iterations;
+	total->bisected += stats.bisected;
+	total->notConverged += stats.notConverged;
+	if (stats.maxIterations > total->maxIterations) total->maxIterations = stats.maxIterations;
+	return stats;
+}
+
+void printInferredVariablesStatistics(const struct InferredVariablesStatistics * stats) {
+	printf("%.2f iterations/cell, max %u, %llu bisected, %llu not converged",
+		stats->cells > 0 ? stats->iterations/(double)stats->cells : 0., stats->maxIterations, stats->bisected, stats->notConverged);
 }
 
-#define CLOCKS_PER_MILLISEC (CLOCKS_PER_SEC / 1000)
+#define MAX_INITIAL_CONDITION_ARRAYS 21
+
+// Host arrays set by the initial conditions
+static int getInitialConditionArrays(PRECISION **arrays, const CONSERVED_VARIABLES *q, const PRECISION *e, const PRECISION *p,
+		const FLUID_VELOCITY *u) {
+	int n = 0;
+	arrays[n++] = (PRECISION *) e;
+	arrays[n++] = (PRECISION *) p;
+	arrays[n++] = u->ut;
+	arrays[n++] = u->ux;
+	arrays[n++] = u->uy;
+	arrays[n++] = u->un;
+	arrays[n++] = q->ttt;
+	arrays[n++] = q->ttx;
+	arrays[n++] = q->tty;
+	arrays[n++] = q->ttn;
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		arrays[n++] = q->pitt;
+		arrays[n++] = q->pitx;
+		arrays[n++] = q->pity;
+		arrays[n++] = q->pitn;
+		arrays[n++] = q->pixx;
+		arrays[n++] = q->pixy;
+		arrays[n++] = q->pixn;
+		arrays[n++] = q->piyy;
+		arrays[n++] = q->piyn;
+		arrays[n++] = q->pinn;
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		arrays[n++] = q->Pi;
+	}
+	return n;
+}
+
+/*
+ * Sets the initial conditions of the numEvents events on the host arrays of the packed lattice. In an ensemble
+ * every event is set on a lattice of its own and copied into its columns; the slots after the last event repeat it.
+ */
+void setEnsembleInitialConditions(double t, void * latticeParams, void * packedParams, struct InitialConditionParameters * events,
+		int numEvents, void * hydroParams, const char *rootDirectory) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	struct LatticeParameters * packed = (struct LatticeParameters *) packedParams;
+	if (packed->ensembleSize == 1) {
+		setInitialConditions(latticeParams, events, hydroParams, rootDirectory);
+		setConservedVariables(t, latticeParams);
+		return;
+	}
+	int len = lattice->numComputationalLatticePointsX * lattice->numComputationalLatticePointsY
+			* lattice->numComputationalLatticePointsRapidity;
+	CONSERVED_VARIABLES *packedQ = q;
+	FLUID_VELOCITY *packedU = u;
+	PRECISION *packedE = e, *packedP = p;
+	PRECISION *eventArrays[MAX_INITIAL_CONDITION_ARRAYS], *packedArrays[MAX_INITIAL_CONDITION_ARRAYS];
+	getInitialConditionArrays(packedArrays, packedQ, packedE, packedP, packedU);
+	for (int n = 0; n < packed->ensembleSize; ++n) {
+		q = allocateIntermidateConservedVarHostMemory(len);
+		u = allocateIntermidateFluidVelocityHostMemory(len);
+		e = (PRECISION *) calloc(len, sizeof(PRECISION));
+		p = (PRECISION *) calloc(len, sizeof(PRECISION));
+		setInitialConditions(latticeParams, &events[n < numEvents ? n : numEvents - 1], hydroParams, rootDirectory);
+		setConservedVariables(t, latticeParams);
+		int numArrays = getInitialConditionArrays(eventArrays, q, e, p, u);
+		for (int m = 0; m < numArrays; ++m) packEventRows(packedArrays[m], eventArrays[m], n, packedParams);
+		freeIntermidateConservedVarHostMemory(q);
+		freeIntermidateFluidVelocityHostMemory(u);
+		free(e);
+		free(p);
+	}
+	q = packedQ;
+	u = packedU;
+	e = packedE;
+	p = packedP;
+}
+
+// The root rank sets the initial conditions on the whole lattice and sends every rank its slab
+void setInitialConditionsOnSlabs(double t, void * latticeParams, void * packedParams, struct InitialConditionParameters * events,
+		int numEvents, void * hydroParams, const char *rootDirectory) {
+	struct LatticeParameters * packed = (struct LatticeParameters *) packedParams;
+	CONSERVED_VARIABLES *wholeQ = NULL;
+	FLUID_VELOCITY *wholeU = NULL;
+	PRECISION *wholeE = NULL, *wholeP = NULL;
+	if (isRootRank()) {
+		int len = packed->numComputationalLatticePointsX * packed->numComputationalLatticePointsY
+				* packed->numComputationalLatticePointsRapidity;
+		// the host arrays of the slab are set aside meanwhile
+		CONSERVED_VARIABLES *slabQ = q;
+		FLUID_VELOCITY *slabU = u;
+		PRECISION *slabE = e, *slabP = p;
+		q = allocateIntermidateConservedVarHostMemory(len);
+		u = allocateIntermidateFluidVelocityHostMemory(len);
+		e = (PRECISION *) calloc(len, sizeof(PRECISION));
+		p = (PRECISION *) calloc(len, sizeof(PRECISION));
+		setEnsembleInitialConditions(t, latticeParams, packedParams, events, numEvents, hydroParams, rootDirectory);
+		wholeQ = q;
+		wholeU = u;
+		wholeE = e;
+		wholeP = p;
+		q = slabQ;
+		u = slabU;
+		e = slabE;
+		p = slabP;
+	}
+	scatterHostVariables(packedParams, wholeQ, wholeE, wholeP, wholeU);
+	if (isRootRank()) {
+		freeIntermidateConservedVarHostMemory(wholeQ);
+		freeIntermidateFluidVelocityHostMemory(wholeU);
+		free(wholeE);
+		free(wholeP);
+	}
+}
+
+// Wall-clock time; clock() sums the CPU time of all threads and overstates multithreaded steps
 class Stopwatch {
 private:
-	time_t start, end;
+	double start, end;
 public:
 	Stopwatch() {
-		start = clock();
+		start = monotonicTime();
 		end = 0;
 	}
 	void tic() {
-		start = clock();
+		start = monotonicTime();
 	}
 	void toc() {
-		end = clock();
+		end = monotonicTime();
 	}
 	double elapsedTime() {
-		return ((double) (end - start)) / CLOCKS_PER_MILLISEC;
+		return end - start;
 	}
 };
 
-void run(void * latticeParams, void * initCondParams, void * hydroParams, const char *rootDirectory, const char *outputDir) {
+/*
+ * Sets the initial conditions of the numEvents events, or those of the restart checkpoint, on the allocated lattice
+ * and evolves them, writing event n to outputDirs[n]. With an ensemble the events are packed side by side on the
+ * lattice of packedParams (see Ensemble.h). The following ensembles of a batch reuse the memory, constant parameters
+ * and Euler step of the first.
+ */
+template <int MODE>
+void evolveEnsemble(void * latticeParams, void * packedParams, void * slabParams, struct InitialConditionParameters * events,
+		int numEvents, void * hydroParams, void * outputParams, void * cliParams, const char *rootDirectory,
+		const char * const *outputDirs, const TIME_INTEGRATOR * integrator, bool firstEvent) {
 	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
-	struct InitialConditionParameters * initCond = (struct InitialConditionParameters *) initCondParams;
+	struct LatticeParameters * slab = (struct LatticeParameters *) slabParams;
 	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
+	struct OutputParameters * output = (struct OutputParameters *) outputParams;
+	struct CommandLineArguments * cli = (struct CommandLineArguments *) cliParams;
+
+	bool cpu = (cli->backend == CPU_BACKEND);
 
-	/************************************************************************************\
-	 * System configuration (C/CUDA)
-	/************************************************************************************/
 	int nt = lattice->numProperTimePoints;
 	int nx = lattice->numLatticePointsX;
 	int ny = lattice->numLatticePointsY;
@@ -110,91 +437,539 @@ void run(void * latticeParams, void * initCondParams, void * hydroParams, const
 	int ncx = lattice->numComputationalLatticePointsX;
 	int ncy = lattice->numComputationalLatticePointsY;
 	int ncz = lattice->numComputationalLatticePointsRapidity;
-	int nElements = ncx * ncy * ncz;
+	int nElements = slab->numComputationalLatticePointsX * ncy * slab->numComputationalLatticePointsRapidity;
+	size_t bytes = nElements * sizeof(PRECISION);
 
 	double t0 = hydro->initialProperTimePoint;
 	double dt = lattice->latticeSpacingProperTime;
 
-	double e0 = initCond->initialEnergyDensity;
-
-	double freezeoutTemperatureGeV = hydro->freezeoutTemperatureGeV;
 	const double hbarc = 0.197326938;
-	const double freezeoutTemperature = freezeoutTemperatureGeV/hbarc;
-//	const double freezeoutEnergyDensity = e0*pow(freezeoutTemperature,4);
-	const double freezeoutEnergyDensity = equilibriumEnergyDensity(freezeoutTemperature);
-	printf("Grid size = %d x %d x %d\n", nx, ny, nz);
-	printf("spatial resolution = (%.3f, %.3f, %.3f)\n", lattice->latticeSpacingX, lattice->latticeSpacingY, lattice->latticeSpacingRapidity);
-	printf("freezeout temperature = %.3f [fm^-1] (eF = %.3f [fm^-4])\n", freezeoutTemperature, freezeoutEnergyDensity);
-
-	printf("eta/s = %.6f\n", hydro->shearViscosityToEntropyDensity);
-
-	// Initialize CUDA kernel parameters
-	initializeCUDALaunchParameters(latticeParams);
-	initializeCUDAConstantParameters(latticeParams, initCondParams, hydroParams);
-
-	// Allocate host and device memory
-	size_t bytes = nElements * sizeof(PRECISION);
-	allocateHostMemory(nElements);
-	allocateDeviceMemory(bytes);
+	const double freezeoutEnergyDensity = equilibriumEnergyDensity(hydro->freezeoutTemperatureGeV/hbarc);
 
 	/************************************************************************************\
 	 * Fluid dynamic initialization 
 	/************************************************************************************/
 	double t = t0;
-	// generate initial conditions 
-	setInitialConditions(latticeParams, initCondParams, hydroParams, rootDirectory);
-	// Calculate conserved quantities
-	setConservedVariables(t, latticeParams);
-	// copy conserved/inferred variables to GPU memory
-	copyHostToDeviceMemory(bytes);
-	// impose boundary conditions with ghost cells
-	setGhostCells(d_q,d_e,d_p,d_u);
-//#ifndef IDEAL
-	checkValidity(t, d_validityDomain, d_q, d_e, d_p, d_u, d_up);
-//#endif
+	// number of time steps taken before this run
+	int firstStep = 0;
+	if (!firstEvent) {
+		clearHostMemory(nElements);
+		// an adaptive time step of the previous event may still be set
+		setTimeStep((PRECISION) dt, cpu);
+		setPreviousTimeStep((PRECISION) dt, cpu);
+	}
+	if (cli->restartFile != NULL) {
+		// the checkpoint holds the ghost cells and the previous fluid velocity as well
+		if (cpu) allocateIntermediateHostMemory(nElements);
+		// every rank of a domain decomposition resumes its own slab
+		char restartFile[255];
+		if (domain.numRanks > 1) sprintf(restartFile, "%s.%d", cli->restartFile, domain.rank);
+		else sprintf(restartFile, "%s", cli->restartFile);
+		// a restart continues with the Euler step the checkpoint was written with, which it records
+		eulerStepStrategy = cli->eulerStepStrategy;
+		double dtp;
+		if (readCheckpoint(restartFile, &firstStep, &t, &dtp, slabParams, q, e, p, u, h_up) != 0) exit(-1);
+		if (!lattice->adaptiveTimeStep && t != t0 + firstStep * dt) {
+			fprintf(stderr, "%s was written with a different initial proper time. Exiting ...\n", cli->restartFile);
+			exit(-1);
+		}
+		printf("Restarting from %s at n = %d (t = %.3f)\n", cli->restartFile, firstStep, t);
+		setPreviousTimeStep((PRECISION) dtp, cpu);
+		if (!cpu) {
+			copyHostToDeviceMemory(bytes);
+			copyPreviousFluidVelocityHostToDevice(bytes);
+		}
+	}
+	else {
+		if (domain.numRanks > 1) {
+			setInitialConditionsOnSlabs(t, latticeParams, packedParams, events, numEvents, hydroParams, rootDirectory);
+		}
+		else {
+			// generate initial conditions and calculate conserved quantities
+			setEnsembleInitialConditions(t, latticeParams, packedParams, events, numEvents, hydroParams, rootDirectory);
+		}
+		if (cpu) {
+			if (firstEvent) allocateIntermediateHostMemory(nElements);
+			else resetIntermediateHostMemory(nElements);
+			setGhostCellsHost<MODE>(q,e,p,u);
+			exchangeHalos<MODE>(q,e,p,u,true);
+		}
+		else {
+			// copy conserved/inferred variables to GPU memory
+			copyHostToDeviceMemory(bytes);
+			// impose boundary conditions with ghost cells
+			setGhostCells<MODE>(d_q,d_e,d_p,d_u);
+			exchangeHalos<MODE>(d_q,d_e,d_p,d_u,false);
+		}
+	}
+	// choose the Euler step implementation, once for a batch of events
+	if (firstEvent) {
+		eulerStepStrategy = cli->eulerStepStrategy;
+		if (cli->autotuneSteps > 0 && cli->restartFile != NULL)
+			printf("--autotune is ignored with --restart, which keeps the Euler step of the checkpoint (--euler-step).\n");
+		else if (cli->autotuneSteps > 0) eulerStepStrategy = autotuneEulerStep<MODE>(t, cli->autotuneSteps, cpu);
+		if (cli->stepBenchmarkSteps > 0) benchmarkLatticeDimensions<MODE>(t, cli->stepBenchmarkSteps, cpu);
+	}
+	printf("Euler step = %s\n", getEulerStepStrategy<MODE>(eulerStepStrategy)->name);
+	printf("Time integrator = %s\n", integrator->name);
 	/************************************************************************************\
 	 * Evolve the system in time
 	/************************************************************************************/
 	int ictr = (nx % 2 == 0) ? ncx/2 : (ncx-1)/2;
 	int jctr = (ny % 2 == 0) ? ncy/2 : (ncy-1)/2;
 	int kctr = (nz % 2 == 0) ? ncz/2 : (ncz-1)/2;	
-	int sctr = columnMajorLinearIndex(ictr, jctr, kctr, ncx, ncy);
+	// the centre cell is in the slab of one rank, which shares its values at the output steps
+	int centerRank = getRapiditySlabRank(nz, domain.numRanks, kctr - N_GHOST_CELLS_M);
+	int sctr = columnMajorLinearIndex(ictr, jctr, kctr - domain.firstRapidityPoint, slab->numComputationalLatticePointsX, ncy);
+
+	selectOutputFields(output);
+	struct SnapshotRegion region;
+	setSnapshotRegion(&region, latticeParams, output->outputRegion, output->outputStride);
+	// every event has a writer of its own, reading its columns of the packed fields
+	struct OutputWriter *writers = (struct OutputWriter *) malloc(numEvents * sizeof(struct OutputWriter));
+	for (int m = 0; m < numEvents; ++m) {
+		if (startOutputWriter(&writers[m], outputDirs[m], latticeParams, &region) != 0) exit(-1);
+		writers[m].ncx = slab->numComputationalLatticePointsX;
+	}
+	double nextOutputTime = t0;
+	if (output->outputTimeInterval > 0)
+		while (nextOutputTime < t - 0.5*dt) nextOutputTime += output->outputTimeInterval;
 
 	Stopwatch sw;
 	double totalTime = 0;
 	int nsteps = 0;
+	// the autotuner and initialization solves are not counted
+	struct InferredVariablesStatistics solverStatistics;
+	memset(&solverStatistics, 0, sizeof(solverStatistics));
+	resetInferredVariablesStatistics(cpu);
+
+	// an adaptive run ends at a fixed proper time instead of after a fixed number of steps
+	bool adaptive = lattice->adaptiveTimeStep != 0;
+	double tEnd = t0 + nt * lattice->latticeSpacingProperTime;
+	double minTimeStep = dt, maxTimeStep = dt;
+	FILE **timeStepHistory = (FILE **) calloc(numEvents, sizeof(FILE *));
+	if (adaptive) {
+		printf("adaptive time step: CFL = %.3f, %.4f <= dt <= %.4f [fm], t <= %.3f [fm]\n", lattice->cflNumber,
+			lattice->minLatticeSpacingProperTime, lattice->maxLatticeSpacingProperTime, tEnd);
+		for (int m = 0; m < numEvents && isRootRank(); ++m) {
+			char fname[255];
+			sprintf(fname, "%s/timeStep.dat", outputDirs[m]);
+			timeStepHistory[m] = fopen(fname, cli->restartFile != NULL ? "a" : "w");
+			if (timeStepHistory[m] == NULL) fprintf(stderr, "Could not open %s, the time steps are not recorded.\n", fname);
+		}
+		minTimeStep = lattice->maxLatticeSpacingProperTime;
+		maxTimeStep = lattice->minLatticeSpacingProperTime;
+	}
+	// centre (e, p) of every event
+	double *center = (double *) malloc(2 * numEvents * sizeof(double));
+	// the evolution ends when every event has frozen out, at the centre or everywhere
+	bool globalFreezeout = hydro->freezeoutCriterion == FREEZEOUT_MAXIMUM;
+	double *freezeoutTime = (double *) malloc(numEvents * sizeof(double));
+	for (int m = 0; m < numEvents; ++m) freezeoutTime[m] = -1;
+
+	// the observables and probes are computed where the fluid is, at the output steps for the centre and every
+	// observablesFrequency steps for the time series; every event has the centre followed by the probes
+	int probesPerEvent = 1 + output->numProbes;
+	int numProbeCells = slab->ensembleSize * probesPerEvent;
+	int *probeCells = (int *) malloc(numProbeCells * sizeof(int));
+	for (int m = 0; m < slab->ensembleSize; ++m) {
+		probeCells[m * probesPerEvent] = (domain.rank == centerRank) ? sctr + m*ncx : -1;
+		for (int c = 0; c < output->numProbes; ++c)
+			probeCells[m * probesPerEvent + 1 + c] = probeCellIndex(output->probePositions[c], m, latticeParams, slabParams);
+	}
+	for (int c = 0; c < output->numProbes && firstEvent; ++c) {
+		const double *position = output->probePositions[c];
+		if (fabs(position[0]) > lattice->latticeSpacingX * nx/2 || fabs(position[1]) > lattice->latticeSpacingY * ny/2
+				|| fabs(position[2]) > lattice->latticeSpacingRapidity * nz/2)
+			fprintf(stderr, "Probe %s is outside of the lattice and reads 0.\n", output->probeNames[c]);
+	}
+	setProbeCells(probeCells, numProbeCells, cpu);
+	free(probeCells);
+	struct FluidReductions *reductions = (struct FluidReductions *) malloc(slab->ensembleSize * sizeof(struct FluidReductions));
+	double *probeValues = (double *) malloc(PROBE_FIELDS * numProbeCells * sizeof(double));
+	struct TimeSeries *observables = (struct TimeSeries *) calloc(numEvents, sizeof(struct TimeSeries));
+	if (output->observablesFormat != TIME_SERIES_NONE && isRootRank()) {
+		for (int m = 0; m < numEvents; ++m)
+			if (openObservables(&observables[m], outputDirs[m], output, cli->restartFile != NULL) != 0)
+				fprintf(stderr, "The observables of %s are not recorded.\n", outputDirs[m]);
+	}
 
-	for (int n = 1; n <= nt+1; ++n) {
+	// the phases of the evolution loop only, with --profile
+	if (cli->profile) enablePhaseTimers(cpu);
+	beginPhase(PHASE_EVOLUTION);
+	for (int n = firstStep + 1; adaptive ? t < tEnd : n <= nt+1; ++n) {
+		if (adaptive) {
+			beginPhase(PHASE_CFL_TIME_STEP);
+			PRECISION radii[3];
+			if (cpu) maximumSpectralRadiiHost(u, radii);
+			else maximumSpectralRadii(d_u, radii);
+			// every slab takes the same time step
+			double globalRadii[3] = { radii[0], radii[1], radii[2] };
+			maximumOverRanks(globalRadii, 3);
+			for (int m = 0; m < 3; ++m) radii[m] = (PRECISION) globalRadii[m];
+			dt = courantTimeStep(radii, t, latticeParams);
+			setTimeStep((PRECISION) dt, cpu);
+			endPhase(PHASE_CFL_TIME_STEP);
+			for (int m = 0; m < numEvents; ++m)
+				if (timeStepHistory[m] != NULL) fprintf(timeStepHistory[m], "%d\t%.6f\t%.6e\n", n - 1, t, dt);
+			minTimeStep = fmin(minTimeStep, dt);
+			maxTimeStep = fmax(maxTimeStep, dt);
+		}
 		// copy variables back to host and write to disk
-		if ((n-1) % FREQ == 0) {
+		bool outputStep = isOutputStep(n, t, dt, output, &nextOutputTime);
+		bool checkpointStep = isCheckpointStep(n, firstStep, output) && slab->ensembleSize == 1;
+		// the validity of the current state, only for the snapshots that write it
+		if (outputStep && validityDomain->regulations != NULL) {
+			beginPhase(PHASE_VALIDITY);
+			if (cpu) checkValidityHost<MODE>(t, validityDomain, q, e, p, u, h_up);
+			else checkValidity<MODE>(t, d_validityDomain, d_q, d_e, d_p, d_u, d_up);
+			endPhase(PHASE_VALIDITY);
+		}
+		bool observablesStep = output->observablesFormat != TIME_SERIES_NONE && (n-1) % output->observablesFrequency == 0;
+		if (outputStep || observablesStep || globalFreezeout) {
+			beginPhase(PHASE_OBSERVABLES);
+			if (cpu) computeObservablesHost(q, e, p, u, reductions, probeValues);
+			else computeObservables(d_q, d_e, d_p, d_u, reductions, probeValues);
+			reduceObservablesOverRanks(reductions, slab->ensembleSize, probeValues, PROBE_FIELDS * numProbeCells);
+			endPhase(PHASE_OBSERVABLES);
+		}
+		if (observablesStep) {
+			beginPhase(PHASE_OUTPUT);
+			for (int m = 0; m < numEvents; ++m)
+				writeObservables(&observables[m], n - 1, t, &reductions[m], probeValues + PROBE_FIELDS * (m * probesPerEvent + 1),
+						output->numProbes, latticeParams);
+			endPhase(PHASE_OUTPUT);
+		}
+		// the fields are copied only for the snapshots and checkpoints
+		if (!cpu && ((outputStep && output->numOutputFields > 0) || checkpointStep)) {
+			beginPhase(PHASE_DEVICE_TO_HOST);
 			copyDeviceToHostMemory(bytes);
+			if (checkpointStep) copyPreviousFluidVelocityDeviceToHost(bytes);
+			endPhase(PHASE_DEVICE_TO_HOST);
+		}
+		if (checkpointStep) {
+			beginPhase(PHASE_OUTPUT);
+			double failed = writeCheckpoint(outputDirs[0], n - 1, t, h_dtp, slabParams, q, e, p, u, h_up) != 0;
+			// every rank stops if one of the slabs was not saved, since the run could not be restarted from it
+			maximumOverRanks(&failed, 1);
+			endPhase(PHASE_OUTPUT);
+			if (failed) {
+				if (isRootRank()) fprintf(stderr, "Could not write the checkpoint of n = %d to %s. Exiting ...\n", n - 1, outputDirs[0]);
+				exit(-1);
+			}
+		}
+		if (outputStep) {
+			for (int m = 0; m < numEvents; ++m) {
+				center[2*m] = probeValues[PROBE_FIELDS * m * probesPerEvent];
+				center[2*m+1] = probeValues[PROBE_FIELDS * m * probesPerEvent + 1];
+			}
 			printf("n = %d:%d (t = %.3f),\t (e, p) = (%.3f, %.3f) [GeV/fm^3],\t (T = %.3f [GeV]),\t",
-				n - 1, nt, t, e[sctr]*hbarc, p[sctr]*hbarc, effectiveTemperature(e[sctr])*hbarc);
-			outputDynamicalQuantities(t, outputDir, latticeParams);
-			// end hydrodynamic simulation if the temperature is below the freezeout temperature
-			if(e[sctr] < freezeoutEnergyDensity) {
-				printf("\nReached freezeout temperature at the center.\n");
-				break;
+				n - 1, nt, t, center[0]*hbarc, center[1]*hbarc, effectiveTemperature((PRECISION) center[0])*hbarc);
+			if (adaptive) printf("(dt = %.4f [fm]),\t", dt);
+			beginPhase(PHASE_OUTPUT);
+			for (int m = 0; m < numEvents; ++m) outputDynamicalQuantities(t, &writers[m], output, m*ncx);
+			endPhase(PHASE_OUTPUT);
+		}
+		// end hydrodynamic simulation if the temperature is below the freezeout temperature in every event
+		bool frozenOut = globalFreezeout || outputStep;
+		for (int m = 0; m < numEvents; ++m) {
+			if (freezeoutTime[m] < 0) {
+				if (globalFreezeout ? reductions[m].eMax < freezeoutEnergyDensity : outputStep && center[2*m] < freezeoutEnergyDensity)
+					freezeoutTime[m] = t;
 			}
+			frozenOut = frozenOut && freezeoutTime[m] >= 0;
+		}
+		if (frozenOut) {
+			if (globalFreezeout) printf("\nReached freezeout temperature everywhere.\n");
+			else printf("\nReached freezeout temperature at the center.\n");
+			break;
 		}
 		sw.tic();
-		twoStepRungeKutta(t, dt, d_q, d_Q);
+		beginPhase(PHASE_TIME_STEP);
+		if (cpu) integrator->host(t, dt, q, h_Q);
+		else integrator->device(t, dt, d_q, d_Q);
+		endPhase(PHASE_TIME_STEP);
 		sw.toc();
 		float elapsedTime = sw.elapsedTime();
-		if ((n-1) % FREQ == 0) printf("(Elapsed time/step: %.3f ms)\n", elapsedTime);
+		if (outputStep) {
+			struct InferredVariablesStatistics stats = collectInferredVariablesStatistics(&solverStatistics, cpu);
+			printf("(Elapsed time/step: %.3f ms),\t (solver: ", elapsedTime);
+			printInferredVariablesStatistics(&stats);
+			printf(")\n");
+		}
 		totalTime+=elapsedTime;
 		++nsteps;
 
-		setCurrentConservedVariables();
+		if (cpu) setCurrentConservedVariablesHost();
+		else setCurrentConservedVariables();
 
-		t = t0 + n * dt;
+		t = adaptive ? t + dt : t0 + n * dt;
 	}
+	endPhase(PHASE_EVOLUTION);
+	disablePhaseTimers();
 	printf("Average time/step: %.3f ms\n",totalTime/((double)nsteps));
+	printf("Euler steps: %d (%s)\n", nsteps * integrator->eulerSteps, integrator->name);
+	if (adaptive) {
+		printf("Time steps: %d, %.4f <= dt <= %.4f [fm]\n", nsteps, minTimeStep, maxTimeStep);
+		for (int m = 0; m < numEvents; ++m)
+			if (timeStepHistory[m] != NULL) fclose(timeStepHistory[m]);
+	}
+	for (int m = 0; m < numEvents; ++m) {
+		const char *criterion = globalFreezeout ? "maximum" : "center";
+		if (freezeoutTime[m] >= 0) printf("%s: freezeout (%s) at t = %.3f [fm]\n", outputDirs[m], criterion, freezeoutTime[m]);
+		else printf("%s: no freezeout (%s) by t = %.3f [fm]\n", outputDirs[m], criterion, t);
+	}
+	// on the evolved fields of the first batch, so that the inputs are those of an event
+	if (firstEvent && cli->kernelBenchmarkRepeats > 0 && isRootRank()) {
+		if (!cpu) {
+			copyDeviceToHostMemory(bytes);
+			copyPreviousFluidVelocityDeviceToHost(bytes);
+		}
+		benchmarkKernels<MODE>(t, cli->kernelBenchmarkRepeats, outputDirs[0]);
+	}
+	// includes the solves after the last output step
+	collectInferredVariablesStatistics(&solverStatistics, cpu);
+	printf("Inferred variables: ");
+	printInferredVariablesStatistics(&solverStatistics);
+	printf("\n");
+	// wait for the queued snapshots before the host arrays are freed
+	for (int m = 0; m < numEvents; ++m) stopOutputWriter(&writers[m]);
+	free(writers);
+	free(timeStepHistory);
+	free(center);
+	free(freezeoutTime);
+	for (int m = 0; m < numEvents; ++m) closeTimeSeries(&observables[m]);
+	free(observables);
+	free(reductions);
+	free(probeValues);
+}
+
+template <int MODE>
+void runHydrodynamics(void * latticeParams, void * initCondParams, void * hydroParams, void * outputParams, void * cliParams,
+		const char *rootDirectory) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	struct InitialConditionParameters * initCond = (struct InitialConditionParameters *) initCondParams;
+	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
+	struct CommandLineArguments * cli = (struct CommandLineArguments *) cliParams;
+
+	const char *outputDir = cli->outputDirectory;
+	bool cpu = (cli->backend == CPU_BACKEND);
+	double runStart = monotonicTime();
+	resetPhaseTimers();
+
+	int integratorIndex = findTimeIntegrator(lattice->timeIntegrator);
+	if (integratorIndex < 0) {
+		fprintf(stderr, "Unknown time integrator %s, expected rk2 or ssp_rk3. Exiting ...\n", lattice->timeIntegrator);
+		exit(-1);
+	}
+	const TIME_INTEGRATOR * integrator = getTimeIntegrator<MODE>(integratorIndex);
+
+	// a batch of events shares the allocations, constant parameters and EoS table set up below
+	struct InitialConditionParameters * events = NULL;
+	double * woundedNucleons = NULL;
+	int numEvents = 1;
+	if (cli->eventList != NULL) {
+		if (cli->restartFile != NULL) {
+			fprintf(stderr, "A restart resumes a single event and cannot be combined with an event list. Exiting ...\n");
+			exit(-1);
+		}
+		numEvents = loadInitialConditionEvents(cli->eventList, initCondParams, &events);
+		if (numEvents < 0) exit(-1);
+		printf("%d events from %s\n", numEvents, cli->eventList);
+		// the nucleons of the Monte Carlo Glauber events are sampled in parallel, on the rank that sets the initial conditions
+		if (isRootRank()) woundedNucleons = sampleEventsWoundedNucleons(numEvents, events);
+	}
+
+	/************************************************************************************\
+	 * System configuration (C/CUDA)
+	/************************************************************************************/
+	int nx = lattice->numLatticePointsX;
+	int ny = lattice->numLatticePointsY;
+	int nz = lattice->numLatticePointsRapidity;
+	int ncy = lattice->numComputationalLatticePointsY;
+
+	// events evolved together, packed side by side in x (see Ensemble.h)
+	int ensembleSize = lattice->ensembleSize;
+	if (ensembleSize < 1) ensembleSize = 1;
+	if (ensembleSize > numEvents) {
+		if (events == NULL && ensembleSize > 1) printf("An ensemble needs an event list, evolving a single event.\n");
+		ensembleSize = numEvents;
+	}
+	struct LatticeParameters packed = *lattice;
+	packLatticeEnsemble(&packed, ensembleSize);
+	void * packedParams = &packed;
+	// lattice evolved by this process, a slab in rapidity of the whole lattice with MPI (see DomainDecomposition.h)
+	struct LatticeParameters slab = packed;
+	if (decomposeLattice(&slab) != 0) exit(-1);
+	void * slabParams = &slab;
+	int nElements = slab.numComputationalLatticePointsX * ncy * slab.numComputationalLatticePointsRapidity;
+
+	double e0 = initCond->initialEnergyDensity;
+
+	double freezeoutTemperatureGeV = hydro->freezeoutTemperatureGeV;
+	const double hbarc = 0.197326938;
+	const double freezeoutTemperature = freezeoutTemperatureGeV/hbarc;
+//	const double freezeoutEnergyDensity = e0*pow(freezeoutTemperature,4);
+	const double freezeoutEnergyDensity = equilibriumEnergyDensity(freezeoutTemperature);
+	printf("Grid size = %d x %d x %d\n", nx, ny, nz);
+	// the Euler step, ghost cells and validity skip the trivial directions of a 1D or 2D lattice
+	latticeDimensions = getLatticeDimensions(latticeParams);
+	printf("Lattice dimensions = %s\n", getLatticeDimensionsName(latticeDimensions));
+	if (domain.numRanks > 1) {
+		int first, longest, shortest;
+		getRapiditySlab(nz, domain.numRanks, 0, &first, &longest);
+		getRapiditySlab(nz, domain.numRanks, domain.numRanks - 1, &first, &shortest);
+		printf("%d processes, slabs of %d to %d rapidity points\n", domain.numRanks, shortest, longest);
+	}
+	if (ensembleSize > 1) {
+		printf("Ensembles of %d events, packed lattice = %d x %d x %d\n", ensembleSize, packed.numLatticePointsX, ny, nz);
+		// a checkpoint resumes a single event
+		if (((struct OutputParameters *) outputParams)->checkpointFrequency > 0) printf("Checkpoints are not written for ensembles.\n");
+	}
+	printf("spatial resolution = (%.3f, %.3f, %.3f)\n", lattice->latticeSpacingX, lattice->latticeSpacingY, lattice->latticeSpacingRapidity);
+	printf("freezeout temperature = %.3f [fm^-1] (eF = %.3f [fm^-4])\n", freezeoutTemperature, freezeoutEnergyDensity);
+
+	printf("eta/s = %.6f\n", hydro->shearViscosityToEntropyDensity);
+
+	// evaluated at the output steps only
+	bool validity = writesValidityFields((struct OutputParameters *) outputParams);
+	printf("Validity diagnostics = %s\n", validity ? "on" : "off");
+	printf("Precision = %s\n", sizeof(PRECISION) == sizeof(double) ? "double" : "float");
+
+	size_t bytes = nElements * sizeof(PRECISION);
+	if (cpu) {
+		if (cli->numThreads > 0) omp_set_num_threads(cli->numThreads);
+		printf("cpu backend: %d threads\n", omp_get_max_threads());
+		initializeHostConstantParameters(slabParams, initCondParams, hydroParams);
+		allocateHostMemory(nElements);
+		if (validity) allocateValidityDomainHostMemory(nElements);
+	}
+	else {
+		// the ranks on a node share its GPUs
+		int numDevices = 0;
+		cudaGetDeviceCount(&numDevices);
+		if (domain.numRanks > 1 && numDevices > 0) cudaSetDevice(domain.localRank % numDevices);
+		// Initialize CUDA kernel parameters
+		initializeCUDALaunchParameters<MODE>(slabParams);
+		initializeCUDAConstantParameters(slabParams, initCondParams, hydroParams);
+
+		// Allocate host and device memory
+		allocateHostMemory(nElements);
+		allocateDeviceMemory(bytes);
+		if (validity) {
+			allocateValidityDomainHostMemory(nElements);
+			allocateValidityDomainDeviceMemory(bytes);
+		}
+		// staging for the previous fluid velocity in checkpoints
+		allocatePreviousFluidVelocityHostMemory(nElements);
+	}
+	allocateHaloExchangeMemory(cpu);
+#if defined(TABULATED_EOS) && !defined(CONFORMAL_EOS)
+	// the initial conditions already use the table on the host
+	initializeEquationOfStateTable(cpu);
+	printEquationOfStateTableError();
+#endif
+
+	if (events == NULL) {
+		evolveEnsemble<MODE>(latticeParams, packedParams, slabParams, initCond, 1, hydroParams, outputParams, cliParams,
+				rootDirectory, &outputDir, integrator, true);
+	}
+	else {
+		Stopwatch batch;
+		char *eventDirs = (char *) malloc(ensembleSize * 255);
+		const char **outputDirs = (const char **) malloc(ensembleSize * sizeof(const char *));
+		for (int first = 0; first < numEvents; first += ensembleSize) {
+			int count = numEvents - first < ensembleSize ? numEvents - first : ensembleSize;
+			printf("===================================================\n");
+			for (int n = first; n < first + count; ++n) {
+				char *eventDir = eventDirs + 255 * (n - first);
+				sprintf(eventDir, "%s/event_%d", outputDir, n);
+				if (mkdir(eventDir, 0755) != 0 && errno != EEXIST) {
+					fprintf(stderr, "Could not create %s. Exiting ...\n", eventDir);
+					exit(-1);
+				}
+				outputDirs[n - first] = eventDir;
+				printf("Event %d of %d: randomSeed = %d, eventIndex = %d, b = %.3f [fm], output to %s\n", n + 1, numEvents,
+					events[n].randomSeed, events[n].eventIndex, events[n].impactParameter, eventDir);
+			}
+			evolveEnsemble<MODE>(latticeParams, packedParams, slabParams, &events[first], count, hydroParams, outputParams,
+					cliParams, rootDirectory, outputDirs, integrator, first == 0);
+		}
+		batch.toc();
+		free(eventDirs);
+		free(outputDirs);
+		printf("===================================================\n");
+		printf("%d events in %.3f s (%.3f s/event)\n", numEvents, batch.elapsedTime()/1000, batch.elapsedTime()/1000/numEvents);
+		free(events);
+		free(woundedNucleons);
+	}
+
+	if (cli->profile) {
+		struct PhaseReport report;
+		char host[256] = "unknown";
+		gethostname(host, sizeof(host) - 1);
+		report.host = host;
+		report.threads = cpu ? omp_get_max_threads() : 0;
+		report.backend = cpu ? "cpu" : "gpu";
+		report.precision = sizeof(PRECISION) == sizeof(double) ? "double" : "float";
+		report.timeIntegrator = integrator->name;
+		report.eulerStep = getEulerStepStrategy<MODE>(eulerStepStrategy)->name;
+		report.lattice[0] = nx;
+		report.lattice[1] = ny;
+		report.lattice[2] = nz;
+		report.numEvents = numEvents;
+		report.cellsPerStep = (double) nx * ny * slab.numLatticePointsRapidity * ensembleSize;
+		report.wallTime = monotonicTime() - runStart;
+		// every rank times its own slab
+		char fname[255];
+		if (domain.numRanks > 1) sprintf(fname, "%s/profile.json.%d", outputDir, domain.rank);
+		else sprintf(fname, "%s/profile.json", outputDir);
+		if (writePhaseReport(fname, &report) == 0) printf("Phase timings written to %s\n", fname);
+		resetPhaseTimers();
+	}
 
 	/************************************************************************************\
 	 * Deallocate host and device memory
 	/************************************************************************************/
-	freeHostMemory();
-	freeDeviceMemory();
-	cudaDeviceReset();
+	freeHaloExchangeMemory();
+	freeObservablesMemory();
+	if (cpu) {
+		freeIntermediateHostMemory();
+		freeHostMemory();
+	}
+	else {
+		freeHostMemory();
+		freePreviousFluidVelocityHostMemory();
+		freeDeviceMemory();
+		freeSpectralRadiusMemory();
+		cudaDeviceReset();
+	}
+}
+
+void run(void * latticeParams, void * initCondParams, void * hydroParams, void * outputParams, void * cliParams,
+		const char *rootDirectory) {
+	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
+
+	physicsMode = hydro->physicsMode;
+	switch (physicsMode) {
+		case IDEAL_HYDRO: {
+			printf("Ideal hydrodynamics.\n");
+			runHydrodynamics<IDEAL_HYDRO>(latticeParams, initCondParams, hydroParams, outputParams, cliParams, rootDirectory);
+			return;
+		}
+		case SHEAR_HYDRO: {
+			printf("Viscous hydrodynamics with shear stress.\n");
+			runHydrodynamics<SHEAR_HYDRO>(latticeParams, initCondParams, hydroParams, outputParams, cliParams, rootDirectory);
+			return;
+		}
+		case SHEAR_BULK_HYDRO: {
+			printf("Viscous hydrodynamics with shear stress and bulk pressure.\n");
+			runHydrodynamics<SHEAR_BULK_HYDRO>(latticeParams, initCondParams, hydroParams, outputParams, cliParams, rootDirectory);
+			return;
+		}
+		default: {
+			fprintf(stderr, "Physics mode %d not defined. Exiting ...\n", physicsMode);
+			exit(-1);
+		}
+	}
 }
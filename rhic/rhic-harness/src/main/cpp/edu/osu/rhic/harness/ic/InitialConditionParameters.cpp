@@ -5,6 +5,9 @@
  *      Author: bazow
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
 #include "edu/osu/rhic/harness/util/Properties.h"
 
@@ -21,6 +24,10 @@ double fractionOfBinaryCollisions;
 double rapidityVariance; // \sigma^{2}_{\eta}
 double rapidityMean; // flat region around \ets_s = 0
 
+int randomSeed;
+int eventIndex;
+double depositionCutoffRadius;
+
 void loadInitialConditionParameters(config_t *cfg, const char* configDirectory, void * params) {
 	// Read the file
 	char fname[255];
@@ -39,6 +46,9 @@ void loadInitialConditionParameters(config_t *cfg, const char* configDirectory,
 	getDoubleProperty(cfg, "fractionOfBinaryCollisions", &fractionOfBinaryCollisions, 0.5);
 	getDoubleProperty(cfg, "rapidityVariance", &rapidityVariance, 0.5);
 	getDoubleProperty(cfg, "rapidityMean", &rapidityMean, 0.5);
+	getIntegerProperty(cfg, "randomSeed", &randomSeed, 1328398221);
+	getIntegerProperty(cfg, "eventIndex", &eventIndex, 0);
+	getDoubleProperty(cfg, "depositionCutoffRadius", &depositionCutoffRadius, 2.76);
 
 	struct InitialConditionParameters * initCond = (struct InitialConditionParameters *) params;
 	initCond->initialConditionType = initialConditionType;
@@ -49,4 +59,66 @@ void loadInitialConditionParameters(config_t *cfg, const char* configDirectory,
 	initCond->fractionOfBinaryCollisions = fractionOfBinaryCollisions;
 	initCond->rapidityVariance = rapidityVariance;
 	initCond->rapidityMean = rapidityMean;
+	initCond->randomSeed = randomSeed;
+	initCond->eventIndex = eventIndex;
+	initCond->depositionCutoffRadius = depositionCutoffRadius;
+	initCond->numWoundedNucleons = 0;
+	initCond->woundedNucleonsX = NULL;
+	initCond->woundedNucleonsY = NULL;
+}
+
+// Only the settings present in cfg are changed
+static void overrideInitialConditionParameters(config_t *cfg, struct InitialConditionParameters * initCond) {
+	config_lookup_int(cfg, "initialConditionType", &initCond->initialConditionType);
+	config_lookup_int(cfg, "numberOfNucleonsPerNuclei", &initCond->numberOfNucleonsPerNuclei);
+	config_lookup_float(cfg, "initialEnergyDensity", &initCond->initialEnergyDensity);
+	config_lookup_float(cfg, "scatteringCrossSectionNN", &initCond->scatteringCrossSectionNN);
+	config_lookup_float(cfg, "impactParameter", &initCond->impactParameter);
+	config_lookup_float(cfg, "fractionOfBinaryCollisions", &initCond->fractionOfBinaryCollisions);
+	config_lookup_float(cfg, "rapidityVariance", &initCond->rapidityVariance);
+	config_lookup_float(cfg, "rapidityMean", &initCond->rapidityMean);
+	config_lookup_int(cfg, "randomSeed", &initCond->randomSeed);
+	config_lookup_int(cfg, "eventIndex", &initCond->eventIndex);
+	config_lookup_float(cfg, "depositionCutoffRadius", &initCond->depositionCutoffRadius);
+}
+
+int loadInitialConditionEvents(const char *fname, const void * baseParams, struct InitialConditionParameters **events) {
+	FILE *fp = fopen(fname, "r");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open the event list %s.\n", fname);
+		return -1;
+	}
+	int numEvents = 0, capacity = 16;
+	*events = (struct InitialConditionParameters *) malloc(capacity * sizeof(struct InitialConditionParameters));
+	char line[1024];
+	for (int lineNumber = 1; fgets(line, sizeof(line), fp) != NULL; ++lineNumber) {
+		const char *settings = line + strspn(line, " \t\r\n");
+		if (*settings == '\0' || *settings == '#') continue;
+		if (numEvents == capacity) {
+			capacity *= 2;
+			*events = (struct InitialConditionParameters *) realloc(*events, capacity * sizeof(struct InitialConditionParameters));
+		}
+		config_t cfg;
+		config_init(&cfg);
+		if (!config_read_string(&cfg, settings)) {
+			fprintf(stderr, "%s:%d: %s\n", fname, lineNumber, config_error_text(&cfg));
+			config_destroy(&cfg);
+			fclose(fp);
+			free(*events);
+			*events = NULL;
+			return -1;
+		}
+		memcpy(*events + numEvents, baseParams, sizeof(struct InitialConditionParameters));
+		overrideInitialConditionParameters(&cfg, *events + numEvents);
+		config_destroy(&cfg);
+		++numEvents;
+	}
+	fclose(fp);
+	if (numEvents == 0) {
+		fprintf(stderr, "No events in %s.\n", fname);
+		free(*events);
+		*events = NULL;
+		return -1;
+	}
+	return numEvents;
 }
@@ -0,0 +1,176 @@
+/*
+ * Checkpoint.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "edu/osu/rhic/harness/io/Checkpoint.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+
+#define MAX_CHECKPOINT_ARRAYS 25
+
+// Arrays of the checkpoint in the order they are stored
+static int getCheckpointArrays(PRECISION **arrays, const CONSERVED_VARIABLES *q, const PRECISION *e, const PRECISION *p,
+		const FLUID_VELOCITY *u, const FLUID_VELOCITY *up) {
+	int n = 0;
+	arrays[n++] = (PRECISION *) e;
+	arrays[n++] = (PRECISION *) p;
+	arrays[n++] = u->ut;
+	arrays[n++] = u->ux;
+	arrays[n++] = u->uy;
+	arrays[n++] = u->un;
+	arrays[n++] = up->ut;
+	arrays[n++] = up->ux;
+	arrays[n++] = up->uy;
+	arrays[n++] = up->un;
+	arrays[n++] = q->ttt;
+	arrays[n++] = q->ttx;
+	arrays[n++] = q->tty;
+	arrays[n++] = q->ttn;
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		arrays[n++] = q->pitt;
+		arrays[n++] = q->pitx;
+		arrays[n++] = q->pity;
+		arrays[n++] = q->pitn;
+		arrays[n++] = q->pixx;
+		arrays[n++] = q->pixy;
+		arrays[n++] = q->pixn;
+		arrays[n++] = q->piyy;
+		arrays[n++] = q->piyn;
+		arrays[n++] = q->pinn;
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		arrays[n++] = q->Pi;
+	}
+	return n;
+}
+
+static void setCheckpointHeader(struct CheckpointHeader *header, int step, double t, double dtp, void * latticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	memset(header, 0, sizeof(struct CheckpointHeader));
+	memcpy(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic));
+	header->version = CHECKPOINT_VERSION;
+	header->physicsMode = physicsMode;
+	header->ncx = lattice->numComputationalLatticePointsX;
+	header->ncy = lattice->numComputationalLatticePointsY;
+	header->ncz = lattice->numComputationalLatticePointsRapidity;
+	header->precisionBytes = sizeof(PRECISION);
+	header->eulerStepStrategy = eulerStepStrategy;
+	header->adaptiveTimeStep = lattice->adaptiveTimeStep != 0;
+	strncpy(header->timeIntegrator, lattice->timeIntegrator, TIME_INTEGRATOR_NAME_LENGTH - 1);
+	header->step = step;
+	header->t = t;
+	header->dt = lattice->latticeSpacingProperTime;
+	if (header->adaptiveTimeStep) {
+		header->cflNumber = lattice->cflNumber;
+		header->minDt = lattice->minLatticeSpacingProperTime;
+		header->maxDt = lattice->maxLatticeSpacingProperTime;
+	}
+	header->dtp = dtp;
+}
+
+int writeCheckpoint(const char *pathToOutDir, int step, double t, double dtp, void * latticeParams,
+		const CONSERVED_VARIABLES *q, const PRECISION *e, const PRECISION *p, const FLUID_VELOCITY *u, const FLUID_VELOCITY *up) {
+	struct CheckpointHeader header;
+	setCheckpointHeader(&header, step, t, dtp, latticeParams);
+	size_t len = (size_t) header.ncx * header.ncy * header.ncz;
+
+	char fname[255], tmpname[255];
+	// every rank of a domain decomposition writes its own slab
+	if (domain.numRanks > 1) sprintf(fname, "%s/checkpoint.bin.%d", pathToOutDir, domain.rank);
+	else sprintf(fname, "%s/checkpoint.bin", pathToOutDir);
+	sprintf(tmpname, "%s.tmp", fname);
+	FILE *fp = fopen(tmpname, "wb");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open checkpoint file %s.\n", tmpname);
+		return -1;
+	}
+
+	PRECISION *arrays[MAX_CHECKPOINT_ARRAYS];
+	int numArrays = getCheckpointArrays(arrays, q, e, p, u, up);
+	int status = 0;
+	if (fwrite(&header, sizeof(header), 1, fp) != 1) status = -1;
+	for (int n = 0; n < numArrays && status == 0; ++n) {
+		if (fwrite(arrays[n], sizeof(PRECISION), len, fp) != len) status = -1;
+	}
+	if (fclose(fp) != 0) status = -1;
+	if (status != 0) {
+		fprintf(stderr, "Could not write checkpoint file %s.\n", tmpname);
+		remove(tmpname);
+		return -1;
+	}
+	if (rename(tmpname, fname) != 0) {
+		fprintf(stderr, "Could not replace checkpoint file %s.\n", fname);
+		return -1;
+	}
+	return 0;
+}
+
+int readCheckpoint(const char *fname, int *step, double *t, double *dtp, void * latticeParams,
+		CONSERVED_VARIABLES *q, PRECISION *e, PRECISION *p, FLUID_VELOCITY *u, FLUID_VELOCITY *up) {
+	FILE *fp = fopen(fname, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open checkpoint file %s.\n", fname);
+		return -1;
+	}
+
+	struct CheckpointHeader header, expected;
+	setCheckpointHeader(&expected, 0, 0, 0, latticeParams);
+	if (fread(&header, sizeof(header), 1, fp) != 1
+			|| memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) != 0 || header.version != CHECKPOINT_VERSION) {
+		fprintf(stderr, "%s is not a version %d checkpoint.\n", fname, CHECKPOINT_VERSION);
+		fclose(fp);
+		return -1;
+	}
+	if (header.physicsMode != expected.physicsMode || header.precisionBytes != expected.precisionBytes) {
+		fprintf(stderr, "%s was written in physics mode %d with %d byte precision, not mode %d with %d bytes.\n", fname,
+				header.physicsMode, header.precisionBytes, expected.physicsMode, expected.precisionBytes);
+		fclose(fp);
+		return -1;
+	}
+	if (header.ncx != expected.ncx || header.ncy != expected.ncy || header.ncz != expected.ncz || header.dt != expected.dt) {
+		fprintf(stderr, "%s was written for a %d x %d x %d lattice with dt = %.6f, not %d x %d x %d with dt = %.6f.\n", fname,
+				header.ncx, header.ncy, header.ncz, header.dt, expected.ncx, expected.ncy, expected.ncz, expected.dt);
+		fclose(fp);
+		return -1;
+	}
+	header.timeIntegrator[TIME_INTEGRATOR_NAME_LENGTH - 1] = '\0';
+	if (header.eulerStepStrategy != expected.eulerStepStrategy || strcmp(header.timeIntegrator, expected.timeIntegrator) != 0) {
+		fprintf(stderr, "%s was written with the %s Euler step and %s, not %s and %s.\n", fname,
+				getEulerStepStrategyName(header.eulerStepStrategy), header.timeIntegrator,
+				getEulerStepStrategyName(expected.eulerStepStrategy), expected.timeIntegrator);
+		fclose(fp);
+		return -1;
+	}
+	if (header.adaptiveTimeStep != expected.adaptiveTimeStep || header.cflNumber != expected.cflNumber
+			|| header.minDt != expected.minDt || header.maxDt != expected.maxDt) {
+		fprintf(stderr, "%s was written with adaptiveTimeStep = %d (CFL number %.3f, %.6f <= dt <= %.6f), "
+				"not %d (%.3f, %.6f <= dt <= %.6f).\n", fname, header.adaptiveTimeStep, header.cflNumber, header.minDt, header.maxDt,
+				expected.adaptiveTimeStep, expected.cflNumber, expected.minDt, expected.maxDt);
+		fclose(fp);
+		return -1;
+	}
+
+	size_t len = (size_t) header.ncx * header.ncy * header.ncz;
+	PRECISION *arrays[MAX_CHECKPOINT_ARRAYS];
+	int numArrays = getCheckpointArrays(arrays, q, e, p, u, up);
+	for (int n = 0; n < numArrays; ++n) {
+		if (fread(arrays[n], sizeof(PRECISION), len, fp) != len) {
+			fprintf(stderr, "%s is truncated.\n", fname);
+			fclose(fp);
+			return -1;
+		}
+	}
+	fclose(fp);
+
+	*step = header.step;
+	*t = header.t;
+	*dtp = header.dtp;
+	return 0;
+}
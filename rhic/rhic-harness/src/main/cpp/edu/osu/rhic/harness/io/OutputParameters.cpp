@@ -0,0 +1,87 @@
+/*
+ * OutputParameters.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+
+#include "edu/osu/rhic/harness/io/OutputParameters.h"
+#include "edu/osu/rhic/harness/util/Properties.h"
+
+int outputFrequency;
+double outputTimeInterval;
+int outputRegion;
+int outputStride;
+int checkpointFrequency;
+char outputFieldList[OUTPUT_FIELD_LIST_LENGTH];
+int observablesFormat;
+int observablesFrequency;
+char probeList[OUTPUT_FIELD_LIST_LENGTH];
+
+// everything written before the output section existed
+const char *defaultOutputFields = "e, p, ux, uy, un, ut, ttt, ttn, "
+		"pixx, pixy, pixn, piyy, piyn, pitt, pitx, pity, pitn, pinn, Pi, "
+		"regulations, Rpi, R2pi, RPi, R2Pi, KnTaupi, KnTauPi, taupi, dxux, dyuy, theta";
+
+void loadOutputParameters(config_t *cfg, const char* configDirectory, void * params) {
+	// Read the file
+	char fname[255];
+	sprintf(fname, "%s/%s", configDirectory, "output.properties");
+	if (!config_read_file(cfg, fname)) {
+		fprintf(stderr, "No configuration file  %s found for output parameters - %s.\n", fname, config_error_text(cfg));
+		fprintf(stderr, "Using default output configuration parameters.\n");
+	}
+
+	getIntegerProperty(cfg, "outputFrequency", &outputFrequency, 10);
+	getDoubleProperty(cfg, "outputTimeInterval", &outputTimeInterval, 0);
+	getIntegerProperty(cfg, "outputRegion", &outputRegion, SNAPSHOT_FULL_GRID);
+	getIntegerProperty(cfg, "outputStride", &outputStride, 1);
+	getIntegerProperty(cfg, "checkpointFrequency", &checkpointFrequency, 0);
+	getStringProperty(cfg, "outputFields", outputFieldList, OUTPUT_FIELD_LIST_LENGTH, defaultOutputFields);
+	getIntegerProperty(cfg, "observablesFormat", &observablesFormat, TIME_SERIES_NONE);
+	getIntegerProperty(cfg, "observablesFrequency", &observablesFrequency, 1);
+	getStringProperty(cfg, "probes", probeList, OUTPUT_FIELD_LIST_LENGTH, "");
+
+	struct OutputParameters * output = (struct OutputParameters *) params;
+	output->outputFrequency = outputFrequency > 0 ? outputFrequency : 1;
+	output->outputTimeInterval = outputTimeInterval;
+	output->outputRegion = outputRegion;
+	output->outputStride = outputStride > 0 ? outputStride : 1;
+	output->checkpointFrequency = checkpointFrequency > 0 ? checkpointFrequency : 0;
+	if (observablesFormat < TIME_SERIES_NONE || observablesFormat > TIME_SERIES_BINARY) {
+		fprintf(stderr, "Unknown observablesFormat %d, the observables are not written.\n", observablesFormat);
+		observablesFormat = TIME_SERIES_NONE;
+	}
+	output->observablesFormat = observablesFormat;
+	output->observablesFrequency = observablesFrequency > 0 ? observablesFrequency : 1;
+
+	// the field names are separated by commas and/or whitespace
+	output->numOutputFields = 0;
+	for (char *name = strtok(outputFieldList, ", \t"); name != NULL; name = strtok(NULL, ", \t")) {
+		if (output->numOutputFields == SNAPSHOT_MAX_FIELDS) {
+			fprintf(stderr, "Only the first %d output fields are written.\n", SNAPSHOT_MAX_FIELDS);
+			break;
+		}
+		char *field = output->outputFields[output->numOutputFields++];
+		strncpy(field, name, SNAPSHOT_FIELD_NAME_LENGTH-1);
+		field[SNAPSHOT_FIELD_NAME_LENGTH-1] = '\0';
+	}
+
+	// the probes "name x y eta" are separated by semicolons
+	output->numProbes = 0;
+	for (char *probe = strtok(probeList, ";"); probe != NULL; probe = strtok(NULL, ";")) {
+		if (strspn(probe, " \t") == strlen(probe)) continue;
+		if (output->numProbes == MAX_PROBES) {
+			fprintf(stderr, "Only the first %d probes are written.\n", MAX_PROBES);
+			break;
+		}
+		char *name = output->probeNames[output->numProbes];
+		double *position = output->probePositions[output->numProbes];
+		if (sscanf(probe, "%23s %lf %lf %lf", name, &position[0], &position[1], &position[2]) != 4) {
+			fprintf(stderr, "Probe \"%s\" is not of the form name x y eta, skipped.\n", probe);
+			continue;
+		}
+		++output->numProbes;
+	}
+}
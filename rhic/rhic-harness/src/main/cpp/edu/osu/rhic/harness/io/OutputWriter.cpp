@@ -0,0 +1,152 @@
+/*
+ * OutputWriter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "edu/osu/rhic/harness/io/OutputWriter.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+
+static int writeOutputBuffer(struct OutputWriter *writer, const struct OutputBuffer *buffer) {
+	struct SnapshotWriter snapshot;
+	if (openSnapshotWriter(&snapshot, buffer->t, writer->pathToOutDir, writer->latticeParams, &writer->region) != 0) return -1;
+	int status = 0;
+	for (int n = 0; n < buffer->numFields; ++n) {
+		if (writePackedSnapshotField(&snapshot, buffer->names[n], buffer->fields[n]) != 0) status = -1;
+	}
+	if (closeSnapshotWriter(&snapshot) != 0) status = -1;
+	return status;
+}
+
+static void * outputWriterThread(void * arg) {
+	struct OutputWriter *writer = (struct OutputWriter *) arg;
+
+	pthread_mutex_lock(&writer->mutex);
+	while (1) {
+		while (writer->head == NULL && !writer->shutdown)
+			pthread_cond_wait(&writer->bufferQueued, &writer->mutex);
+		// the queue is drained before the thread exits
+		if (writer->head == NULL) break;
+
+		struct OutputBuffer *buffer = writer->head;
+		writer->head = buffer->next;
+		if (writer->head == NULL) writer->tail = NULL;
+		pthread_mutex_unlock(&writer->mutex);
+
+		int status = writeOutputBuffer(writer, buffer);
+
+		pthread_mutex_lock(&writer->mutex);
+		if (status != 0) writer->errors++;
+		buffer->next = writer->freeList;
+		writer->freeList = buffer;
+		pthread_cond_signal(&writer->bufferFreed);
+	}
+	pthread_mutex_unlock(&writer->mutex);
+	return NULL;
+}
+
+int startOutputWriter(struct OutputWriter *writer, const char *pathToOutDir, void * latticeParams,
+		const struct SnapshotRegion *region) {
+	memset(writer->buffers, 0, sizeof(writer->buffers));
+	writer->freeList = NULL;
+	for (int n = 0; n < OUTPUT_WRITER_BUFFERS; ++n) {
+		writer->buffers[n].next = writer->freeList;
+		writer->freeList = &writer->buffers[n];
+	}
+	writer->head = NULL;
+	writer->tail = NULL;
+	writer->shutdown = 0;
+	writer->errors = 0;
+	writer->pathToOutDir = pathToOutDir;
+	writer->latticeParams = latticeParams;
+	if (region != NULL) writer->region = *region;
+	else setSnapshotRegion(&writer->region, latticeParams, SNAPSHOT_FULL_GRID, 1);
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	writer->ncx = lattice->numComputationalLatticePointsX;
+	int first, count;
+	getRapiditySlab(lattice->numLatticePointsRapidity, domain.numRanks, domain.rank, &first, &count);
+	restrictSnapshotRegion(&writer->region, first, count, &writer->slabRegion);
+	if (!isRootRank()) return 0;
+
+	pthread_mutex_init(&writer->mutex, NULL);
+	pthread_cond_init(&writer->bufferFreed, NULL);
+	pthread_cond_init(&writer->bufferQueued, NULL);
+	if (pthread_create(&writer->thread, NULL, outputWriterThread, writer) != 0) {
+		fprintf(stderr, "Could not start the output writer thread.\n");
+		return -1;
+	}
+	return 0;
+}
+
+struct OutputBuffer * acquireOutputBuffer(struct OutputWriter *writer, double t) {
+	struct OutputBuffer *buffer = &writer->buffers[0];
+	if (isRootRank()) {
+		pthread_mutex_lock(&writer->mutex);
+		while (writer->freeList == NULL)
+			pthread_cond_wait(&writer->bufferFreed, &writer->mutex);
+		buffer = writer->freeList;
+		writer->freeList = buffer->next;
+		pthread_mutex_unlock(&writer->mutex);
+	}
+
+	buffer->t = t;
+	buffer->numFields = 0;
+	buffer->next = NULL;
+	return buffer;
+}
+
+int addOutputField(struct OutputWriter *writer, struct OutputBuffer *buffer, const char *name, const PRECISION * const var) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) writer->latticeParams;
+	const struct SnapshotRegion *region = isRootRank() ? &writer->region : &writer->slabRegion;
+
+	if (buffer->numFields == SNAPSHOT_MAX_FIELDS) {
+		fprintf(stderr, "Snapshot field table is full, %s not written.\n", name);
+		return -1;
+	}
+	int n = buffer->numFields;
+	if (buffer->fields[n] == NULL) buffer->fields[n] = (float *) malloc(sizeof(float) * region->nx * region->ny * region->nz);
+	memset(buffer->names[n], 0, SNAPSHOT_FIELD_NAME_LENGTH);
+	strncpy(buffer->names[n], name, SNAPSHOT_FIELD_NAME_LENGTH-1);
+	const struct SnapshotRegion *slab = &writer->slabRegion;
+	packSnapshotField(var, buffer->fields[n], slab, writer->ncx, lattice->numComputationalLatticePointsY);
+	// the slabs are in rapidity order, as are the packed cells, and the root rank holds the first one
+	gatherOnRootRank(buffer->fields[n], sizeof(float) * slab->nx * slab->ny * slab->nz);
+	buffer->numFields++;
+	return 0;
+}
+
+void submitOutputBuffer(struct OutputWriter *writer, struct OutputBuffer *buffer) {
+	if (!isRootRank()) return;
+	pthread_mutex_lock(&writer->mutex);
+	if (writer->tail == NULL) writer->head = buffer;
+	else writer->tail->next = buffer;
+	writer->tail = buffer;
+	pthread_cond_signal(&writer->bufferQueued);
+	pthread_mutex_unlock(&writer->mutex);
+}
+
+int stopOutputWriter(struct OutputWriter *writer) {
+	if (!isRootRank()) {
+		for (int m = 0; m < SNAPSHOT_MAX_FIELDS; ++m) free(writer->buffers[0].fields[m]);
+		return 0;
+	}
+	pthread_mutex_lock(&writer->mutex);
+	writer->shutdown = 1;
+	pthread_cond_signal(&writer->bufferQueued);
+	pthread_mutex_unlock(&writer->mutex);
+	pthread_join(writer->thread, NULL);
+
+	pthread_mutex_destroy(&writer->mutex);
+	pthread_cond_destroy(&writer->bufferFreed);
+	pthread_cond_destroy(&writer->bufferQueued);
+	for (int n = 0; n < OUTPUT_WRITER_BUFFERS; ++n) {
+		for (int m = 0; m < SNAPSHOT_MAX_FIELDS; ++m) free(writer->buffers[n].fields[m]);
+	}
+	if (writer->errors > 0) fprintf(stderr, "%d snapshots could not be written.\n", writer->errors);
+	return writer->errors;
+}
@@ -0,0 +1,392 @@
+/*
+ * Snapshot.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <dirent.h> // for listing the snapshots of a directory
+
+// for mapping snapshots
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+static uint64_t alignSnapshotOffset(uint64_t offset) {
+	return (offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+static int isLittleEndian() {
+	const uint16_t one = 1;
+	return *((const unsigned char *) &one) == 1;
+}
+
+// Keeps every stride-th of n cells, placed symmetrically about the centre of the axis
+static void subsampleAxis(int n, int stride, int *first, int *count, int *step) {
+	*first = ((n - 1) % stride) / 2;
+	*count = (n - 1 - *first) / stride + 1;
+	*step = stride;
+}
+
+void setSnapshotRegion(struct SnapshotRegion *region, void * latticeParams, int regionType, int stride) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	if (stride < 1) stride = 1;
+	subsampleAxis(lattice->numLatticePointsX, stride, &region->i0, &region->nx, &region->sx);
+	subsampleAxis(lattice->numLatticePointsY, stride, &region->j0, &region->ny, &region->sy);
+	subsampleAxis(lattice->numLatticePointsRapidity, stride, &region->k0, &region->nz, &region->sz);
+	// the slices go through the centre cell used for the printout in run()
+	if (regionType == SNAPSHOT_ETA_SLICE) {
+		region->k0 = lattice->numLatticePointsRapidity / 2;
+		region->nz = 1;
+		region->sz = 1;
+	}
+	else if (regionType == SNAPSHOT_Y_SLICE) {
+		region->j0 = lattice->numLatticePointsY / 2;
+		region->ny = 1;
+		region->sy = 1;
+	}
+}
+
+void restrictSnapshotRegion(const struct SnapshotRegion *region, int first, int count, struct SnapshotRegion *slab) {
+	*slab = *region;
+	// first and last cell of the region in the slab
+	int m0 = region->k0 >= first ? 0 : (first - region->k0 + region->sz - 1) / region->sz;
+	int m1 = first + count - 1 - region->k0;
+	m1 = m1 < 0 ? -1 : m1 / region->sz;
+	if (m1 > region->nz - 1) m1 = region->nz - 1;
+	slab->nz = m1 >= m0 ? m1 - m0 + 1 : 0;
+	slab->k0 = region->k0 + m0 * region->sz - first;
+}
+
+int openSnapshotWriter(struct SnapshotWriter *writer, double t, const char *pathToOutDir, void * latticeParams,
+		const struct SnapshotRegion *region) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	int nx = lattice->numLatticePointsX;
+	int ny = lattice->numLatticePointsY;
+	int nz = lattice->numLatticePointsRapidity;
+	double dx = lattice->latticeSpacingX;
+	double dy = lattice->latticeSpacingY;
+	double dz = lattice->latticeSpacingRapidity;
+
+	if (!isLittleEndian()) {
+		fprintf(stderr, "Binary snapshots are only written on little-endian hosts.\n");
+		return -1;
+	}
+
+	char fname[255];
+	sprintf(fname, "%s/snapshot_%.3f.bin", pathToOutDir, t);
+	writer->fp = fopen(fname, "wb");
+	if (writer->fp == NULL) {
+		fprintf(stderr, "Could not open snapshot file %s.\n", fname);
+		return -1;
+	}
+
+	if (region != NULL) writer->region = *region;
+	else setSnapshotRegion(&writer->region, latticeParams, SNAPSHOT_FULL_GRID, 1);
+	region = &writer->region;
+
+	memset(&writer->header, 0, sizeof(writer->header));
+	memcpy(writer->header.magic, SNAPSHOT_MAGIC, sizeof(writer->header.magic));
+	writer->header.version = SNAPSHOT_VERSION;
+	writer->header.numFields = 0;
+	writer->header.nx = region->nx;
+	writer->header.ny = region->ny;
+	writer->header.nz = region->nz;
+	writer->header.fieldBytes = sizeof(float);
+	writer->header.t = t;
+	writer->header.dx = dx * region->sx;
+	writer->header.dy = dy * region->sy;
+	writer->header.dz = dz * region->sz;
+	writer->header.x0 = (region->i0 - (nx-1)/2.)*dx;
+	writer->header.y0 = (region->j0 - (ny-1)/2.)*dy;
+	writer->header.z0 = (region->k0 - (nz-1)/2.)*dz;
+	memset(writer->fields, 0, sizeof(writer->fields));
+
+	writer->ncx = lattice->numComputationalLatticePointsX;
+	writer->ncy = lattice->numComputationalLatticePointsY;
+	writer->end = alignSnapshotOffset(sizeof(struct SnapshotHeader) + sizeof(writer->fields));
+	writer->buffer = (float *) malloc(sizeof(float) * writer->header.nx * writer->header.ny * writer->header.nz);
+	return 0;
+}
+
+void packSnapshotField(const PRECISION * const var, float * const packed, const struct SnapshotRegion *region, int ncx, int ncy) {
+	int n = 0;
+	for(int k = 0; k < region->nz; ++k) {
+		int kk = N_GHOST_CELLS_M + region->k0 + k*region->sz;
+		for(int j = 0; j < region->ny; ++j) {
+			int jj = N_GHOST_CELLS_M + region->j0 + j*region->sy;
+			for(int i = 0; i < region->nx; ++i) {
+				int ii = N_GHOST_CELLS_M + region->i0 + i*region->sx;
+				int s = columnMajorLinearIndex(ii, jj, kk, ncx, ncy);
+				packed[n++] = (float) var[s];
+			}
+		}
+	}
+}
+
+int writeSnapshotField(struct SnapshotWriter *writer, const char *name, const PRECISION * const var) {
+	packSnapshotField(var, writer->buffer, &writer->region, writer->ncx, writer->ncy);
+	return writePackedSnapshotField(writer, name, writer->buffer);
+}
+
+int writePackedSnapshotField(struct SnapshotWriter *writer, const char *name, const float * const packed) {
+	if (writer->header.numFields == SNAPSHOT_MAX_FIELDS) {
+		fprintf(stderr, "Snapshot field table is full, %s not written.\n", name);
+		return -1;
+	}
+	struct SnapshotField *field = &writer->fields[writer->header.numFields];
+	strncpy(field->name, name, SNAPSHOT_FIELD_NAME_LENGTH-1);
+	field->offset = writer->end;
+
+	size_t bytes = sizeof(float) * writer->header.nx * writer->header.ny * writer->header.nz;
+	fseek(writer->fp, (long) field->offset, SEEK_SET);
+	if (fwrite(packed, 1, bytes, writer->fp) != bytes) {
+		fprintf(stderr, "Could not write snapshot field %s.\n", name);
+		return -1;
+	}
+	writer->end = alignSnapshotOffset(field->offset + bytes);
+	writer->header.numFields++;
+	return 0;
+}
+
+int closeSnapshotWriter(struct SnapshotWriter *writer) {
+	int status = 0;
+	// pad the last array so that the file size is a multiple of the alignment
+	fseek(writer->fp, 0, SEEK_END);
+	if ((uint64_t) ftell(writer->fp) < writer->end) {
+		fseek(writer->fp, (long) writer->end - 1, SEEK_SET);
+		fputc(0, writer->fp);
+	}
+
+	fseek(writer->fp, 0, SEEK_SET);
+	if (fwrite(&writer->header, sizeof(writer->header), 1, writer->fp) != 1
+			|| fwrite(writer->fields, sizeof(writer->fields), 1, writer->fp) != 1) {
+		fprintf(stderr, "Could not write snapshot header.\n");
+		status = -1;
+	}
+	if (fclose(writer->fp) != 0) status = -1;
+	free(writer->buffer);
+	writer->fp = NULL;
+	writer->buffer = NULL;
+	return status;
+}
+
+int openSnapshot(const char *fname, struct Snapshot *snapshot) {
+	int fd = open(fname, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Could not open snapshot file %s.\n", fname);
+		return -1;
+	}
+	struct stat st;
+	fstat(fd, &st);
+	snapshot->size = (size_t) st.st_size;
+	if (snapshot->size < sizeof(struct SnapshotHeader) + SNAPSHOT_MAX_FIELDS * sizeof(struct SnapshotField)) {
+		fprintf(stderr, "%s is too small to be a snapshot.\n", fname);
+		close(fd);
+		return -1;
+	}
+	snapshot->data = mmap(NULL, snapshot->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (snapshot->data == MAP_FAILED) {
+		fprintf(stderr, "Could not map snapshot file %s.\n", fname);
+		return -1;
+	}
+	snapshot->header = (const struct SnapshotHeader *) snapshot->data;
+	snapshot->fields = (const struct SnapshotField *) ((const char *) snapshot->data + sizeof(struct SnapshotHeader));
+
+	const struct SnapshotHeader *header = snapshot->header;
+	if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 || header->version != SNAPSHOT_VERSION
+			|| header->fieldBytes != sizeof(float) || header->numFields > SNAPSHOT_MAX_FIELDS) {
+		fprintf(stderr, "%s is not a version %d snapshot.\n", fname, SNAPSHOT_VERSION);
+		closeSnapshot(snapshot);
+		return -1;
+	}
+	uint64_t bytes = sizeof(float) * (uint64_t) header->nx * header->ny * header->nz;
+	for (unsigned int n = 0; n < header->numFields; ++n) {
+		if (snapshot->fields[n].offset + bytes > snapshot->size) {
+			fprintf(stderr, "%s is truncated.\n", fname);
+			closeSnapshot(snapshot);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+const float * getSnapshotField(const struct Snapshot *snapshot, const char *name) {
+	for (unsigned int n = 0; n < snapshot->header->numFields; ++n) {
+		if (strncmp(snapshot->fields[n].name, name, SNAPSHOT_FIELD_NAME_LENGTH) == 0)
+			return (const float *) ((const char *) snapshot->data + snapshot->fields[n].offset);
+	}
+	return NULL;
+}
+
+void closeSnapshot(struct Snapshot *snapshot) {
+	munmap(snapshot->data, snapshot->size);
+	snapshot->data = NULL;
+	snapshot->header = NULL;
+	snapshot->fields = NULL;
+}
+
+int convertSnapshotToText(const char *fname, const char *pathToOutDir) {
+	struct Snapshot snapshot;
+	if (openSnapshot(fname, &snapshot) != 0) return -1;
+
+	const struct SnapshotHeader *header = snapshot.header;
+	int nx = header->nx;
+	int ny = header->ny;
+	int nz = header->nz;
+	double dx = header->dx;
+	double dy = header->dy;
+	double dz = header->dz;
+	double x0 = header->x0;
+	double y0 = header->y0;
+	double z0 = header->z0;
+
+	for (unsigned int n = 0; n < header->numFields; ++n) {
+		const float *var = (const float *) ((const char *) snapshot.data + snapshot.fields[n].offset);
+
+		char name[SNAPSHOT_FIELD_NAME_LENGTH+1];
+		strncpy(name, snapshot.fields[n].name, SNAPSHOT_FIELD_NAME_LENGTH);
+		name[SNAPSHOT_FIELD_NAME_LENGTH] = '\0';
+
+		FILE *fp;
+		char outname[255];
+		sprintf(outname, "%s/%s_%.3f.dat", pathToOutDir, name, header->t);
+		fp=fopen(outname, "w");
+		if (fp == NULL) {
+			fprintf(stderr, "Could not open %s.\n", outname);
+			closeSnapshot(&snapshot);
+			return -1;
+		}
+
+		double x,y,z;
+		int s = 0;
+		for(int k = 0; k < nz; ++k) {
+			z = z0 + k*dz;
+			for(int j = 0; j < ny; ++j) {
+				y = y0 + j*dy;
+				for(int i = 0; i < nx; ++i) {
+					x = x0 + i*dx;
+					fprintf(fp, "%.3f\t%.3f\t%.3f\t%.8f\n",x,y,z,var[s++]);
+				}
+			}
+		}
+		fclose(fp);
+	}
+	printf("Converted %d fields of %s.\n", header->numFields, fname);
+
+	closeSnapshot(&snapshot);
+	return 0;
+}
+
+void snapshotFieldDeviation(const float * const var, const float * const reference, size_t n, struct SnapshotDeviation *deviation) {
+	double maxDifference = 0, maxMagnitude = 0;
+	for (size_t s = 0; s < n; ++s) {
+		double d = fabs((double) var[s] - (double) reference[s]);
+		// a NaN on one side only is an infinite deviation
+		if (d != d) d = (var[s] != var[s] && reference[s] != reference[s]) ? 0 : INFINITY;
+		if (d > maxDifference) maxDifference = d;
+		if (fabs(reference[s]) > maxMagnitude) maxMagnitude = fabs(reference[s]);
+		if (fabs(var[s]) > maxMagnitude) maxMagnitude = fabs(var[s]);
+	}
+	deviation->difference = maxDifference;
+	deviation->deviation = maxMagnitude > 0 ? maxDifference / maxMagnitude : 0;
+}
+
+int compareSnapshots(const char *fname, const char *referenceFname, struct SnapshotDeviation *deviations) {
+	struct Snapshot snapshot, reference;
+	if (openSnapshot(fname, &snapshot) != 0) return -1;
+	if (openSnapshot(referenceFname, &reference) != 0) {
+		closeSnapshot(&snapshot);
+		return -1;
+	}
+	const struct SnapshotHeader *header = snapshot.header;
+	if (header->nx != reference.header->nx || header->ny != reference.header->ny || header->nz != reference.header->nz) {
+		fprintf(stderr, "%s and %s are not on the same grid.\n", fname, referenceFname);
+		closeSnapshot(&snapshot);
+		closeSnapshot(&reference);
+		return -1;
+	}
+	size_t cells = (size_t) header->nx * header->ny * header->nz;
+
+	int numFields = 0;
+	for (unsigned int n = 0; n < header->numFields; ++n) {
+		const float *ref = getSnapshotField(&reference, snapshot.fields[n].name);
+		if (ref == NULL) continue;
+		const float *var = (const float *) ((const char *) snapshot.data + snapshot.fields[n].offset);
+		strncpy(deviations[numFields].name, snapshot.fields[n].name, SNAPSHOT_FIELD_NAME_LENGTH);
+		deviations[numFields].name[SNAPSHOT_FIELD_NAME_LENGTH] = '\0';
+		snapshotFieldDeviation(var, ref, cells, &deviations[numFields]);
+		++numFields;
+	}
+
+	closeSnapshot(&snapshot);
+	closeSnapshot(&reference);
+	return numFields;
+}
+
+static int isSnapshotFile(const struct dirent *entry) {
+	size_t length = strlen(entry->d_name);
+	return strncmp(entry->d_name, "snapshot_", 9) == 0 && length > 13 && strcmp(entry->d_name + length - 4, ".bin") == 0;
+}
+
+int listSnapshotFiles(const char *pathToOutDir, struct dirent ***entries) {
+	return scandir(pathToOutDir, entries, isSnapshotFile, alphasort);
+}
+
+int compareSnapshotDirectories(const char *pathToOutDir, const char *pathToReferenceDir) {
+	struct dirent **entries;
+	int numSnapshots = listSnapshotFiles(pathToOutDir, &entries);
+	if (numSnapshots < 0) {
+		fprintf(stderr, "Could not list the snapshots of %s.\n", pathToOutDir);
+		return -1;
+	}
+
+	// largest deviation of each field over the snapshots, and the snapshot where it occurs
+	struct SnapshotDeviation largest[SNAPSHOT_MAX_FIELDS];
+	char where[SNAPSHOT_MAX_FIELDS][256];
+	int numFields = 0, numCompared = 0;
+	for (int m = 0; m < numSnapshots; ++m) {
+		char fname[512], referenceFname[512];
+		sprintf(fname, "%s/%s", pathToOutDir, entries[m]->d_name);
+		sprintf(referenceFname, "%s/%s", pathToReferenceDir, entries[m]->d_name);
+		if (access(referenceFname, R_OK) != 0) continue;
+
+		struct SnapshotDeviation deviations[SNAPSHOT_MAX_FIELDS];
+		int n = compareSnapshots(fname, referenceFname, deviations);
+		if (n < 0) continue;
+		++numCompared;
+		for (int i = 0; i < n; ++i) {
+			int f = 0;
+			while (f < numFields && strcmp(largest[f].name, deviations[i].name) != 0) ++f;
+			if (f == numFields) {
+				largest[numFields++] = deviations[i];
+				strcpy(where[f], entries[m]->d_name);
+			}
+			else if (deviations[i].deviation > largest[f].deviation) {
+				largest[f] = deviations[i];
+				strcpy(where[f], entries[m]->d_name);
+			}
+		}
+	}
+	for (int m = 0; m < numSnapshots; ++m) free(entries[m]);
+	free(entries);
+
+	if (numCompared == 0) {
+		fprintf(stderr, "No snapshot of %s has a counterpart in %s.\n", pathToOutDir, pathToReferenceDir);
+		return -1;
+	}
+	printf("Deviation of %d snapshots from %s:\n", numCompared, pathToReferenceDir);
+	printf("\t%-12s %-12s %-12s %s\n", "field", "relative", "max |x-ref|", "snapshot");
+	for (int f = 0; f < numFields; ++f)
+		printf("\t%-12s %-12.3e %-12.3e %s\n", largest[f].name, largest[f].deviation, largest[f].difference, where[f]);
+	return 0;
+}
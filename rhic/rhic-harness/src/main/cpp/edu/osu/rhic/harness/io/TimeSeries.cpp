@@ -0,0 +1,116 @@
+/*
+ * TimeSeries.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "edu/osu/rhic/harness/io/TimeSeries.h"
+
+int openTimeSeries(struct TimeSeries *series, const char *fname, int format, int numColumns, const char * const *names, bool append) {
+	series->format = format;
+	series->numColumns = numColumns;
+	series->fp = fopen(fname, append ? "ab" : "wb");
+	if (series->fp == NULL) {
+		fprintf(stderr, "Could not open %s.\n", fname);
+		return -1;
+	}
+	fseek(series->fp, 0, SEEK_END);
+	if (ftell(series->fp) > 0) return 0;
+
+	if (format == TIME_SERIES_CSV) {
+		for (int c = 0; c < numColumns; ++c) fprintf(series->fp, c == 0 ? "%s" : ",%s", names[c]);
+		fprintf(series->fp, "\n");
+	}
+	else {
+		uint32_t n = (uint32_t) numColumns;
+		fwrite(TIME_SERIES_MAGIC, 1, 8, series->fp);
+		fwrite(&n, sizeof(n), 1, series->fp);
+		for (int c = 0; c < numColumns; ++c) {
+			char name[TIME_SERIES_NAME_LENGTH];
+			memset(name, 0, sizeof(name));
+			strncpy(name, names[c], TIME_SERIES_NAME_LENGTH-1);
+			fwrite(name, 1, TIME_SERIES_NAME_LENGTH, series->fp);
+		}
+	}
+	return 0;
+}
+
+void writeTimeSeriesRow(struct TimeSeries *series, const double * const values) {
+	if (series->fp == NULL) return;
+	if (series->format == TIME_SERIES_CSV) {
+		for (int c = 0; c < series->numColumns; ++c) fprintf(series->fp, c == 0 ? "%.9g" : ",%.9g", values[c]);
+		fprintf(series->fp, "\n");
+	}
+	else fwrite(values, sizeof(double), series->numColumns, series->fp);
+}
+
+void closeTimeSeries(struct TimeSeries *series) {
+	if (series->fp != NULL) fclose(series->fp);
+	series->fp = NULL;
+}
+
+int readTimeSeries(const char *fname, struct TimeSeriesTable *table) {
+	memset(table, 0, sizeof(struct TimeSeriesTable));
+	FILE *fp = fopen(fname, "r");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open %s.\n", fname);
+		return -1;
+	}
+	char *line = NULL;
+	size_t length = 0;
+	if (getline(&line, &length, fp) <= 0) {
+		fprintf(stderr, "%s has no header.\n", fname);
+		fclose(fp);
+		return -1;
+	}
+	int numColumns = 1;
+	for (const char *c = line; *c != '\0'; ++c) if (*c == ',') ++numColumns;
+	table->numColumns = numColumns;
+	table->names = (char (*)[TIME_SERIES_NAME_LENGTH]) calloc(numColumns, TIME_SERIES_NAME_LENGTH);
+	int n = 0;
+	for (char *name = strtok(line, ",\r\n"); name != NULL && n < numColumns; name = strtok(NULL, ",\r\n"))
+		strncpy(table->names[n++], name, TIME_SERIES_NAME_LENGTH-1);
+
+	int capacity = 0;
+	while (getline(&line, &length, fp) > 0) {
+		if (line[0] == '\n' || line[0] == '\r') continue;
+		if (table->numRows == capacity) {
+			capacity = capacity > 0 ? 2 * capacity : 256;
+			table->values = (double *) realloc(table->values, (size_t) capacity * numColumns * sizeof(double));
+		}
+		double *row = table->values + (size_t) table->numRows * numColumns;
+		char *c = line, *end;
+		for (n = 0; n < numColumns; ++n) {
+			row[n] = strtod(c, &end);
+			if (end == c) break;
+			c = *end == ',' ? end + 1 : end;
+		}
+		if (n < numColumns) {
+			fprintf(stderr, "Row %d of %s has %d of its %d values.\n", table->numRows + 1, fname, n, numColumns);
+			free(line);
+			fclose(fp);
+			freeTimeSeriesTable(table);
+			return -1;
+		}
+		++table->numRows;
+	}
+	free(line);
+	fclose(fp);
+	return 0;
+}
+
+int getTimeSeriesColumn(const struct TimeSeriesTable *table, const char *name) {
+	for (int n = 0; n < table->numColumns; ++n)
+		if (strcmp(table->names[n], name) == 0) return n;
+	return -1;
+}
+
+void freeTimeSeriesTable(struct TimeSeriesTable *table) {
+	free(table->names);
+	free(table->values);
+	memset(table, 0, sizeof(struct TimeSeriesTable));
+}
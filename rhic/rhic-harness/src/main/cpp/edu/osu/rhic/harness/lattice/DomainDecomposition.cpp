@@ -0,0 +1,133 @@
+/*
+ * DomainDecomposition.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+struct DomainDecomposition domain = { 0, 1, 0, 0, 0, -1, -1 };
+
+void initializeDomainDecomposition(int *argc, char ***argv) {
+#ifdef USE_MPI
+	MPI_Init(argc, argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &domain.rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &domain.numRanks);
+	MPI_Comm node;
+	MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, domain.rank, MPI_INFO_NULL, &node);
+	MPI_Comm_rank(node, &domain.localRank);
+	MPI_Comm_free(&node);
+	// every rank runs the same steps, so the root rank speaks for all of them
+	if (domain.rank != 0 && freopen("/dev/null", "w", stdout) == NULL)
+		fprintf(stderr, "Rank %d could not discard its standard output.\n", domain.rank);
+#endif
+}
+
+void finalizeDomainDecomposition() {
+#ifdef USE_MPI
+	MPI_Finalize();
+#endif
+}
+
+void getRapiditySlab(int nz, int numRanks, int rank, int *first, int *count) {
+	int base = nz / numRanks;
+	int longer = nz % numRanks;
+	*count = base + (rank < longer ? 1 : 0);
+	*first = rank * base + (rank < longer ? rank : longer);
+}
+
+int getRapiditySlabRank(int nz, int numRanks, int k) {
+	int base = nz / numRanks;
+	int longer = nz % numRanks;
+	// the first longer slabs hold base + 1 points each
+	if (k < longer * (base + 1)) return k / (base + 1);
+	return longer + (k - longer * (base + 1)) / base;
+}
+
+int decomposeLattice(void * latticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	int nz = lattice->numLatticePointsRapidity;
+
+	domain.numLatticePointsRapidity = nz;
+	domain.lowerRank = domain.rank > 0 ? domain.rank - 1 : -1;
+	domain.upperRank = domain.rank < domain.numRanks - 1 ? domain.rank + 1 : -1;
+	if (domain.numRanks == 1) {
+		domain.firstRapidityPoint = 0;
+		return 0;
+	}
+	// the planes sent to either neighbour must not overlap
+	if (nz / domain.numRanks < N_GHOST_CELLS) {
+		if (isRootRank()) fprintf(stderr, "%d rapidity points cannot be split into %d slabs of at least %d points.\n",
+				nz, domain.numRanks, N_GHOST_CELLS);
+		return -1;
+	}
+	int count;
+	getRapiditySlab(nz, domain.numRanks, domain.rank, &domain.firstRapidityPoint, &count);
+	lattice->numLatticePointsRapidity = count;
+	lattice->numComputationalLatticePointsRapidity = count + N_GHOST_CELLS;
+	return 0;
+}
+
+bool isRootRank() {
+	return domain.rank == 0;
+}
+
+void maximumOverRanks(double * const x, int n) {
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, x, n, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+}
+
+void minimumOverRanks(double * const x, int n) {
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, x, n, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+#endif
+}
+
+void sumOverRanks(unsigned long long * const x, int n) {
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, x, n, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+void sumOverRanks(double * const x, int n) {
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, x, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+void broadcastFromRank(double * const x, int n, int root) {
+#ifdef USE_MPI
+	MPI_Bcast(x, n, MPI_DOUBLE, root, MPI_COMM_WORLD);
+#endif
+}
+
+void gatherOnRootRank(void * const data, int bytes) {
+#ifdef USE_MPI
+	if (domain.numRanks == 1) return;
+	int *counts = NULL, *offsets = NULL;
+	if (isRootRank()) {
+		counts = (int *) malloc(domain.numRanks * sizeof(int));
+		offsets = (int *) malloc(domain.numRanks * sizeof(int));
+	}
+	MPI_Gather(&bytes, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+	if (isRootRank()) {
+		offsets[0] = 0;
+		for (int r = 1; r < domain.numRanks; ++r) offsets[r] = offsets[r-1] + counts[r-1];
+		MPI_Gatherv(MPI_IN_PLACE, bytes, MPI_BYTE, data, counts, offsets, MPI_BYTE, 0, MPI_COMM_WORLD);
+		free(counts);
+		free(offsets);
+	}
+	else {
+		MPI_Gatherv(data, bytes, MPI_BYTE, NULL, NULL, NULL, MPI_BYTE, 0, MPI_COMM_WORLD);
+	}
+#endif
+}
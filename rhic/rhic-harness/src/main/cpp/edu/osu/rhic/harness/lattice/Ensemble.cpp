@@ -0,0 +1,33 @@
+/*
+ * Ensemble.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h> // for memcpy
+
+#include "edu/osu/rhic/harness/lattice/Ensemble.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+void packLatticeEnsemble(void * latticeParams, int ensembleSize) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	int ncx = lattice->numComputationalLatticePointsX;
+	lattice->numComputationalLatticePointsX = ensembleSize * ncx;
+	lattice->numLatticePointsX = ensembleSize * ncx - N_GHOST_CELLS;
+	lattice->ensembleSize = ensembleSize;
+}
+
+void packEventRows(PRECISION * const packed, const PRECISION * const var, int n, void * packedLatticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) packedLatticeParams;
+	int ncxPacked = lattice->numComputationalLatticePointsX;
+	int ncx = ncxPacked / lattice->ensembleSize;
+	int ncy = lattice->numComputationalLatticePointsY;
+	int ncz = lattice->numComputationalLatticePointsRapidity;
+
+	for (int k = 0; k < ncz; ++k) {
+		for (int j = 0; j < ncy; ++j) {
+			memcpy(packed + columnMajorLinearIndex(n * ncx, j, k, ncxPacked, ncy), var + columnMajorLinearIndex(0, j, k, ncx, ncy),
+					ncx * sizeof(PRECISION));
+		}
+	}
+}
@@ -5,6 +5,8 @@
  *      Author: bazow
  */
 
+#include <string.h>
+
 #include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
 #include "edu/osu/rhic/harness/util/Properties.h"
 
@@ -18,6 +20,15 @@ double latticeSpacingY;
 double latticeSpacingRapidity;
 double latticeSpacingProperTime;
 
+int adaptiveTimeStep;
+double cflNumber;
+double minLatticeSpacingProperTime;
+double maxLatticeSpacingProperTime;
+
+char timeIntegrator[TIME_INTEGRATOR_NAME_LENGTH];
+
+int ensembleSize;
+
 void loadLatticeParameters(config_t *cfg, const char* configDirectory, void * params) {
 	// Read the file
 	char fname[255];
@@ -38,6 +49,15 @@ void loadLatticeParameters(config_t *cfg, const char* configDirectory, void * pa
 	getDoubleProperty(cfg, "latticeSpacingRapidity", &latticeSpacingRapidity, 0.3);
 	getDoubleProperty(cfg, "latticeSpacingProperTime", &latticeSpacingProperTime, 0.01);
 
+	getIntegerProperty(cfg, "adaptiveTimeStep", &adaptiveTimeStep, 0);
+	getDoubleProperty(cfg, "cflNumber", &cflNumber, 0.125);
+	getDoubleProperty(cfg, "minLatticeSpacingProperTime", &minLatticeSpacingProperTime, 0.001);
+	getDoubleProperty(cfg, "maxLatticeSpacingProperTime", &maxLatticeSpacingProperTime, 0.05);
+
+	getStringProperty(cfg, "timeIntegrator", timeIntegrator, TIME_INTEGRATOR_NAME_LENGTH, "rk2");
+
+	getIntegerProperty(cfg, "ensembleSize", &ensembleSize, 1);
+
 	struct LatticeParameters * lattice = (struct LatticeParameters *) params;
 	lattice->numLatticePointsX = numLatticePointsX;
 	lattice->numLatticePointsY = numLatticePointsY;
@@ -50,5 +70,11 @@ void loadLatticeParameters(config_t *cfg, const char* configDirectory, void * pa
 	lattice->latticeSpacingY = latticeSpacingY;
 	lattice->latticeSpacingRapidity = latticeSpacingRapidity;
 	lattice->latticeSpacingProperTime = latticeSpacingProperTime;
+	lattice->adaptiveTimeStep = adaptiveTimeStep;
+	lattice->cflNumber = cflNumber;
+	lattice->minLatticeSpacingProperTime = minLatticeSpacingProperTime;
+	lattice->maxLatticeSpacingProperTime = maxLatticeSpacingProperTime;
+	strcpy(lattice->timeIntegrator, timeIntegrator);
+	lattice->ensembleSize = ensembleSize;
 }
 
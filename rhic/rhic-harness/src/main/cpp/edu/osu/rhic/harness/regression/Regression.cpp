@@ -0,0 +1,285 @@
+/*
+ * Regression.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/regression/Regression.h"
+#include "edu/osu/rhic/harness/util/Properties.h"
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+#include "edu/osu/rhic/harness/ic/InitialConditionParameters.h"
+#include "edu/osu/rhic/harness/hydro/HydroParameters.h"
+#include "edu/osu/rhic/trunk/ic/InitialConditions.h"
+#include "edu/osu/rhic/trunk/ic/AnalyticSolutions.h"
+
+void loadRegressionThresholds(config_t *cfg, const char* configDirectory, struct RegressionThresholds *thresholds) {
+	char fname[255];
+	sprintf(fname, "%s/%s", configDirectory, "regression.properties");
+	if (!config_read_file(cfg, fname)) {
+		fprintf(stderr, "No configuration file  %s found for regression thresholds - %s.\n", fname, config_error_text(cfg));
+		fprintf(stderr, "Using default regression thresholds.\n");
+	}
+	getDoubleProperty(cfg, "maxAnalyticError", &thresholds->maxAnalyticError, 0.05);
+	getDoubleProperty(cfg, "maxReferenceDeviation", &thresholds->maxReferenceDeviation, 1.e-3);
+	getDoubleProperty(cfg, "maxThroughputDrop", &thresholds->maxThroughputDrop, 0.2);
+}
+
+// the ideal Gubser flow and the 1D and diagonal 2D Sod shock tubes
+static bool hasAnalyticSolution(int initialConditionType) {
+	return initialConditionType == 3 || initialConditionType == 5 || initialConditionType == 9;
+}
+
+int analyticSolutionError(const char *fname, void * initCondParams, void * hydroParams, struct SolutionError *error) {
+	struct InitialConditionParameters * initCond = (struct InitialConditionParameters *) initCondParams;
+	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
+	int type = initCond->initialConditionType;
+	if (!hasAnalyticSolution(type)) return 1;
+
+	struct Snapshot snapshot;
+	if (openSnapshot(fname, &snapshot) != 0) return -1;
+	const float *e = getSnapshotField(&snapshot, "e");
+	if (e == NULL) {
+		fprintf(stderr, "%s has no energy density.\n", fname);
+		closeSnapshot(&snapshot);
+		return -1;
+	}
+	const struct SnapshotHeader *h = snapshot.header;
+	// the shock tubes start from the initial time
+	double t = type == 3 ? h->t : h->t - hydro->initialProperTimePoint;
+
+	double absoluteSum = 0, squareSum = 0, maxDifference = 0;
+	double referenceSum = 0, referenceSquareSum = 0, maxReference = 0;
+	for (int k = 0; k < h->nz; ++k) {
+		for (int j = 0; j < h->ny; ++j) {
+			double y = h->y0 + j * h->dy;
+			for (int i = 0; i < h->nx; ++i) {
+				double x = h->x0 + i * h->dx;
+				double ea;
+				if (type == 3) ea = idealGubserEnergyDensity(initCond->initialEnergyDensity, t, x, y);
+				else ea = riemannProblemEnergyDensity(SOD_SHOCK_TUBE_LEFT_ENERGY_DENSITY, SOD_SHOCK_TUBE_RIGHT_ENERGY_DENSITY, t,
+						type == 5 ? x : (y - x) / sqrt(2.));
+				double d = fabs(e[i + h->nx * (j + h->ny * k)] - ea);
+				if (d != d) d = INFINITY;
+				absoluteSum += d;
+				squareSum += d * d;
+				if (d > maxDifference) maxDifference = d;
+				referenceSum += fabs(ea);
+				referenceSquareSum += ea * ea;
+				if (fabs(ea) > maxReference) maxReference = fabs(ea);
+			}
+		}
+	}
+	closeSnapshot(&snapshot);
+	error->l1 = absoluteSum / referenceSum;
+	error->l2 = sqrt(squareSum / referenceSquareSum);
+	error->lInf = maxDifference / maxReference;
+	return 0;
+}
+
+double timeSeriesDeviation(const struct TimeSeriesTable *series, const struct TimeSeriesTable *reference, const char **column) {
+	*column = NULL;
+	if (series->numRows != reference->numRows) return INFINITY;
+	double largest = 0;
+	for (int c = 0; c < series->numColumns; ++c) {
+		if (strcmp(series->names[c], "n") == 0) continue;
+		int r = getTimeSeriesColumn(reference, series->names[c]);
+		if (r < 0) continue;
+		double differenceSum = 0, valueSum = 0, referenceSum = 0;
+		for (int n = 0; n < series->numRows; ++n) {
+			double x = series->values[n * series->numColumns + c];
+			double xr = reference->values[n * reference->numColumns + r];
+			double d = x - xr;
+			// a NaN on one side only is an infinite deviation
+			if (d != d) d = (x != x && xr != xr) ? 0 : INFINITY;
+			differenceSum += d * d;
+			if (x == x) valueSum += x * x;
+			if (xr == xr) referenceSum += xr * xr;
+		}
+		double scale = fmax(sqrt(fmax(valueSum, referenceSum)), TIME_SERIES_DEVIATION_FLOOR * sqrt((double) series->numRows));
+		double deviation = series->numRows > 0 ? sqrt(differenceSum) / scale : 0;
+		if (*column == NULL || deviation > largest) {
+			largest = deviation;
+			*column = series->names[c];
+		}
+	}
+	return largest;
+}
+
+// Value of the first "key": number pair of a JSON file
+static int readJsonNumber(const char *fname, const char *key, double *value) {
+	FILE *fp = fopen(fname, "r");
+	if (fp == NULL) return -1;
+	char pattern[64], line[512];
+	snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+	int status = -1;
+	while (status != 0 && fgets(line, sizeof(line), fp) != NULL) {
+		const char *c = strstr(line, pattern);
+		if (c != NULL && sscanf(c + strlen(pattern), "%lf", value) == 1) status = 0;
+	}
+	fclose(fp);
+	return status;
+}
+
+// Value of the first "key": "string" pair of a JSON file, at most size - 1 characters
+static int readJsonString(const char *fname, const char *key, char *value, int size) {
+	FILE *fp = fopen(fname, "r");
+	if (fp == NULL) return -1;
+	char pattern[64], line[512];
+	snprintf(pattern, sizeof(pattern), "\"%s\": \"", key);
+	int status = -1;
+	while (status != 0 && fgets(line, sizeof(line), fp) != NULL) {
+		const char *c = strstr(line, pattern);
+		if (c == NULL) continue;
+		c += strlen(pattern);
+		const char *end = strchr(c, '"');
+		if (end == NULL || end - c >= size) continue;
+		memcpy(value, c, end - c);
+		value[end - c] = '\0';
+		status = 0;
+	}
+	fclose(fp);
+	return status;
+}
+
+bool isComparableBaseline(const char *profileFname, const char *baselineFname) {
+	char host[256], baselineHost[256];
+	double threads, baselineThreads;
+	return readJsonString(profileFname, "host", host, sizeof(host)) == 0
+			&& readJsonString(baselineFname, "host", baselineHost, sizeof(baselineHost)) == 0
+			&& readJsonNumber(profileFname, "threads", &threads) == 0
+			&& readJsonNumber(baselineFname, "threads", &baselineThreads) == 0
+			&& strcmp(host, baselineHost) == 0 && threads == baselineThreads;
+}
+
+static int copyFile(const char *fname, const char *copyFname) {
+	FILE *in = fopen(fname, "rb");
+	if (in == NULL) return -1;
+	FILE *out = fopen(copyFname, "wb");
+	if (out == NULL) {
+		fclose(in);
+		return -1;
+	}
+	char buffer[4096];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0) fwrite(buffer, 1, n, out);
+	fclose(in);
+	fclose(out);
+	return 0;
+}
+
+static const char * passed(bool ok) {
+	return ok ? "ok" : "FAILED";
+}
+
+int checkRegression(const char *pathToOutDir, const char *configDirectory, void * initCondParams, void * hydroParams,
+		bool recordBaseline) {
+	struct RegressionThresholds thresholds;
+	config_t cfg;
+	config_init(&cfg);
+	loadRegressionThresholds(&cfg, configDirectory, &thresholds);
+	config_destroy(&cfg);
+
+	bool regressed = false;
+	printf("Regression check of %s against %s:\n", pathToOutDir, configDirectory);
+
+	// the largest error over the snapshots
+	struct dirent **entries;
+	int numSnapshots = listSnapshotFiles(pathToOutDir, &entries);
+	struct SolutionError largest = { 0, 0, 0 };
+	char where[256] = "";
+	int numCompared = 0;
+	bool unreadable = false;
+	for (int m = 0; m < numSnapshots; ++m) {
+		char fname[512];
+		sprintf(fname, "%s/%s", pathToOutDir, entries[m]->d_name);
+		struct SolutionError error;
+		int status = analyticSolutionError(fname, initCondParams, hydroParams, &error);
+		if (status == 1) break;
+		if (status < 0) {
+			unreadable = true;
+			continue;
+		}
+		++numCompared;
+		if (error.l1 >= largest.l1) strcpy(where, entries[m]->d_name);
+		largest.l1 = fmax(largest.l1, error.l1);
+		largest.l2 = fmax(largest.l2, error.l2);
+		largest.lInf = fmax(largest.lInf, error.lInf);
+	}
+	for (int m = 0; m < numSnapshots; ++m) free(entries[m]);
+	if (numSnapshots >= 0) free(entries);
+	if (numCompared > 0) {
+		bool ok = largest.l1 <= thresholds.maxAnalyticError && !unreadable;
+		printf("\tanalytic e over %d snapshots: L1 = %.3e (%s), L2 = %.3e, Linf = %.3e\t%s (L1 <= %.3e)\n", numCompared,
+				largest.l1, where, largest.l2, largest.lInf, passed(ok), thresholds.maxAnalyticError);
+		regressed = regressed || !ok;
+	}
+	else if (hasAnalyticSolution(((struct InitialConditionParameters *) initCondParams)->initialConditionType)) {
+		printf("\tanalytic e: no snapshots in %s\tFAILED\n", pathToOutDir);
+		regressed = true;
+	}
+	else printf("\tanalytic e: no analytic solution, not checked\n");
+
+	char fname[512], referenceFname[512];
+	sprintf(fname, "%s/observables.csv", pathToOutDir);
+	sprintf(referenceFname, "%s/reference.csv", configDirectory);
+	if (access(referenceFname, R_OK) == 0) {
+		struct TimeSeriesTable series, reference;
+		bool ok = false;
+		if (readTimeSeries(fname, &series) == 0) {
+			if (readTimeSeries(referenceFname, &reference) == 0) {
+				const char *column;
+				double deviation = timeSeriesDeviation(&series, &reference, &column);
+				ok = deviation <= thresholds.maxReferenceDeviation;
+				if (series.numRows != reference.numRows)
+					printf("\treference observables: %d rows, the reference has %d\tFAILED\n", series.numRows, reference.numRows);
+				else printf("\treference observables over %d rows: L2 = %.3e (%s)\t%s (<= %.3e)\n", series.numRows, deviation,
+						column != NULL ? column : "no common column", passed(ok), thresholds.maxReferenceDeviation);
+				freeTimeSeriesTable(&reference);
+			}
+			freeTimeSeriesTable(&series);
+		}
+		if (!ok && access(fname, R_OK) != 0) printf("\treference observables: no %s\tFAILED\n", fname);
+		regressed = regressed || !ok;
+	}
+	else printf("\treference observables: no %s, not checked\n", referenceFname);
+
+	// the baselines are per backend and only compared on the machine and with the threads they were recorded with
+	char baselineFname[512], backend[16];
+	sprintf(fname, "%s/profile.json", pathToOutDir);
+	double stepsPerSecond, cellUpdatesPerSecond, baseline;
+	if (readJsonNumber(fname, "steps_per_second", &stepsPerSecond) == 0
+			&& readJsonNumber(fname, "cell_updates_per_second", &cellUpdatesPerSecond) == 0
+			&& readJsonString(fname, "backend", backend, sizeof(backend)) == 0) {
+		sprintf(baselineFname, "%s/baseline_%s.json", configDirectory, backend);
+		printf("\tthroughput: %.4g steps/s, %.4g cell updates/s", stepsPerSecond, cellUpdatesPerSecond);
+		if (recordBaseline) {
+			bool ok = copyFile(fname, baselineFname) == 0;
+			if (ok) printf(", recorded as the baseline in %s\n", baselineFname);
+			else printf(", could not record %s\tFAILED\n", baselineFname);
+			regressed = regressed || !ok;
+		}
+		else if (readJsonNumber(baselineFname, "cell_updates_per_second", &baseline) != 0 || baseline <= 0)
+			printf(", no baseline %s, not checked (record one with --record-baseline)\n", baselineFname);
+		else if (!isComparableBaseline(fname, baselineFname))
+			printf(", WARNING: %s was recorded on another host or with other threads, not checked\n", baselineFname);
+		else {
+			double ratio = cellUpdatesPerSecond / baseline;
+			bool ok = ratio >= 1 - thresholds.maxThroughputDrop;
+			printf(", %.3f of the baseline\t%s (>= %.3f)\n", ratio, passed(ok), 1 - thresholds.maxThroughputDrop);
+			regressed = regressed || !ok;
+		}
+	}
+	else {
+		printf("\tthroughput: no %s (run with --profile)\tFAILED\n", fname);
+		regressed = true;
+	}
+
+	printf("Regression check %s.\n", regressed ? "FAILED" : "passed");
+	return regressed ? 1 : 0;
+}
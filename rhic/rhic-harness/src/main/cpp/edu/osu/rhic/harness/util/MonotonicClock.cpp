@@ -0,0 +1,15 @@
+/*
+ * MonotonicClock.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <time.h>
+
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
+
+double monotonicTime() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
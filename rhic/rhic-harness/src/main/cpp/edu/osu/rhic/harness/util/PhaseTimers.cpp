@@ -0,0 +1,138 @@
+/*
+ * PhaseTimers.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
+
+static const char * const phaseNames[NUMBER_PHASES] = {
+	"evolution", "time_step", "euler_step", "source_terms", "fluxes", "inferred_variables", "regulation",
+	"ghost_cells", "halo_exchange", "convex_combination", "cfl_time_step", "validity", "observables",
+	"device_to_host", "output"
+};
+
+static bool enabled = false;
+static bool synchronizeDevice = false;
+static double started[NUMBER_PHASES];
+// every duration is kept for the percentiles
+static double *durations[NUMBER_PHASES];
+static int counts[NUMBER_PHASES], capacities[NUMBER_PHASES];
+
+void resetPhaseTimers() {
+	for (int n = 0; n < NUMBER_PHASES; ++n) {
+		free(durations[n]);
+		durations[n] = NULL;
+		counts[n] = capacities[n] = 0;
+	}
+}
+
+void enablePhaseTimers(bool cpu) {
+	enabled = true;
+	synchronizeDevice = !cpu;
+}
+
+void disablePhaseTimers() {
+	enabled = false;
+}
+
+void beginPhase(int phase) {
+	if (!enabled) return;
+	if (synchronizeDevice) cudaDeviceSynchronize();
+	started[phase] = monotonicTime();
+}
+
+void endPhase(int phase) {
+	if (!enabled) return;
+	if (synchronizeDevice) cudaDeviceSynchronize();
+	double elapsed = monotonicTime() - started[phase];
+	if (counts[phase] == capacities[phase]) {
+		capacities[phase] = capacities[phase] > 0 ? 2 * capacities[phase] : 256;
+		durations[phase] = (double *) realloc(durations[phase], capacities[phase] * sizeof(double));
+	}
+	durations[phase][counts[phase]++] = elapsed;
+}
+
+const char * getPhaseName(int phase) {
+	return phaseNames[phase];
+}
+
+static int compareDurations(const void *a, const void *b) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+// nearest rank
+static double percentile(const double * const sorted, int n, double q) {
+	int rank = (int) ceil(q * n);
+	return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+void getPhaseStatistics(int phase, struct PhaseStatistics *stats) {
+	memset(stats, 0, sizeof(struct PhaseStatistics));
+	int n = counts[phase];
+	if (n == 0) return;
+	double *sorted = (double *) malloc(n * sizeof(double));
+	memcpy(sorted, durations[phase], n * sizeof(double));
+	qsort(sorted, n, sizeof(double), compareDurations);
+	stats->count = n;
+	for (int m = 0; m < n; ++m) stats->total += sorted[m];
+	stats->mean = stats->total / n;
+	stats->min = sorted[0];
+	stats->p50 = percentile(sorted, n, 0.5);
+	stats->p90 = percentile(sorted, n, 0.9);
+	stats->p99 = percentile(sorted, n, 0.99);
+	stats->max = sorted[n-1];
+	free(sorted);
+}
+
+int writePhaseReport(const char *fname, const struct PhaseReport * const report) {
+	FILE *fp = fopen(fname, "w");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open %s, the phase timings are not written.\n", fname);
+		return -1;
+	}
+	struct PhaseStatistics evolution, steps;
+	getPhaseStatistics(PHASE_EVOLUTION, &evolution);
+	getPhaseStatistics(PHASE_TIME_STEP, &steps);
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"host\": \"%s\",\n", report->host);
+	fprintf(fp, "  \"threads\": %d,\n", report->threads);
+	fprintf(fp, "  \"backend\": \"%s\",\n", report->backend);
+	fprintf(fp, "  \"precision\": \"%s\",\n", report->precision);
+	fprintf(fp, "  \"time_integrator\": \"%s\",\n", report->timeIntegrator);
+	fprintf(fp, "  \"euler_step\": \"%s\",\n", report->eulerStep);
+	fprintf(fp, "  \"lattice\": [%d, %d, %d],\n", report->lattice[0], report->lattice[1], report->lattice[2]);
+	fprintf(fp, "  \"events\": %d,\n", report->numEvents);
+	fprintf(fp, "  \"wall_time_ms\": %.3f,\n", report->wallTime);
+	fprintf(fp, "  \"evolution_ms\": %.3f,\n", evolution.total);
+	fprintf(fp, "  \"time_steps\": %d,\n", steps.count);
+	double seconds = steps.total / 1000;
+	fprintf(fp, "  \"steps_per_second\": %.6g,\n", seconds > 0 ? steps.count / seconds : 0);
+	fprintf(fp, "  \"cell_updates_per_second\": %.6g,\n", seconds > 0 ? report->cellsPerStep * steps.count / seconds : 0);
+	fprintf(fp, "  \"phases\": {");
+	bool first = true;
+	for (int n = 0; n < NUMBER_PHASES; ++n) {
+		struct PhaseStatistics stats;
+		getPhaseStatistics(n, &stats);
+		if (stats.count == 0) continue;
+		fprintf(fp, "%s\n    \"%s\": {\"count\": %d, \"total_ms\": %.6g, \"mean_ms\": %.6g, \"min_ms\": %.6g, "
+				"\"p50_ms\": %.6g, \"p90_ms\": %.6g, \"p99_ms\": %.6g, \"max_ms\": %.6g, \"fraction\": %.6g}",
+				first ? "" : ",", phaseNames[n], stats.count, stats.total, stats.mean, stats.min,
+				stats.p50, stats.p90, stats.p99, stats.max, evolution.total > 0 ? stats.total / evolution.total : 0);
+		first = false;
+	}
+	fprintf(fp, "\n  }\n}\n");
+	fclose(fp);
+	return 0;
+}
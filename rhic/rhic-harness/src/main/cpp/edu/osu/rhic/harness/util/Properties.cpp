@@ -5,6 +5,8 @@
  *      Author: bazow
  */
 
+#include <string.h>
+
 #include "edu/osu/rhic/harness/util/Properties.h"
 
 void getIntegerProperty(config_t *cfg, const char* propName, int *propValue, int defaultValue) {
@@ -20,3 +22,11 @@ void getDoubleProperty(config_t *cfg, const char* propName, double *propValue, d
 	  else
 	    *propValue = defaultValue;
 }
+
+void getStringProperty(config_t *cfg, const char* propName, char *propValue, size_t length, const char *defaultValue) {
+	  const char *value;
+	  if(!config_lookup_string(cfg, propName, &value))
+	    value = defaultValue;
+	  strncpy(propValue, value, length-1);
+	  propValue[length-1] = '\0';
+}
@@ -26,6 +26,14 @@
 // Parameters put in constant memory
 __constant__ int d_nx,d_ny,d_nz,d_ncx,d_ncy,d_ncz,d_nElements,d_nCompElements;
 __constant__ PRECISION d_dt,d_dx,d_dy,d_dz,d_etabar;
+__constant__ PRECISION d_dtp;
+__constant__ int d_ensembleSize;
+
+// Host copies of the constant memory parameters
+int h_nx,h_ny,h_nz,h_ncx,h_ncy,h_ncz,h_nElements,h_nCompElements;
+PRECISION h_dt,h_dx,h_dy,h_dz,h_etabar;
+PRECISION h_dtp;
+int h_ensembleSize = 1;
 
 // One-dimension kernel launch parameters
 int gridSizeConvexComb, blockSizeConvexComb;
@@ -61,6 +69,7 @@ dim3 BSX,GSX,BSY,GSY,BSZ,GSZ;
 int grid_1D,block_1D,gridX_1D,blockX_1D,gridY_1D,blockY_1D,gridZ_1D,blockZ_1D;
 //===========================================
 
+template <int MODE>
 void initializeCUDALaunchParameters(void * latticeParams) {
 	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
 
@@ -72,14 +81,15 @@ void initializeCUDALaunchParameters(void * latticeParams) {
 
 	// set up CUDA Kernel launch parameters	
 	int len = nx*ny*nz;
-	int len2DI = ny*nz;
+	// the x faces of every event of an ensemble
+	int len2DI = ny*nz*lattice->ensembleSize;
 	int len2DJ = nx*nz;
 	int len2DK = nx*ny;
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeConvexComb, &blockSizeConvexComb, (void*)convexCombinationEulerStepKernel, 0, len);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeInferredVars, &blockSizeInferredVars, (void*)setInferredVariablesKernel, 0, len);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostI, &blockSizeGhostI, (void*)setGhostCellsKernelI, 0, len2DI);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostJ, &blockSizeGhostJ, (void*)setGhostCellsKernelJ, 0, len2DJ);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostK, &blockSizeGhostK, (void*)setGhostCellsKernelK, 0, len2DK);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeConvexComb, &blockSizeConvexComb, (void*)convexCombinationEulerStepKernel<MODE>, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeInferredVars, &blockSizeInferredVars, (void*)setInferredVariablesKernel<MODE>, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostI, &blockSizeGhostI, (void*)setGhostCellsKernelI<MODE>, 0, len2DI);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostJ, &blockSizeGhostJ, (void*)setGhostCellsKernelJ<MODE>, 0, len2DJ);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeGhostK, &blockSizeGhostK, (void*)setGhostCellsKernelK<MODE>, 0, len2DK);
 	gridSizeConvexComb = (len + blockSizeConvexComb - 1) / blockSizeConvexComb;
 	gridSizeInferredVars = (len + blockSizeInferredVars - 1) / blockSizeInferredVars;
 	gridSizeGhostI = (len2DI + blockSizeGhostI - 1) / blockSizeGhostI;
@@ -95,29 +105,29 @@ void initializeCUDALaunchParameters(void * latticeParams) {
 
 	/***************************************************************************************************************/
 	// Number of threads to launch for regularization kernel
-#ifndef IDEAL
-	int minGridSizeReg;
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeReg, &blockSizeReg, (void*)regulateDissipativeCurrents, 0, len);
-	gridSizeReg = (len + blockSizeReg - 1)/blockSizeReg;
-	printf("blockSizeReg= %d\n", blockSizeReg);
-#endif
-	/***************************************************************************************************************\
+	if (EVOLVE_PIMUNU(MODE)) {
+		int minGridSizeReg;
+		cudaOccupancyMaxPotentialBlockSize(&minGridSizeReg, &blockSizeReg, (void*)regulateDissipativeCurrents, 0, len);
+		gridSizeReg = (len + blockSizeReg - 1)/blockSizeReg;
+		printf("blockSizeReg= %d\n", blockSizeReg);
+	}
+	/***************************************************************************************************************/
 
-	/***************************************************************************************************************\
+	/***************************************************************************************************************/
 	// Number of threads to launch for 3D fused kernels
 	int minGridSizeEuler_fused_3D, block_fused_3D;
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_fused_3D, &block_fused_3D, (void*)eulerStepKernel, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_fused_3D, &block_fused_3D, (void*)eulerStepKernelFused<MODE, LATTICE_3D>, 0, len);
 	printf("blockSizeEuler_fused_3D= %d\n", block_fused_3D);
 	GF = dim3((nx + BF.x - 1)/BF.x, (ny + BF.y - 1)/BF.y, (nz + BF.z - 1)/BF.z);	
-	/***************************************************************************************************************\
+	/***************************************************************************************************************/
 
-	/***************************************************************************************************************\
+	/***************************************************************************************************************/
 	// Number of threads to launch for 1D fused kernels
 	int minGridSizeEuler_fused_1D;
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_fused_1D, &block_fused_1D, (void*)eulerStepKernel_1D, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_fused_1D, &block_fused_1D, (void*)eulerStepKernelFused_1D<MODE, LATTICE_3D>, 0, len);
 	grid_fused_1D = (len + block_fused_1D - 1)/ block_fused_1D;
 	printf("blockSizeEuler_fused_1D= %d\n", block_fused_1D);
-	/***************************************************************************************************************\
+	/***************************************************************************************************************/
 
 	/***************************************************************************************************************/
 	// Number of threads to launch for 3D kernels
@@ -136,13 +146,13 @@ void initializeCUDALaunchParameters(void * latticeParams) {
 	// print max potential block size from occupancy
 	printf("===================================================\n");
 	int minGridSizeEuler_3D,blockSizeEuler_3D;
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelSource, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelSource<MODE, LATTICE_3D>, 0, len);
 	printf("blockSizeEulerSource_3D= %d\n", blockSizeEuler_3D);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelX, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelX<MODE>, 0, len);
 	printf("blockSizeEulerX_3D= %d\n", blockSizeEuler_3D);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelY, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelY<MODE>, 0, len);
 	printf("blockSizeEulerY_3D= %d\n", blockSizeEuler_3D);
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelZ, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_3D, &blockSizeEuler_3D, (void*)eulerStepKernelZ<MODE>, 0, len);
 	printf("blockSizeEulerZ_3D= %d\n", blockSizeEuler_3D);
 	printf("B = (%d, %d, %d),\tTotal blocks = %d\n", block.x, block.y, block.z, block.x*block.y*block.z);
 	printf("BX = (%d, %d, %d),\tTotal blocks = %d\n", block_X.x, block_X.y, block_X.z, block_X.x*block_X.y*block_X.z);
@@ -185,16 +195,16 @@ void initializeCUDALaunchParameters(void * latticeParams) {
 	// Number of threads to launch for 1D kernels
 	int minGridSizeEuler_1D;
 	// source
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &block_1D, (void*)eulerStepKernelSource_1D, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &block_1D, (void*)eulerStepKernelSource_1D<MODE, LATTICE_3D>, 0, len);
 	grid_1D = (len + block_1D - 1)/ block_1D;
 	// X
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockX_1D, (void*)eulerStepKernelX_1D, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockX_1D, (void*)eulerStepKernelX_1D<MODE>, 0, len);
 	gridX_1D = (len + blockX_1D - 1)/ blockX_1D;
 	// Y
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockY_1D, (void*)eulerStepKernelY_1D, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockY_1D, (void*)eulerStepKernelY_1D<MODE>, 0, len);
 	gridY_1D = (len + blockY_1D - 1)/ blockY_1D;
 	// Z
-	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockZ_1D, (void*)eulerStepKernelZ_1D, 0, len);
+	cudaOccupancyMaxPotentialBlockSize(&minGridSizeEuler_1D, &blockZ_1D, (void*)eulerStepKernelZ_1D<MODE>, 0, len);
 	gridZ_1D = (len + blockZ_1D - 1)/ blockZ_1D;
 
 	printf("===================================================\n");
@@ -206,6 +216,10 @@ void initializeCUDALaunchParameters(void * latticeParams) {
 	printf("===================================================\n");
 }
 
+#define INSTANTIATE_LAUNCH_PARAMETERS(MODE) \
+template void initializeCUDALaunchParameters<MODE>(void * latticeParams);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_LAUNCH_PARAMETERS)
+
 void initializeCUDAConstantParameters(void * latticeParams, void * initCondParams, void * hydroParams) {
 	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
 	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
@@ -241,8 +255,49 @@ void initializeCUDAConstantParameters(void * latticeParams, void * initCondParam
 	cudaMemcpyToSymbol(d_nCompElements, &nCompElements, sizeof(nCompElements), 0, cudaMemcpyHostToDevice);
 
 	cudaMemcpyToSymbol(d_dt, &dt, sizeof(dt), 0, cudaMemcpyHostToDevice);
+	cudaMemcpyToSymbol(d_dtp, &dt, sizeof(dt), 0, cudaMemcpyHostToDevice);
 	cudaMemcpyToSymbol(d_dx, &dx, sizeof(dx), 0, cudaMemcpyHostToDevice);
 	cudaMemcpyToSymbol(d_dy, &dy, sizeof(dy), 0, cudaMemcpyHostToDevice);
 	cudaMemcpyToSymbol(d_dz, &dz, sizeof(dz), 0, cudaMemcpyHostToDevice);
 	cudaMemcpyToSymbol(d_etabar, &etabar, sizeof(etabar), 0, cudaMemcpyHostToDevice);
+	cudaMemcpyToSymbol(d_ensembleSize, &lattice->ensembleSize, sizeof(int), 0, cudaMemcpyHostToDevice);
+
+	initializeHostConstantParameters(latticeParams, initCondParams, hydroParams);
+}
+
+void initializeHostConstantParameters(void * latticeParams, void * initCondParams, void * hydroParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	struct HydroParameters * hydro = (struct HydroParameters *) hydroParams;
+
+	h_nx = lattice->numLatticePointsX;
+	h_ny = lattice->numLatticePointsY;
+	h_nz = lattice->numLatticePointsRapidity;
+	h_ncx = lattice->numComputationalLatticePointsX;
+	h_ncy = lattice->numComputationalLatticePointsY;
+	h_ncz = lattice->numComputationalLatticePointsRapidity;
+
+	h_dt = (PRECISION)(lattice->latticeSpacingProperTime);
+	h_dtp = h_dt;
+	h_dx = (PRECISION)(lattice->latticeSpacingX);
+	h_dy = (PRECISION)(lattice->latticeSpacingY);
+	h_dz = (PRECISION)(lattice->latticeSpacingRapidity);
+
+	h_etabar = (PRECISION)(hydro->shearViscosityToEntropyDensity);
+
+	h_nCompElements = h_ncx * h_ncy * h_ncz;
+	h_nElements = h_nx * h_ny * h_nz;
+
+	h_ensembleSize = lattice->ensembleSize;
+}
+
+void setTimeStep(PRECISION dt, bool host) {
+	if (dt == h_dt) return;
+	h_dt = dt;
+	if (!host) cudaMemcpyToSymbol(d_dt, &dt, sizeof(dt), 0, cudaMemcpyHostToDevice);
+}
+
+void setPreviousTimeStep(PRECISION dtp, bool host) {
+	if (dtp == h_dtp) return;
+	h_dtp = dtp;
+	if (!host) cudaMemcpyToSymbol(d_dtp, &dtp, sizeof(dtp), 0, cudaMemcpyHostToDevice);
 }
@@ -25,6 +25,8 @@ TEST(loadHydroParameters, HyrdoParametersFromConfFile) {
 	config_destroy(&config);
 	EXPECT_EQ(0.5, params.initialProperTimePoint);
 	EXPECT_EQ(0.2, params.shearViscosityToEntropyDensity);
+	EXPECT_EQ(SHEAR_HYDRO, params.physicsMode);
+	EXPECT_EQ(FREEZEOUT_MAXIMUM, params.freezeoutCriterion);
 }
 
 TEST(loadHydroParameters, DefaultHyrdoParameters) {
@@ -35,4 +37,6 @@ TEST(loadHydroParameters, DefaultHyrdoParameters) {
 	config_destroy(&config);
 	EXPECT_EQ(0.1, params.initialProperTimePoint);
 	EXPECT_EQ(0.0795775, params.shearViscosityToEntropyDensity);
+	EXPECT_EQ(IDEAL_HYDRO, params.physicsMode);
+	EXPECT_EQ(FREEZEOUT_CENTER, params.freezeoutCriterion);
 }
@@ -0,0 +1,91 @@
+/*
+ * HydroPluginTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+#include <string.h>
+
+#include "edu/osu/rhic/harness/hydro/HydroPlugin.h"
+#include "edu/osu/rhic/harness/io/OutputParameters.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/trunk/hydro/RegulateDissipativeCurrents.cuh"
+#include "edu/osu/rhic/trunk/hydro/HydrodynamicValidity.cuh"
+
+static void setOutputFields(struct OutputParameters *output, const char *first, const char *second) {
+	output->numOutputFields = 2;
+	strcpy(output->outputFields[0], first);
+	strcpy(output->outputFields[1], second);
+}
+
+/*
+ * Allocates a single cell lattice, with the validity domain if the output fields ask for it as in run(), and sets
+ * a fluid at rest with a shear stress large enough to be regulated in every cell, ghost cells included.
+ */
+static int allocateShearLattice(const struct OutputParameters *output) {
+	h_nx = h_ny = h_nz = 1;
+	h_ncx = h_ncy = h_ncz = 1 + N_GHOST_CELLS;
+	h_nElements = 1;
+	h_nCompElements = h_ncx * h_ncy * h_ncz;
+	h_dx = h_dy = h_dz = (PRECISION) 0.1;
+	h_dt = h_dtp = (PRECISION) 0.01;
+	h_etabar = (PRECISION) 0.2;
+	int len = h_nCompElements;
+	allocateHostMemory(len);
+	if (writesValidityFields(output)) allocateValidityDomainHostMemory(len);
+	for (int s = 0; s < len; ++s) {
+		e[s] = 1;
+		p[s] = (PRECISION) 1 / 3;
+		u->ut[s] = 1;
+		q->pixx[s] = 10;
+		q->piyy[s] = -10;
+	}
+	return len;
+}
+
+TEST(HydroPlugin, ValidityDomainOnlyForValidityFields) {
+	int savedPhysicsMode = physicsMode;
+	int savedDimensions = latticeDimensions;
+	physicsMode = SHEAR_HYDRO;
+	latticeDimensions = LATTICE_1D;
+	int center = columnMajorLinearIndex(N_GHOST_CELLS_M, N_GHOST_CELLS_M, N_GHOST_CELLS_M, 1 + N_GHOST_CELLS, 1 + N_GHOST_CELLS);
+	PRECISION t = (PRECISION) 0.6;
+
+	// no validity field: nothing is allocated and the regulation leaves the validity domain alone
+	struct OutputParameters output;
+	setOutputFields(&output, "e", "pixx");
+	EXPECT_FALSE(writesValidityFields(&output));
+	allocateShearLattice(&output);
+	EXPECT_TRUE(validityDomain->regulations == NULL);
+	EXPECT_TRUE(validityDomain->inverseReynoldsNumberPimunu == NULL);
+	EXPECT_TRUE(validityDomain->theta == NULL);
+	regulateDissipativeCurrentsHost(t, q, e, p, u, validityDomain, N_GHOST_CELLS_M, N_GHOST_CELLS_M + 1);
+	PRECISION regulatedPixx = q->pixx[center];
+	EXPECT_LT(regulatedPixx, 10);
+	EXPECT_GT(regulatedPixx, 0);
+	EXPECT_TRUE(validityDomain->regulations == NULL);
+	freeHostMemory();
+
+	// a validity field: the arrays are allocated, the regulation records its factor and the check at an output step fills them
+	setOutputFields(&output, "e", "regulations");
+	EXPECT_TRUE(writesValidityFields(&output));
+	int len = allocateShearLattice(&output);
+	ASSERT_TRUE(validityDomain->regulations != NULL);
+	ASSERT_TRUE(validityDomain->inverseReynoldsNumberPimunu != NULL);
+	for (int s = 0; s < len; ++s) EXPECT_EQ(1, validityDomain->regulations[s]);
+	regulateDissipativeCurrentsHost(t, q, e, p, u, validityDomain, N_GHOST_CELLS_M, N_GHOST_CELLS_M + 1);
+	EXPECT_EQ(regulatedPixx, q->pixx[center]);
+	EXPECT_FLOAT_EQ(regulatedPixx / 10, validityDomain->regulations[center]);
+	checkValidityHost<SHEAR_HYDRO>(t, validityDomain, q, e, p, u, u);
+	// sqrt(pi^{\mu\nu} pi_{\mu\nu}) / p
+	EXPECT_FLOAT_EQ(sqrt(2 * regulatedPixx * regulatedPixx) * 3, validityDomain->inverseReynoldsNumberPimunu[center]);
+	EXPECT_GT(validityDomain->taupi[center], 0);
+	freeHostMemory();
+
+	physicsMode = savedPhysicsMode;
+	latticeDimensions = savedDimensions;
+}
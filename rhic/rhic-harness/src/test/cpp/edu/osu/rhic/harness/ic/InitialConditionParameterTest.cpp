@@ -31,6 +31,9 @@ TEST(loadInitialConditionParameters, InitialConditionParametersFromConfFile) {
 	EXPECT_EQ(0.1, params.fractionOfBinaryCollisions);
 	EXPECT_EQ(0.2, params.rapidityVariance);
 	EXPECT_EQ(0.3, params.rapidityMean);
+	EXPECT_EQ(12345, params.randomSeed);
+	EXPECT_EQ(6, params.eventIndex);
+	EXPECT_EQ(1.5, params.depositionCutoffRadius);
 }
 
 TEST(loadInitialConditionParameters, DefaultInitialConditionParameters) {
@@ -47,4 +50,35 @@ TEST(loadInitialConditionParameters, DefaultInitialConditionParameters) {
 	EXPECT_EQ(0.5, params.fractionOfBinaryCollisions);
 	EXPECT_EQ(0.5, params.rapidityVariance);
 	EXPECT_EQ(0.5, params.rapidityMean);
+	EXPECT_EQ(1328398221, params.randomSeed);
+	EXPECT_EQ(0, params.eventIndex);
+	EXPECT_EQ(2.76, params.depositionCutoffRadius);
+}
+
+TEST(loadInitialConditionEvents, EventsOverrideConfFile) {
+	struct InitialConditionParameters params;
+	config_t config;
+	config_init(&config);
+
+	char *rootDirectory = NULL;
+	size_t size;
+	char pathToConfigFile[255], pathToEventList[255];
+	rootDirectory = getcwd(rootDirectory,size);
+	sprintf(pathToConfigFile, "%s/rhic/rhic-harness/src/test/resources", rootDirectory);
+	sprintf(pathToEventList, "%s/events.list", pathToConfigFile);
+	loadInitialConditionParameters(&config, pathToConfigFile, &params);
+	config_destroy(&config);
+
+	struct InitialConditionParameters *events;
+	EXPECT_EQ(2, loadInitialConditionEvents(pathToEventList, &params, &events));
+	EXPECT_EQ(12345, events[0].randomSeed);
+	EXPECT_EQ(7, events[0].eventIndex);
+	EXPECT_EQ(20.0, events[0].impactParameter);
+	EXPECT_EQ(99, events[1].randomSeed);
+	EXPECT_EQ(6, events[1].eventIndex);
+	EXPECT_EQ(2.5, events[1].impactParameter);
+	// the settings that are not overridden
+	EXPECT_EQ(63, events[1].numberOfNucleonsPerNuclei);
+	EXPECT_EQ(1.5, events[1].depositionCutoffRadius);
+	free(events);
 }
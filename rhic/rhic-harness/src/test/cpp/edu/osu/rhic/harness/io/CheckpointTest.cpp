@@ -0,0 +1,88 @@
+/*
+ * CheckpointTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/io/Checkpoint.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+
+static void setLattice(struct LatticeParameters *lattice, int n) {
+	lattice->numLatticePointsX = n;
+	lattice->numLatticePointsY = n;
+	lattice->numLatticePointsRapidity = 1;
+	lattice->numComputationalLatticePointsX = n + N_GHOST_CELLS;
+	lattice->numComputationalLatticePointsY = n + N_GHOST_CELLS;
+	lattice->numComputationalLatticePointsRapidity = 1 + N_GHOST_CELLS;
+	lattice->latticeSpacingProperTime = 0.01;
+	lattice->adaptiveTimeStep = 0;
+	strcpy(lattice->timeIntegrator, "rk2");
+}
+
+TEST(Checkpoint, RestoresStateExactly) {
+	int savedPhysicsMode = physicsMode;
+	physicsMode = SHEAR_BULK_HYDRO;
+
+	struct LatticeParameters lattice;
+	setLattice(&lattice, 3);
+	int len = (3 + N_GHOST_CELLS) * (3 + N_GHOST_CELLS) * (1 + N_GHOST_CELLS);
+	allocateHostMemory(len);
+	allocateIntermediateHostMemory(len);
+
+	PRECISION *arrays[] = {e, p, u->ut, u->ux, u->uy, u->un, h_up->ut, h_up->ux, h_up->uy, h_up->un,
+			q->ttt, q->ttx, q->tty, q->ttn, q->pitt, q->pitx, q->pity, q->pitn, q->pixx, q->pixy, q->pixn,
+			q->piyy, q->piyn, q->pinn, q->Pi};
+	const int numArrays = sizeof(arrays) / sizeof(arrays[0]);
+	for (int n = 0; n < numArrays; ++n)
+		for (int s = 0; s < len; ++s) arrays[n][s] = (PRECISION) 1 / (3 + n * len + s);
+
+	char outputDir[] = "/tmp/checkpointXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+	ASSERT_EQ(0, writeCheckpoint(outputDir, 42, 0.52, 0.007, &lattice, q, e, p, u, h_up));
+
+	for (int n = 0; n < numArrays; ++n)
+		for (int s = 0; s < len; ++s) arrays[n][s] = 0;
+
+	char fname[255];
+	sprintf(fname, "%s/checkpoint.bin", outputDir);
+	int step;
+	double t, dtp;
+	ASSERT_EQ(0, readCheckpoint(fname, &step, &t, &dtp, &lattice, q, e, p, u, h_up));
+	EXPECT_EQ(42, step);
+	EXPECT_EQ(0.52, t);
+	EXPECT_EQ(0.007, dtp);
+	// ghost cells included
+	for (int n = 0; n < numArrays; ++n)
+		for (int s = 0; s < len; ++s) EXPECT_EQ((PRECISION) 1 / (3 + n * len + s), arrays[n][s]);
+
+	// a checkpoint of another run is rejected
+	struct LatticeParameters otherLattice;
+	setLattice(&otherLattice, 4);
+	EXPECT_NE(0, readCheckpoint(fname, &step, &t, &dtp, &otherLattice, q, e, p, u, h_up));
+	physicsMode = SHEAR_HYDRO;
+	EXPECT_NE(0, readCheckpoint(fname, &step, &t, &dtp, &lattice, q, e, p, u, h_up));
+	physicsMode = SHEAR_BULK_HYDRO;
+	int savedStrategy = eulerStepStrategy;
+	eulerStepStrategy = (savedStrategy + 1) % NUMBER_EULER_STEP_STRATEGIES;
+	EXPECT_NE(0, readCheckpoint(fname, &step, &t, &dtp, &lattice, q, e, p, u, h_up));
+	eulerStepStrategy = savedStrategy;
+	otherLattice = lattice;
+	otherLattice.adaptiveTimeStep = 1;
+	otherLattice.cflNumber = 0.5;
+	EXPECT_NE(0, readCheckpoint(fname, &step, &t, &dtp, &otherLattice, q, e, p, u, h_up));
+	otherLattice = lattice;
+	strcpy(otherLattice.timeIntegrator, "ssp_rk3");
+	EXPECT_NE(0, readCheckpoint(fname, &step, &t, &dtp, &otherLattice, q, e, p, u, h_up));
+
+	unlink(fname);
+	rmdir(outputDir);
+	freeIntermediateHostMemory();
+	freeHostMemory();
+	physicsMode = savedPhysicsMode;
+}
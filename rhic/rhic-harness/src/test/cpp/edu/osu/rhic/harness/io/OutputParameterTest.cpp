@@ -0,0 +1,60 @@
+/*
+ * OutputParameterTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <libconfig.h>
+#include<unistd.h>
+
+#include "edu/osu/rhic/harness/io/OutputParameters.h"
+
+TEST(loadOutputParameters, OutputParametersFromConfFile) {
+	struct OutputParameters params;
+	config_t config;
+	config_init(&config);
+
+	char *rootDirectory = NULL;
+	size_t size;
+	char pathToConfigFile[255];
+	rootDirectory = getcwd(rootDirectory,size);
+	sprintf(pathToConfigFile, "%s/rhic/rhic-harness/src/test/resources", rootDirectory);
+	loadOutputParameters(&config, pathToConfigFile, &params);
+	config_destroy(&config);
+	EXPECT_EQ(5, params.outputFrequency);
+	EXPECT_EQ(0.25, params.outputTimeInterval);
+	EXPECT_EQ(SNAPSHOT_ETA_SLICE, params.outputRegion);
+	EXPECT_EQ(2, params.outputStride);
+	EXPECT_EQ(100, params.checkpointFrequency);
+	ASSERT_EQ(3, params.numOutputFields);
+	EXPECT_STREQ("e", params.outputFields[0]);
+	EXPECT_STREQ("ux", params.outputFields[1]);
+	EXPECT_STREQ("pitt", params.outputFields[2]);
+	EXPECT_EQ(TIME_SERIES_BINARY, params.observablesFormat);
+	EXPECT_EQ(3, params.observablesFrequency);
+	ASSERT_EQ(2, params.numProbes);
+	EXPECT_STREQ("center", params.probeNames[0]);
+	EXPECT_STREQ("edge", params.probeNames[1]);
+	EXPECT_EQ(4.5, params.probePositions[1][0]);
+	EXPECT_EQ(-1, params.probePositions[1][1]);
+	EXPECT_EQ(0.5, params.probePositions[1][2]);
+}
+
+TEST(loadOutputParameters, DefaultOutputParameters) {
+	struct OutputParameters params;
+	config_t config;
+	config_init(&config);
+	loadOutputParameters(&config, "", &params);
+	config_destroy(&config);
+	EXPECT_EQ(10, params.outputFrequency);
+	EXPECT_EQ(0, params.outputTimeInterval);
+	EXPECT_EQ(SNAPSHOT_FULL_GRID, params.outputRegion);
+	EXPECT_EQ(1, params.outputStride);
+	EXPECT_EQ(0, params.checkpointFrequency);
+	EXPECT_EQ(30, params.numOutputFields);
+	EXPECT_STREQ("e", params.outputFields[0]);
+	EXPECT_STREQ("theta", params.outputFields[29]);
+	EXPECT_EQ(TIME_SERIES_NONE, params.observablesFormat);
+	EXPECT_EQ(0, params.numProbes);
+}
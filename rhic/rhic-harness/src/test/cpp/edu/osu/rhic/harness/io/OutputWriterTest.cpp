@@ -0,0 +1,60 @@
+/*
+ * OutputWriterTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/io/OutputWriter.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+TEST(OutputWriter, WritesEveryQueuedSnapshot) {
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = 4;
+	lattice.numLatticePointsY = 3;
+	lattice.numLatticePointsRapidity = 1;
+	lattice.numComputationalLatticePointsX = 4 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsY = 3 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsRapidity = 1 + N_GHOST_CELLS;
+	lattice.latticeSpacingX = 0.1;
+	lattice.latticeSpacingY = 0.1;
+	lattice.latticeSpacingRapidity = 0.1;
+
+	int len = (4 + N_GHOST_CELLS) * (3 + N_GHOST_CELLS) * (1 + N_GHOST_CELLS);
+	PRECISION *a = (PRECISION *) calloc(len, sizeof(PRECISION));
+
+	char outputDir[] = "/tmp/outputWriterXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+
+	struct OutputWriter writer;
+	ASSERT_EQ(0, startOutputWriter(&writer, outputDir, &lattice, NULL));
+	// more snapshots than buffers, so that acquireOutputBuffer has to wait for the writer thread
+	const int numSnapshots = 3 * OUTPUT_WRITER_BUFFERS;
+	for (int n = 0; n < numSnapshots; ++n) {
+		for (int s = 0; s < len; ++s) a[s] = (PRECISION) (n * len + s);
+		struct OutputBuffer *buffer = acquireOutputBuffer(&writer, (double) n);
+		EXPECT_EQ(0, addOutputField(&writer, buffer, "a", a));
+		submitOutputBuffer(&writer, buffer);
+	}
+	EXPECT_EQ(0, stopOutputWriter(&writer));
+
+	for (int n = 0; n < numSnapshots; ++n) {
+		char fname[255];
+		sprintf(fname, "%s/snapshot_%.3f.bin", outputDir, (double) n);
+		struct Snapshot snapshot;
+		ASSERT_EQ(0, openSnapshot(fname, &snapshot));
+		EXPECT_EQ((double) n, snapshot.header->t);
+		const float *mapped = getSnapshotField(&snapshot, "a");
+		ASSERT_TRUE(mapped != NULL);
+		// the values staged for this step, not those of a later step
+		int s = columnMajorLinearIndex(N_GHOST_CELLS_M, N_GHOST_CELLS_M, N_GHOST_CELLS_M, 4 + N_GHOST_CELLS, 3 + N_GHOST_CELLS);
+		EXPECT_EQ((float) (n * len + s), mapped[0]);
+		closeSnapshot(&snapshot);
+		unlink(fname);
+	}
+	rmdir(outputDir);
+	free(a);
+}
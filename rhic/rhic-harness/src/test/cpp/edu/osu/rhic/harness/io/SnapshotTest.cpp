@@ -0,0 +1,158 @@
+/*
+ * SnapshotTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+TEST(Snapshot, WriteAndMapSnapshot) {
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = 3;
+	lattice.numLatticePointsY = 2;
+	lattice.numLatticePointsRapidity = 2;
+	lattice.numComputationalLatticePointsX = 3 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsY = 2 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsRapidity = 2 + N_GHOST_CELLS;
+	lattice.latticeSpacingX = 0.1;
+	lattice.latticeSpacingY = 0.2;
+	lattice.latticeSpacingRapidity = 0.3;
+
+	int len = (3 + N_GHOST_CELLS) * (2 + N_GHOST_CELLS) * (2 + N_GHOST_CELLS);
+	PRECISION *a = (PRECISION *) calloc(len, sizeof(PRECISION));
+	PRECISION *b = (PRECISION *) calloc(len, sizeof(PRECISION));
+	for (int s = 0; s < len; ++s) {
+		a[s] = (PRECISION) s;
+		b[s] = (PRECISION) -s;
+	}
+
+	char outputDir[] = "/tmp/snapshotXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+
+	struct SnapshotWriter writer;
+	ASSERT_EQ(0, openSnapshotWriter(&writer, 1.5, outputDir, &lattice, NULL));
+	EXPECT_EQ(0, writeSnapshotField(&writer, "a", a));
+	EXPECT_EQ(0, writeSnapshotField(&writer, "b", b));
+	EXPECT_EQ(0, closeSnapshotWriter(&writer));
+
+	char fname[255];
+	sprintf(fname, "%s/snapshot_%.3f.bin", outputDir, 1.5);
+	struct Snapshot snapshot;
+	ASSERT_EQ(0, openSnapshot(fname, &snapshot));
+	EXPECT_EQ(2u, snapshot.header->numFields);
+	EXPECT_EQ(3, snapshot.header->nx);
+	EXPECT_EQ(2, snapshot.header->ny);
+	EXPECT_EQ(2, snapshot.header->nz);
+	EXPECT_EQ(1.5, snapshot.header->t);
+	EXPECT_EQ(0.2, snapshot.header->dy);
+
+	const float *mappedA = getSnapshotField(&snapshot, "a");
+	const float *mappedB = getSnapshotField(&snapshot, "b");
+	ASSERT_TRUE(mappedA != NULL);
+	ASSERT_TRUE(mappedB != NULL);
+	EXPECT_TRUE(getSnapshotField(&snapshot, "c") == NULL);
+	EXPECT_EQ(0u, snapshot.fields[0].offset % SNAPSHOT_ALIGNMENT);
+	EXPECT_EQ(0u, snapshot.fields[1].offset % SNAPSHOT_ALIGNMENT);
+
+	// ghost cells are stripped and x runs fastest
+	int n = 0;
+	for (int k = N_GHOST_CELLS_M; k < 2 + N_GHOST_CELLS_M; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < 2 + N_GHOST_CELLS_M; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < 3 + N_GHOST_CELLS_M; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, 3 + N_GHOST_CELLS, 2 + N_GHOST_CELLS);
+				EXPECT_EQ((float) a[s], mappedA[n]);
+				EXPECT_EQ((float) b[s], mappedB[n]);
+				++n;
+			}
+		}
+	}
+	closeSnapshot(&snapshot);
+
+	unlink(fname);
+	rmdir(outputDir);
+	free(a);
+	free(b);
+}
+
+TEST(Snapshot, WriteSubsampledSlice) {
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = 7;
+	lattice.numLatticePointsY = 6;
+	lattice.numLatticePointsRapidity = 3;
+	lattice.numComputationalLatticePointsX = 7 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsY = 6 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsRapidity = 3 + N_GHOST_CELLS;
+	lattice.latticeSpacingX = 0.5;
+	lattice.latticeSpacingY = 0.5;
+	lattice.latticeSpacingRapidity = 0.25;
+
+	int len = (7 + N_GHOST_CELLS) * (6 + N_GHOST_CELLS) * (3 + N_GHOST_CELLS);
+	PRECISION *a = (PRECISION *) calloc(len, sizeof(PRECISION));
+	for (int s = 0; s < len; ++s) a[s] = (PRECISION) s;
+
+	// every other cell of the eta = 0 plane, symmetric about x = 0
+	struct SnapshotRegion region;
+	setSnapshotRegion(&region, &lattice, SNAPSHOT_ETA_SLICE, 2);
+	EXPECT_EQ(4, region.nx);
+	EXPECT_EQ(3, region.ny);
+	EXPECT_EQ(1, region.nz);
+	EXPECT_EQ(0, region.j0);
+	EXPECT_EQ(1, region.k0);
+
+	char outputDir[] = "/tmp/snapshotXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+	struct SnapshotWriter writer;
+	ASSERT_EQ(0, openSnapshotWriter(&writer, 2.0, outputDir, &lattice, &region));
+	EXPECT_EQ(0, writeSnapshotField(&writer, "a", a));
+	EXPECT_EQ(0, closeSnapshotWriter(&writer));
+
+	char fname[255];
+	sprintf(fname, "%s/snapshot_%.3f.bin", outputDir, 2.0);
+	struct Snapshot snapshot;
+	ASSERT_EQ(0, openSnapshot(fname, &snapshot));
+	EXPECT_EQ(4, snapshot.header->nx);
+	EXPECT_EQ(1.0, snapshot.header->dx);
+	EXPECT_EQ(-1.5, snapshot.header->x0);
+	EXPECT_EQ(0.0, snapshot.header->z0);
+	// an even number of cells cannot be sub-sampled symmetrically, the origin records the offset
+	EXPECT_EQ(-1.25, snapshot.header->y0);
+
+	const float *mapped = getSnapshotField(&snapshot, "a");
+	ASSERT_TRUE(mapped != NULL);
+	int s = columnMajorLinearIndex(N_GHOST_CELLS_M + 2, N_GHOST_CELLS_M + region.j0 + 2, N_GHOST_CELLS_M + 1,
+			7 + N_GHOST_CELLS, 6 + N_GHOST_CELLS);
+	EXPECT_EQ((float) a[s], mapped[1 + 4*1]);
+	closeSnapshot(&snapshot);
+
+	unlink(fname);
+	rmdir(outputDir);
+	free(a);
+}
+
+TEST(Snapshot, FieldDeviation) {
+	float reference[4] = {1, -4, 2, 0};
+	float var[4] = {1, -4, 2, 0};
+	struct SnapshotDeviation deviation;
+	snapshotFieldDeviation(var, reference, 4, &deviation);
+	EXPECT_EQ(0, deviation.deviation);
+	// relative to the largest magnitude on either side
+	var[2] = 3;
+	snapshotFieldDeviation(var, reference, 4, &deviation);
+	EXPECT_DOUBLE_EQ(1, deviation.difference);
+	EXPECT_DOUBLE_EQ(0.25, deviation.deviation);
+	var[1] = -8;
+	snapshotFieldDeviation(var, reference, 4, &deviation);
+	EXPECT_DOUBLE_EQ(0.5, deviation.deviation);
+	var[3] = NAN;
+	snapshotFieldDeviation(var, reference, 4, &deviation);
+	EXPECT_EQ(INFINITY, deviation.deviation);
+	reference[3] = NAN;
+	snapshotFieldDeviation(var, reference, 4, &deviation);
+	EXPECT_DOUBLE_EQ(0.5, deviation.deviation);
+}
@@ -0,0 +1,72 @@
+/*
+ * TimeSeriesTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/io/TimeSeries.h"
+
+TEST(TimeSeries, AppendedRowsKeepTheHeader) {
+	char outputDir[] = "/tmp/timeSeriesXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+	const char *names[2] = { "t", "e_max" };
+	double rows[3][2] = { { 1, 2.5 }, { 1.1, 2.25 }, { 1.2, 2 } };
+	char fname[255];
+
+	sprintf(fname, "%s/observables.csv", outputDir);
+	struct TimeSeries series;
+	ASSERT_EQ(0, openTimeSeries(&series, fname, TIME_SERIES_CSV, 2, names, false));
+	writeTimeSeriesRow(&series, rows[0]);
+	writeTimeSeriesRow(&series, rows[1]);
+	closeTimeSeries(&series);
+	ASSERT_EQ(0, openTimeSeries(&series, fname, TIME_SERIES_CSV, 2, names, true));
+	writeTimeSeriesRow(&series, rows[2]);
+	closeTimeSeries(&series);
+	FILE *fp = fopen(fname, "r");
+	char text[256];
+	size_t length = fread(text, 1, sizeof(text) - 1, fp);
+	text[length] = '\0';
+	fclose(fp);
+	EXPECT_STREQ("t,e_max\n1,2.5\n1.1,2.25\n1.2,2\n", text);
+	struct TimeSeriesTable table;
+	ASSERT_EQ(0, readTimeSeries(fname, &table));
+	EXPECT_EQ(2, table.numColumns);
+	EXPECT_EQ(3, table.numRows);
+	EXPECT_EQ(1, getTimeSeriesColumn(&table, "e_max"));
+	EXPECT_EQ(-1, getTimeSeriesColumn(&table, "e_min"));
+	EXPECT_EQ(1.1, table.values[2]);
+	EXPECT_EQ(2, table.values[5]);
+	freeTimeSeriesTable(&table);
+	unlink(fname);
+
+	sprintf(fname, "%s/observables.bin", outputDir);
+	ASSERT_EQ(0, openTimeSeries(&series, fname, TIME_SERIES_BINARY, 2, names, false));
+	writeTimeSeriesRow(&series, rows[0]);
+	closeTimeSeries(&series);
+	ASSERT_EQ(0, openTimeSeries(&series, fname, TIME_SERIES_BINARY, 2, names, true));
+	writeTimeSeriesRow(&series, rows[1]);
+	closeTimeSeries(&series);
+	fp = fopen(fname, "rb");
+	char magic[8], name[TIME_SERIES_NAME_LENGTH];
+	uint32_t numColumns;
+	double values[4];
+	ASSERT_EQ(8u, fread(magic, 1, 8, fp));
+	EXPECT_EQ(0, memcmp(magic, TIME_SERIES_MAGIC, 8));
+	ASSERT_EQ(1u, fread(&numColumns, sizeof(numColumns), 1, fp));
+	EXPECT_EQ(2u, numColumns);
+	ASSERT_EQ(1u, fread(name, TIME_SERIES_NAME_LENGTH, 1, fp));
+	EXPECT_STREQ("t", name);
+	ASSERT_EQ(1u, fread(name, TIME_SERIES_NAME_LENGTH, 1, fp));
+	EXPECT_STREQ("e_max", name);
+	ASSERT_EQ(4u, fread(values, sizeof(double), 4, fp));
+	EXPECT_EQ(2.25, values[3]);
+	EXPECT_EQ(0u, fread(values, sizeof(double), 1, fp));
+	fclose(fp);
+	unlink(fname);
+	rmdir(outputDir);
+}
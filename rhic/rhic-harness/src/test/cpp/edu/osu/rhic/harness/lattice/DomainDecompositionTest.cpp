@@ -0,0 +1,55 @@
+/*
+ * DomainDecompositionTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+#include "edu/osu/rhic/harness/io/Snapshot.h"
+
+TEST(DomainDecomposition, SlabsCoverTheLattice) {
+	int nz = 23, numRanks = 4;
+	int next = 0;
+	for (int rank = 0; rank < numRanks; ++rank) {
+		int first, count;
+		getRapiditySlab(nz, numRanks, rank, &first, &count);
+		EXPECT_EQ(next, first);
+		EXPECT_EQ(rank < 3 ? 6 : 5, count);
+		for (int k = first; k < first + count; ++k)
+			EXPECT_EQ(rank, getRapiditySlabRank(nz, numRanks, k));
+		next = first + count;
+	}
+	EXPECT_EQ(nz, next);
+}
+
+TEST(DomainDecomposition, RestrictSnapshotRegionToSlabs) {
+	// every third of 20 rapidity points, starting at k = 1
+	struct SnapshotRegion region = { 0, 0, 1, 4, 4, 7, 1, 1, 3 };
+	int nz = 20, numRanks = 3;
+	int total = 0;
+	for (int rank = 0; rank < numRanks; ++rank) {
+		int first, count;
+		getRapiditySlab(nz, numRanks, rank, &first, &count);
+		struct SnapshotRegion slab;
+		restrictSnapshotRegion(&region, first, count, &slab);
+		EXPECT_EQ(region.sz, slab.sz);
+		for (int m = 0; m < slab.nz; ++m) {
+			int k = first + slab.k0 + m * slab.sz;
+			EXPECT_TRUE(k >= first && k < first + count);
+			EXPECT_EQ(0, (k - region.k0) % region.sz);
+		}
+		total += slab.nz;
+	}
+	EXPECT_EQ(region.nz, total);
+
+	// a slab without any point of the region
+	struct SnapshotRegion slice = { 0, 0, 10, 4, 4, 1, 1, 1, 1 };
+	struct SnapshotRegion slab;
+	restrictSnapshotRegion(&slice, 0, 7, &slab);
+	EXPECT_EQ(0, slab.nz);
+	restrictSnapshotRegion(&slice, 7, 7, &slab);
+	EXPECT_EQ(1, slab.nz);
+	EXPECT_EQ(3, slab.k0);
+}
@@ -0,0 +1,47 @@
+/*
+ * EnsembleTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+
+#include "edu/osu/rhic/harness/lattice/Ensemble.h"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+
+TEST(Ensemble, PackEventsSideBySide) {
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = 5;
+	lattice.numLatticePointsY = 3;
+	lattice.numLatticePointsRapidity = 2;
+	lattice.numComputationalLatticePointsX = 5 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsY = 3 + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsRapidity = 2 + N_GHOST_CELLS;
+	lattice.ensembleSize = 1;
+	int ncx = lattice.numComputationalLatticePointsX, ncy = lattice.numComputationalLatticePointsY;
+	int ncz = lattice.numComputationalLatticePointsRapidity;
+
+	struct LatticeParameters packed = lattice;
+	packLatticeEnsemble(&packed, 3);
+	EXPECT_EQ(3, packed.ensembleSize);
+	EXPECT_EQ(3 * ncx, packed.numComputationalLatticePointsX);
+	EXPECT_EQ(3 * ncx - N_GHOST_CELLS, packed.numLatticePointsX);
+	EXPECT_EQ(ncy, packed.numComputationalLatticePointsY);
+	EXPECT_EQ(ncz, packed.numComputationalLatticePointsRapidity);
+
+	PRECISION *var = (PRECISION *) malloc(ncx * ncy * ncz * sizeof(PRECISION));
+	PRECISION *whole = (PRECISION *) calloc(3 * ncx * ncy * ncz, sizeof(PRECISION));
+	for (int n = 0; n < 3; ++n) {
+		for (int s = 0; s < ncx * ncy * ncz; ++s) var[s] = 1000 * (n + 1) + s;
+		packEventRows(whole, var, n, &packed);
+	}
+	for (int n = 0; n < 3; ++n)
+		for (int k = 0; k < ncz; ++k)
+			for (int j = 0; j < ncy; ++j)
+				for (int i = 0; i < ncx; ++i)
+					EXPECT_EQ(1000 * (n + 1) + columnMajorLinearIndex(i, j, k, ncx, ncy),
+						whole[columnMajorLinearIndex(n * ncx + i, j, k, 3 * ncx, ncy)]);
+	free(var);
+	free(whole);
+}
@@ -32,6 +32,14 @@ TEST(loadLatticeParameters, LatticeParametersFromConfFile) {
 	EXPECT_EQ(0.2, params.latticeSpacingY);
 	EXPECT_EQ(1, params.latticeSpacingRapidity);
 	EXPECT_EQ(0.5, params.latticeSpacingProperTime);
+
+	EXPECT_EQ(1, params.adaptiveTimeStep);
+	EXPECT_EQ(0.25, params.cflNumber);
+	EXPECT_EQ(0.002, params.minLatticeSpacingProperTime);
+	EXPECT_EQ(0.04, params.maxLatticeSpacingProperTime);
+
+	EXPECT_STREQ("ssp_rk3", params.timeIntegrator);
+	EXPECT_EQ(8, params.ensembleSize);
 }
 
 TEST(loadLatticeParameters, DefaultLatticeParameters) {
@@ -49,5 +57,13 @@ TEST(loadLatticeParameters, DefaultLatticeParameters) {
 	EXPECT_EQ(0.08, params.latticeSpacingY);
 	EXPECT_EQ(0.3, params.latticeSpacingRapidity);
 	EXPECT_EQ(0.01, params.latticeSpacingProperTime);
+
+	EXPECT_EQ(0, params.adaptiveTimeStep);
+	EXPECT_EQ(0.125, params.cflNumber);
+	EXPECT_EQ(0.001, params.minLatticeSpacingProperTime);
+	EXPECT_EQ(0.05, params.maxLatticeSpacingProperTime);
+
+	EXPECT_STREQ("rk2", params.timeIntegrator);
+	EXPECT_EQ(1, params.ensembleSize);
 }
 
@@ -0,0 +1,72 @@
+/*
+ * RegressionTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/regression/Regression.h"
+
+static void writeProfile(const char *fname, const char *host, int threads) {
+	FILE *fp = fopen(fname, "w");
+	fprintf(fp, "{\n  \"host\": \"%s\",\n  \"threads\": %d,\n  \"backend\": \"cpu\",\n", host, threads);
+	fprintf(fp, "  \"cell_updates_per_second\": 1e+06\n}\n");
+	fclose(fp);
+}
+
+static void setTable(struct TimeSeriesTable *table, char (*names)[TIME_SERIES_NAME_LENGTH], double *values, int numRows) {
+	table->numColumns = 3;
+	table->numRows = numRows;
+	table->names = names;
+	table->values = values;
+}
+
+TEST(Regression, TimeSeriesDeviation) {
+	char names[3][TIME_SERIES_NAME_LENGTH] = { "n", "e_max", "center_ux" };
+	char referenceNames[3][TIME_SERIES_NAME_LENGTH] = { "n", "center_ux", "e_max" };
+	double values[6] = { 0, 10.1, 1.e-9, 10, 5.05, -1.e-9 };
+	double referenceValues[6] = { 0, 0, 10, 10, 0, 5 };
+	struct TimeSeriesTable series, reference;
+	setTable(&series, names, values, 2);
+	setTable(&reference, referenceNames, referenceValues, 2);
+
+	// the columns are matched by name, and the noise of a vanishing column is below the floor
+	const char *column;
+	EXPECT_NEAR(0.01 / 1.01, timeSeriesDeviation(&series, &reference, &column), 1.e-12);
+	EXPECT_STREQ("e_max", column);
+	values[2] = 1;
+	EXPECT_NEAR(1, timeSeriesDeviation(&series, &reference, &column), 1.e-12);
+	EXPECT_STREQ("center_ux", column);
+	values[1] = NAN;
+	EXPECT_TRUE(isinf(timeSeriesDeviation(&series, &reference, &column)));
+
+	series.numRows = 1;
+	EXPECT_TRUE(isinf(timeSeriesDeviation(&series, &reference, &column)));
+}
+
+TEST(Regression, BaselineOnlyComparableOnSameHostAndThreads) {
+	char outputDir[] = "/tmp/regressionXXXXXX";
+	ASSERT_TRUE(mkdtemp(outputDir) != NULL);
+	char profile[64], baseline[64];
+	sprintf(profile, "%s/profile.json", outputDir);
+	sprintf(baseline, "%s/baseline_cpu.json", outputDir);
+
+	writeProfile(profile, "node01", 4);
+	EXPECT_FALSE(isComparableBaseline(profile, baseline));
+	writeProfile(baseline, "node01", 4);
+	EXPECT_TRUE(isComparableBaseline(profile, baseline));
+	writeProfile(baseline, "node01", 8);
+	EXPECT_FALSE(isComparableBaseline(profile, baseline));
+	writeProfile(baseline, "node02", 4);
+	EXPECT_FALSE(isComparableBaseline(profile, baseline));
+
+	unlink(profile);
+	unlink(baseline);
+	rmdir(outputDir);
+}
@@ -0,0 +1,46 @@
+/*
+ * PhaseTimersTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
+
+TEST(PhaseTimers, NestedPhasesRecordedOnlyWhenEnabled) {
+	resetPhaseTimers();
+	beginPhase(PHASE_TIME_STEP);
+	endPhase(PHASE_TIME_STEP);
+
+	enablePhaseTimers(true);
+	for (int n = 0; n < 4; ++n) {
+		beginPhase(PHASE_TIME_STEP);
+		beginPhase(PHASE_EULER_STEP);
+		usleep(1000 * (n + 1));
+		endPhase(PHASE_EULER_STEP);
+		endPhase(PHASE_TIME_STEP);
+	}
+	disablePhaseTimers();
+
+	struct PhaseStatistics step, euler, output;
+	getPhaseStatistics(PHASE_TIME_STEP, &step);
+	getPhaseStatistics(PHASE_EULER_STEP, &euler);
+	getPhaseStatistics(PHASE_OUTPUT, &output);
+	EXPECT_EQ(4, step.count);
+	EXPECT_EQ(4, euler.count);
+	EXPECT_EQ(0, output.count);
+	EXPECT_GE(euler.min, 1.0);
+	EXPECT_GE(euler.max, 4.0);
+	EXPECT_LE(euler.min, euler.p50);
+	EXPECT_LE(euler.p50, euler.p90);
+	EXPECT_EQ(euler.max, euler.p99);
+	EXPECT_GE(step.total, euler.total);
+	EXPECT_DOUBLE_EQ(euler.total / 4, euler.mean);
+	EXPECT_STREQ("euler_step", getPhaseName(PHASE_EULER_STEP));
+	resetPhaseTimers();
+	getPhaseStatistics(PHASE_TIME_STEP, &step);
+	EXPECT_EQ(0, step.count);
+}
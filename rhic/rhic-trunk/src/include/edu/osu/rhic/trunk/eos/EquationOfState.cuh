@@ -14,6 +14,9 @@
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
 #define CONFORMAL_EOS
+// Interpolate the QCD EoS from the table built by initializeEquationOfStateTable instead of
+// evaluating the parametrization at every call (has no effect with CONFORMAL_EOS)
+//#define TABULATED_EOS
 
 // ideal gas of massless quarks and gluons
 //#define EOS_FACTOR 15.6269 // Nc=3, Nf=3
@@ -35,4 +38,15 @@ PRECISION effectiveTemperature(PRECISION e);
 __host__ __device__ 
 PRECISION equilibriumEnergyDensity(PRECISION T);
 
+// Parametrization of the Wuppertal-Budapest equation of state, used by the functions above
+// when neither CONFORMAL_EOS nor TABULATED_EOS is defined and to build the EoS table
+__host__ __device__
+PRECISION equilibriumPressureParametrized(PRECISION e);
+__host__ __device__
+PRECISION speedOfSoundSquaredParametrized(PRECISION e);
+__host__ __device__
+PRECISION effectiveTemperatureParametrized(PRECISION e);
+__host__ __device__
+PRECISION equilibriumEnergyDensityParametrized(PRECISION T);
+
 #endif /* EQUATIONOFSTATE_CUH_ */
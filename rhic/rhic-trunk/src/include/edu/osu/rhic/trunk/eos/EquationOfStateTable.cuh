@@ -0,0 +1,59 @@
+/*
+ * EquationOfStateTable.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EQUATIONOFSTATETABLE_CUH_
+#define EQUATIONOFSTATETABLE_CUH_
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+
+/*
+ * Lookup table of the parametrized QCD equation of state, uniform in log(e). Each node holds the
+ * value and the slope per node spacing; the slopes are limited (Fritsch-Carlson) so that the cubic
+ * Hermite interpolant is monotone between nodes and does not overshoot the minimum of cs^2.
+ * Energy densities outside the table fall back to the parametrization; above the table the
+ * single precision parametrization of the pressure overflows.
+ */
+#define EOS_TABLE_SIZE 2048
+#define EOS_TABLE_MIN_ENERGY_DENSITY 1.e-5		// [fm^-4]
+#define EOS_TABLE_MAX_ENERGY_DENSITY 1.e4		// [fm^-4]
+
+#define EOS_TABLE_PRESSURE 0
+#define EOS_TABLE_SPEED_OF_SOUND_SQUARED 1
+#define EOS_TABLE_TEMPERATURE 2
+#define NUMBER_EOS_TABLE_FUNCTIONS 3
+
+#define EOS_TABLE_VALUE 0
+#define EOS_TABLE_SLOPE 1
+
+extern __device__ PRECISION d_eosTable[NUMBER_EOS_TABLE_FUNCTIONS][EOS_TABLE_SIZE][2];
+extern PRECISION h_eosTable[NUMBER_EOS_TABLE_FUNCTIONS][EOS_TABLE_SIZE][2];
+
+extern const char *eosTableFunctionNames[NUMBER_EOS_TABLE_FUNCTIONS];
+
+// Tabulated function (EOS_TABLE_PRESSURE, ...) at energy density e
+__host__ __device__
+PRECISION interpolateEquationOfState(int function, PRECISION e);
+
+// Parametrized function the table was built from
+__host__ __device__
+PRECISION evaluateEquationOfState(int function, PRECISION e);
+
+// Builds the host table and, unless host is true, copies it to the device
+void initializeEquationOfStateTable(bool host);
+
+// Largest relative deviation of the tabulated from the parametrized function, sampled between the nodes
+// (relative to e for the pressure)
+double equationOfStateTableError(int function, double *atEnergyDensity);
+void printEquationOfStateTableError();
+
+// Prints the cost per call of the parametrized and tabulated functions on the host and, unless host is true, the device
+void benchmarkEquationOfState(int calls, bool host);
+
+#endif /* EQUATIONOFSTATETABLE_CUH_ */
@@ -10,50 +10,66 @@
 
 #define NUMBER_CONSERVATION_LAWS 4
 
-//#define PIMUNU 
-//#define PI
-
 /*********************************************************/
-#ifndef PI
-#define NUMBER_PI_COMPONENTS 0
-#else
-#define NUMBER_PI_COMPONENTS 1
-#endif
-
-#ifndef VMU
-#define NUMBER_PROPAGATED_VMU_COMPONENTS 0
-#else
-#define NUMBER_PROPAGATED_VMU_COMPONENTS 4
-#endif
-
-#ifndef PIMUNU
-#define NUMBER_PROPAGATED_PIMUNU_COMPONENTS 0
-#else
-#define NUMBER_PROPAGATED_PIMUNU_COMPONENTS 10
-#endif
-
-#define NUMBER_DISSIPATIVE_CURRENTS (NUMBER_PI_COMPONENTS+NUMBER_PROPAGATED_VMU_COMPONENTS+NUMBER_PROPAGATED_PIMUNU_COMPONENTS)
-
-#if NUMBER_DISSIPATIVE_CURRENTS==0
-#define IDEAL
-#endif
-
-#define NUMBER_CONSERVED_VARIABLES (NUMBER_CONSERVATION_LAWS+NUMBER_DISSIPATIVE_CURRENTS)
+// Physics modes, i.e. which dissipative currents are evolved along with T^{\tau\mu}.
+// Selected at runtime from hydro.properties; the kernels take the mode as a template
+// parameter so that every mode is compiled into the same binary.
+#define IDEAL_HYDRO 0
+#define SHEAR_HYDRO 1			// \pi^{\mu\nu}
+#define SHEAR_BULK_HYDRO 2		// \pi^{\mu\nu} and \Pi
+
+#define EVOLVE_PIMUNU(MODE) ((MODE) != IDEAL_HYDRO)
+#define EVOLVE_PI(MODE) ((MODE) == SHEAR_BULK_HYDRO)
+
+#define NUMBER_PROPAGATED_PIMUNU_COMPONENTS(MODE) (EVOLVE_PIMUNU(MODE) ? 10 : 0)
+#define NUMBER_PI_COMPONENTS(MODE) (EVOLVE_PI(MODE) ? 1 : 0)
+
+#define NUMBER_DISSIPATIVE_CURRENTS(MODE) (NUMBER_PROPAGATED_PIMUNU_COMPONENTS(MODE)+NUMBER_PI_COMPONENTS(MODE))
+
+#define NUMBER_CONSERVED_VARIABLES(MODE) (NUMBER_CONSERVATION_LAWS+NUMBER_DISSIPATIVE_CURRENTS(MODE))
+
+// Explicitly instantiates the templates declared by INSTANTIATE for every physics mode
+#define INSTANTIATE_PHYSICS_MODES(INSTANTIATE) \
+	INSTANTIATE(IDEAL_HYDRO) \
+	INSTANTIATE(SHEAR_HYDRO) \
+	INSTANTIATE(SHEAR_BULK_HYDRO)
+
+// Lattice dimensions, i.e. the directions with more than one lattice point. The Euler step and the
+// validity checks take them as a template parameter and leave out the fluxes and derivatives along
+// the trivial directions, whose ghost cells are not set either; other shapes are evolved as 3D.
+#define LATTICE_3D 0
+#define LATTICE_2D 1			// x and y, boost invariant (nz = 1)
+#define LATTICE_1D 2			// x only (ny = nz = 1)
+#define NUMBER_LATTICE_DIMENSIONS 3
+
+#define EVOLVE_Y(DIMS) ((DIMS) != LATTICE_1D)
+#define EVOLVE_Z(DIMS) ((DIMS) == LATTICE_3D)
+
+// Explicitly instantiates the templates declared by INSTANTIATE for every lattice dimension of a physics mode
+#define INSTANTIATE_LATTICE_DIMENSIONS(INSTANTIATE, MODE) \
+	INSTANTIATE(MODE, LATTICE_3D) \
+	INSTANTIATE(MODE, LATTICE_2D) \
+	INSTANTIATE(MODE, LATTICE_1D)
 /*********************************************************/
 
+// make DOUBLE=1 builds gpu-vh-double, which evolves the fluid in double precision
+#ifdef DOUBLE_PRECISION
+#define PRECISION double
+#else
 #define PRECISION float
+#endif
 
 #include <cuda.h>
 #include <cuda_runtime.h>
 
-// Struct containing the conserved variables
+// Struct containing the conserved variables; the dissipative currents that are not
+// evolved in the current physics mode are not allocated and left NULL
 typedef struct 
 {
 	PRECISION *ttt;
 	PRECISION *ttx;
 	PRECISION *tty;
 	PRECISION *ttn;
-#ifdef PIMUNU
 	PRECISION *pitt;
 	PRECISION *pitx;
 	PRECISION *pity;
@@ -64,10 +80,7 @@ typedef struct
 	PRECISION *piyy;
 	PRECISION *piyn;
 	PRECISION *pinn;
-#endif
-#ifdef PI
 	PRECISION *Pi;
-#endif
 } CONSERVED_VARIABLES;
 
 // Struct containing components of the fluid velocity
@@ -105,8 +118,18 @@ extern PRECISION *d_regulations, *d_knudsenNumberTaupi, *d_knudsenNumberTauPi, *
 extern PRECISION *d_taupi, *d_dxux, *d_dyuy, *d_theta;
 /****************************************************************************/
 
+// Physics mode of the current run (IDEAL_HYDRO, SHEAR_HYDRO or SHEAR_BULK_HYDRO)
+extern int physicsMode;
+
+// Lattice dimensions of the current run (LATTICE_3D, LATTICE_2D or LATTICE_1D)
+extern int latticeDimensions;
+
+int getLatticeDimensions(void * latticeParams);
+const char * getLatticeDimensionsName(int dimensions);
+
 extern CONSERVED_VARIABLES *q;
 extern CONSERVED_VARIABLES *d_q,*d_Q,*d_qS;
+extern CONSERVED_VARIABLES *h_Q,*h_qS;
 
 extern PRECISION *e, *p;
 extern PRECISION *d_e, *d_p, *d_ut, *d_ux, *d_uy, *d_un;
@@ -115,21 +138,39 @@ extern PRECISION *d_ttt,*d_ttx,*d_tty,*d_ttn,*d_pitt,*d_pitx,*d_pity,*d_pitn,*d_
 
 extern FLUID_VELOCITY *u;
 extern FLUID_VELOCITY *d_u,*d_up,*d_uS;
+extern FLUID_VELOCITY *h_up,*h_uS;
 
 __host__ __device__ 
 int columnMajorLinearIndex(int i, int j, int k, int nx, int ny);
 
 void allocateHostMemory(int len);
 void allocateDeviceMemory(size_t bytes);
+// The validity arrays, otherwise NULL, for runs that write them
+void allocateValidityDomainHostMemory(int len);
+void allocateValidityDomainDeviceMemory(size_t bytes);
+void allocateIntermediateHostMemory(int len);
+void allocatePreviousFluidVelocityHostMemory(int len);
+CONSERVED_VARIABLES * allocateIntermidateConservedVarHostMemory(int len);
+FLUID_VELOCITY * allocateIntermidateFluidVelocityHostMemory(int len);
+
+void clearHostMemory(int len);
+void resetIntermediateHostMemory(int len);
 
 void copyHostToDeviceMemory(size_t bytes);
 void copyDeviceToHostMemory(size_t bytes);
+void copyPreviousFluidVelocityDeviceToHost(size_t bytes);
+void copyPreviousFluidVelocityHostToDevice(size_t bytes);
 
 void setConservedVariables(double t, void * latticeParams);
 void setCurrentConservedVariables();
+void setCurrentConservedVariablesHost();
 void swapFluidVelocity(FLUID_VELOCITY **arr1, FLUID_VELOCITY **arr2);
 
 void freeHostMemory();
 void freeDeviceMemory();
+void freeIntermediateHostMemory();
+void freePreviousFluidVelocityHostMemory();
+void freeIntermidateConservedVarHostMemory(CONSERVED_VARIABLES *c);
+void freeIntermidateFluidVelocityHostMemory(FLUID_VELOCITY *v);
 
 #endif /* DYNAMICALVARIABLES_CUH_ */
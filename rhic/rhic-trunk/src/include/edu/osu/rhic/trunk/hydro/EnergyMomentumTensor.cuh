@@ -13,19 +13,67 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
+// Outcome of the energy density solve returned by getInferredVariables and setInferredVariablesCell
+#define INFERRED_VARIABLES_ITERATIONS(status) ((status) & 0xff)
+#define INFERRED_VARIABLES_BISECTED 0x100		// Newton's method left the bracket of the root at least once
+#define INFERRED_VARIABLES_NOT_CONVERGED 0x200	// stopped at the iteration cap
+#define INFERRED_VARIABLES_MAX_ITERATIONS 20
+
+// Equations of state solveEnergyDensity is compiled for
+#define EQUILIBRIUM_EOS 0		// equilibriumPressure and speedOfSoundSquared, as configured in EquationOfState.cuh
+#define PARAMETRIZED_EOS 1		// the Wuppertal-Budapest parametrization, whatever the configuration
+
+// Energy density solves of setInferredVariablesKernel/Host since the last reset
+struct InferredVariablesStatistics
+{
+	unsigned long long cells;
+	unsigned long long iterations;
+	unsigned long long bisected;
+	unsigned long long notConverged;
+	unsigned int maxIterations;
+};
+
+extern __device__ struct InferredVariablesStatistics d_inferredVariablesStatistics;
+extern struct InferredVariablesStatistics h_inferredVariablesStatistics;
+
+void resetInferredVariablesStatistics(bool host);
+void getInferredVariablesStatistics(struct InferredVariablesStatistics * const stats, bool host);
+
+// Solves e = M0 - M/(M0 + p(e) + Pi) for the energy density, starting from ePrev; status as for getInferredVariables
+template <int EOS>
+__host__ __device__ 
+PRECISION solveEnergyDensity(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi, int * const status);
+
+// solveEnergyDensity<EQUILIBRIUM_EOS>, or the closed form solution with CONFORMAL_EOS (status 0)
 __host__ __device__ 
-PRECISION energyDensityFromConservedVariables(PRECISION ePrev, PRECISION M0, PRECISION M1, PRECISION M2, PRECISION M3);
+PRECISION energyDensityFromConservedVariables(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi, int * const status);
 
+template <int MODE>
 __host__ __device__ 
-void getInferredVariables(PRECISION t, const PRECISION * const __restrict__ q, PRECISION ePrev,
+int getInferredVariables(PRECISION t, const PRECISION * const __restrict__ q, PRECISION ePrev,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, 
 PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION * const __restrict__ uy, PRECISION * const __restrict__ un
 );
 
+template <int MODE>
+__host__ __device__ 
+int setInferredVariablesCell(const CONSERVED_VARIABLES * const __restrict__ q, 
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
+PRECISION t, int s
+);
+
+// The physical cells of the rapidity planes kBegin <= k < kEnd, given with the ghost cells counted
+template <int MODE>
 __global__ 
 void setInferredVariablesKernel(const CONSERVED_VARIABLES * const __restrict__ q, 
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
-PRECISION t
+PRECISION t, int kBegin, int kEnd
+);
+
+template <int MODE>
+void setInferredVariablesHost(const CONSERVED_VARIABLES * const __restrict__ q, 
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
+PRECISION t, int kBegin, int kEnd
 );
 
 __host__ __device__ 
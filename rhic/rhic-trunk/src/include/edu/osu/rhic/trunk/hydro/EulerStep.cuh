@@ -22,6 +22,7 @@ void eulerStepKernel_1D(PRECISION t,
 		const FLUID_VELOCITY * const __restrict__ up);
 
 /****************************************************************************/
+template <int MODE, int DIMS>
 __global__
 void eulerStepKernelSource(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
@@ -30,24 +31,36 @@ void eulerStepKernelSource(PRECISION t,
 		const PRECISION * const __restrict__ p,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const FLUID_VELOCITY * const __restrict__ up);
+template <int MODE>
 __global__
 void eulerStepKernelX(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE>
 __global__
 void eulerStepKernelY(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE>
 __global__
 void eulerStepKernelZ(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE, int DIMS>
+__global__
+void eulerStepKernelFused(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
 
 /****************************************************************************\
 __global__
@@ -70,6 +83,7 @@ void eulerStepKernelSharedZ(PRECISION t,
 		const PRECISION * const __restrict__ e);
 
 /****************************************************************************/
+template <int MODE, int DIMS>
 __global__
 void eulerStepKernelSource_1D(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
@@ -78,24 +92,135 @@ void eulerStepKernelSource_1D(PRECISION t,
 		const PRECISION * const __restrict__ p,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const FLUID_VELOCITY * const __restrict__ up);
+template <int MODE>
 __global__
 void eulerStepKernelX_1D(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE>
 __global__
 void eulerStepKernelY_1D(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE>
 __global__
 void eulerStepKernelZ_1D(PRECISION t,
 		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const FLUID_VELOCITY * const __restrict__ u,
 		const PRECISION * const __restrict__ e);
+template <int MODE, int DIMS>
+__global__
+void eulerStepKernelFused_1D(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
+/****************************************************************************/
+
+// Per-cell updates shared by the device kernels and the host backend. The source and fused updates
+// leave out the derivatives and fluxes along the trivial directions of the lattice dimensions DIMS.
+__host__ __device__
+void setNeighborCellsJK2(const PRECISION * const __restrict__ in, PRECISION * const __restrict__ out,
+		int s, int ptr, int smm, int sm, int sp, int spp);
+template <int MODE, int DIMS>
+__host__ __device__
+void eulerStepSourceCell(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up, int s);
+template <int MODE>
+__host__ __device__
+void eulerStepXCell(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e, int s);
+template <int MODE>
+__host__ __device__
+void eulerStepYCell(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e, int s);
+template <int MODE>
+__host__ __device__
+void eulerStepZCell(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e, int s);
+template <int MODE, int DIMS>
+__host__ __device__
+void eulerStepFusedCell(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up, int s);
+
+/****************************************************************************/
+// Host backend
+template <int MODE, int DIMS>
+void eulerStepSourceHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
+template <int MODE>
+void eulerStepXHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e);
+template <int MODE>
+void eulerStepYHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e);
+template <int MODE>
+void eulerStepZHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const PRECISION * const __restrict__ e);
+template <int MODE, int DIMS>
+void eulerStepFusedHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
+template <int MODE, int DIMS>
+void eulerStepFused1DHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
+template <int MODE, int DIMS>
+void eulerStepSplit1DHost(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
 /****************************************************************************/
 
 #endif /* EULERSTEP_CUH_ */
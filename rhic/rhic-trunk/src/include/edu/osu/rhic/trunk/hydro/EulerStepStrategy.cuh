@@ -0,0 +1,67 @@
+/*
+ * EulerStepStrategy.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EULERSTEPSTRATEGY_CUH_
+#define EULERSTEPSTRATEGY_CUH_
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*********************************************************/
+// Implementations of the Euler step, selected at runtime by name or by the autotuner
+#define EULER_STEP_FUSED 0			// source and fluxes in one 3D kernel
+#define EULER_STEP_FUSED_1D 1		// source and fluxes in one 1D kernel
+#define EULER_STEP_SPLIT 2			// separate source, X, Y and Z 3D kernels
+#define EULER_STEP_SPLIT_1D 3		// separate source, X, Y and Z 1D kernels
+#define NUMBER_EULER_STEP_STRATEGIES 4
+
+#define DEFAULT_EULER_STEP_STRATEGY EULER_STEP_SPLIT_1D
+#define DEFAULT_AUTOTUNE_STEPS 5
+#define DEFAULT_STEP_BENCHMARK_STEPS 20
+/*********************************************************/
+
+typedef void (*EULER_STEP_FUNCTION)(PRECISION t,
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up);
+
+// A named Euler step with its device (kernel launches) and host (OpenMP loops) implementation
+typedef struct
+{
+	const char *name;
+	EULER_STEP_FUNCTION device;
+	EULER_STEP_FUNCTION host;
+} EULER_STEP_STRATEGY;
+
+// Strategy used by eulerStep and eulerStepHost
+extern int eulerStepStrategy;
+
+// Returns the index of the strategy with the given name, or -1 if there is none
+int findEulerStepStrategy(const char *name);
+// Name of a strategy index, "unknown" if it is out of range
+const char * getEulerStepStrategyName(int strategy);
+
+// The given strategy specialized for the lattice dimensions of the run (latticeDimensions)
+template <int MODE>
+const EULER_STEP_STRATEGY * getEulerStepStrategy(int strategy);
+
+/*
+ * Times each strategy over the given number of Euler steps on the current lattice
+ * (q -> qS, which the next predicted step overwrites) and returns the fastest.
+ */
+template <int MODE>
+int autotuneEulerStep(PRECISION t, int steps, bool host);
+
+/*
+ * Times the Euler step of the current strategy together with the ghost cells over the given number of
+ * steps, once treating the lattice as 3D and once specialized for its dimensions, and prints both.
+ */
+template <int MODE>
+void benchmarkLatticeDimensions(PRECISION t, int steps, bool host);
+
+#endif /* EULERSTEPSTRATEGY_CUH_ */
@@ -10,11 +10,11 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION Fx(PRECISION q, PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
-__device__ 
+__host__ __device__ 
 PRECISION Fy(PRECISION q, PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
-__device__ 
+__host__ __device__ 
 PRECISION Fz(PRECISION q, PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
 
 #endif /* FLUXFUNCTIONS_CUH_ */
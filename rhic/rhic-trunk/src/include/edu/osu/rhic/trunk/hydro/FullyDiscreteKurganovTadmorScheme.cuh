@@ -10,13 +10,67 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
+template <int MODE>
+__host__ __device__
+void convexCombinationEulerStepCell(
+		const CONSERVED_VARIABLES * const __restrict__ q,
+		CONSERVED_VARIABLES * const __restrict__ Q, int s);
+
+template <int MODE>
 __global__
 void convexCombinationEulerStepKernel(
 		const CONSERVED_VARIABLES * const __restrict__ q,
 		CONSERVED_VARIABLES * const __restrict__ Q);
 
+template <int MODE>
 void twoStepRungeKutta(PRECISION t, PRECISION dt,
 		CONSERVED_VARIABLES * __restrict__ d_q,
 		CONSERVED_VARIABLES * __restrict__ d_Q);
 
+template <int MODE>
+void convexCombinationEulerStepHost(
+		const CONSERVED_VARIABLES * const __restrict__ q,
+		CONSERVED_VARIABLES * const __restrict__ Q);
+
+template <int MODE>
+void twoStepRungeKuttaHost(PRECISION t, PRECISION dt,
+		CONSERVED_VARIABLES * __restrict__ q,
+		CONSERVED_VARIABLES * __restrict__ Q);
+
+template <int MODE>
+__host__ __device__
+void convexCombinationCell(PRECISION a,
+		const CONSERVED_VARIABLES * const __restrict__ q,
+		const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q, int s);
+
+template <int MODE>
+__global__
+void convexCombinationKernel(PRECISION a,
+		const CONSERVED_VARIABLES * const __restrict__ q,
+		const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q);
+
+template <int MODE>
+void convexCombinationHost(PRECISION a,
+		const CONSERVED_VARIABLES * const __restrict__ q,
+		const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q);
+
+// Inferred variables, regulation and ghost cells of a stage solution q at time t on the host lattice
+template <int MODE>
+void setStageVariablesHost(PRECISION t,
+		CONSERVED_VARIABLES * const __restrict__ q,
+		FLUID_VELOCITY * const __restrict__ u);
+
+template <int MODE>
+void threeStepRungeKutta(PRECISION t, PRECISION dt,
+		CONSERVED_VARIABLES * __restrict__ d_q,
+		CONSERVED_VARIABLES * __restrict__ d_Q);
+
+template <int MODE>
+void threeStepRungeKuttaHost(PRECISION t, PRECISION dt,
+		CONSERVED_VARIABLES * __restrict__ q,
+		CONSERVED_VARIABLES * __restrict__ Q);
+
 #endif /* FULLYDISCRETEKURGANOVTADMORSCHEME_CUH_ */
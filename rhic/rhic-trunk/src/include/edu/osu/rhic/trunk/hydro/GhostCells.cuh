@@ -8,24 +8,40 @@
 #ifndef GHOSTCELLS_CUH_
 #define GHOSTCELLS_CUH_
 
+template <int MODE>
 void setGhostCells(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
 );
+template <int MODE>
 __global__
 void setGhostCellsKernelI(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
 );
+template <int MODE>
 __global__
 void setGhostCellsKernelJ(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
 );
+template <int MODE>
 __global__
 void setGhostCellsKernelK(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
 );
+template <int MODE>
+__host__ __device__
+void setGhostCellVars(CONSERVED_VARIABLES * const __restrict__ q,
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
+FLUID_VELOCITY * const __restrict__ u,
+int s, int sBC);
+
+template <int MODE>
+void setGhostCellsHost(CONSERVED_VARIABLES * const __restrict__ q,
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
+FLUID_VELOCITY * const __restrict__ u
+);
 
 #endif /* GHOSTCELLS_CUH_ */
@@ -0,0 +1,59 @@
+/*
+ * HaloExchange.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HALOEXCHANGE_CUH_
+#define HALOEXCHANGE_CUH_
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*
+ * Transfers between the rapidity slabs of a domain decomposition (see DomainDecomposition.h). The
+ * energy density, pressure, fluid velocity and the evolved components of the conserved variables
+ * in the first and last N_GHOST_CELLS_M planes of a slab replace the ghost cells of the neighbouring
+ * slabs. The planes pass through host buffers, page-locked for the GPU backend, so that the kernels
+ * setting the ghost cells may run while the transfer is in progress.
+ */
+
+#define LOWER_NEIGHBOUR 0
+#define UPPER_NEIGHBOUR 1
+
+// Allocates the transfer buffers; does nothing unless there is more than one slab
+void allocateHaloExchangeMemory(bool host);
+void freeHaloExchangeMemory();
+bool isHaloExchangeEnabled();
+
+/*
+ * Copies the planes sent to the neighbours and starts the transfer. q and u are device pointers for
+ * the GPU backend. The arrays may be changed before endHaloExchange, which overwrites the received planes.
+ */
+template <int MODE>
+void beginHaloExchange(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u, bool host);
+// Waits for the transfer and writes the received planes over the ghost cells of the same arrays
+void endHaloExchange(bool host);
+template <int MODE>
+void exchangeHalos(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u, bool host);
+
+/*
+ * Copies of the host arrays through a buffer of getHaloBufferBytes bytes, as done for the transfers: the planes
+ * N_GHOST_CELLS_M and h_nz onwards are sent to the lower and upper neighbour (side), and the planes received from
+ * them are written from 0 and h_nz + N_GHOST_CELLS_M onwards, N_GHOST_CELLS_M planes of each array.
+ */
+size_t getHaloBufferBytes(int mode);
+template <int MODE>
+void packHaloPlanes(const CONSERVED_VARIABLES * const q, const PRECISION * const e, const PRECISION * const p,
+		const FLUID_VELOCITY * const u, int side, PRECISION * const buffer);
+template <int MODE>
+void unpackHaloPlanes(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u,
+		int side, const PRECISION * const buffer);
+
+/*
+ * Sends the slab of every rank, ghost cells included, from the host arrays of the whole lattice on
+ * the root rank (wholeQ etc., unused elsewhere) to the host arrays q, e, p and u of the slab.
+ */
+void scatterHostVariables(void * latticeParams, const CONSERVED_VARIABLES * const wholeQ, const PRECISION * const wholeE,
+		const PRECISION * const wholeP, const FLUID_VELOCITY * const wholeU);
+
+#endif /* HALOEXCHANGE_CUH_ */
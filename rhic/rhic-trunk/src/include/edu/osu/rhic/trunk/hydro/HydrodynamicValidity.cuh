@@ -10,6 +10,17 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
+template <int MODE, int DIMS>
+__host__ __device__
+void checkValidityCell(PRECISION t,
+const VALIDITY_DOMAIN * const __restrict__ v,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up,
+int s
+);
+
+template <int MODE, int DIMS>
 __global__
 void checkValidityKernel(PRECISION t,
 const VALIDITY_DOMAIN * const __restrict__ v,
@@ -18,6 +29,8 @@ const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
 const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
 );
 
+// Evaluated with checkValidityCell specialized for the lattice dimensions of the run
+template <int MODE>
 void checkValidity(PRECISION t,
 const VALIDITY_DOMAIN * const __restrict__ v,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars,
@@ -25,4 +38,12 @@ const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
 const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
 );
 
+template <int MODE>
+void checkValidityHost(PRECISION t,
+const VALIDITY_DOMAIN * const __restrict__ v,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+);
+
 #endif /* HYDRODYNAMICVALIDITY_CUH_ */
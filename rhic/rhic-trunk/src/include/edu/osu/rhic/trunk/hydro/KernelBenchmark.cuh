@@ -0,0 +1,25 @@
+/*
+ * KernelBenchmark.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef KERNELBENCHMARK_CUH_
+#define KERNELBENCHMARK_CUH_
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+#define DEFAULT_KERNEL_BENCHMARK_REPEATS 5
+
+/*
+ * Host microbenchmarks of the building blocks of the Euler step and of the inferred variables, run on one thread
+ * over the physical cells of the host lattice (q, e, p, u and h_up), so that their inputs are those of an evolved
+ * event: the stencil gathers along x, y and z, approximateDerivative, the flux of a cell, loadSourceTerms2 (3D),
+ * setPimunuSourceTerms, getInferredVariables and the equation of state. The arguments of each function are
+ * gathered beforehand, so a benchmark times the function alone. Prints the fastest of the repeats in ns per cell
+ * and, unless outputDirectory is NULL, writes them to outputDirectory/microbenchmarks.json.
+ */
+template <int MODE>
+void benchmarkKernels(PRECISION t, int repeats, const char *outputDirectory);
+
+#endif /* KERNELBENCHMARK_CUH_ */
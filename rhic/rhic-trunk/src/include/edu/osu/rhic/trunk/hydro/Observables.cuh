@@ -0,0 +1,52 @@
+/*
+ * Observables.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef OBSERVABLES_CUH_
+#define OBSERVABLES_CUH_
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*
+ * Scalar observables computed where the fluid is evolved, so that monitoring a run transfers a few numbers
+ * per time step instead of the fields: reductions over the physical cells of every event of the lattice
+ * (the events of an ensemble being the ncx/ensembleSize wide column blocks, see Ensemble.h) and the fields
+ * at a list of probe cells.
+ */
+
+// Launch configuration of the reductions (grid-stride loop over an event, one partial result per block)
+#define OBSERVABLE_BLOCKS 64
+#define OBSERVABLE_THREADS 256
+
+// Sums and extrema over the physical cells of an event
+#define NUM_FLUID_REDUCTIONS 6
+struct FluidReductions
+{
+	double eMax, eMin;
+	double eSum;
+	double TSum;				// effective temperature
+	double tttSum;				// T^{\tau\tau}
+	double entropySum;			// s u^\tau with s = (e + p)/T
+};
+
+// Fields read at each probe cell: e, p, ux, uy, un
+#define PROBE_FIELDS 5
+
+// Linear indices of the probe cells, -1 for a cell outside of the lattice of this process (read as 0)
+void setProbeCells(const int * const cells, int numCells, bool cpu);
+
+// Reductions of the h_ensembleSize events into reductions[] and the probe fields into probeValues[PROBE_FIELDS*c + f]
+void computeObservables(const CONSERVED_VARIABLES * const __restrict__ q, const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		struct FluidReductions * const reductions, double * const probeValues);
+void computeObservablesHost(const CONSERVED_VARIABLES * const __restrict__ q, const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		struct FluidReductions * const reductions, double * const probeValues);
+void freeObservablesMemory();
+
+#endif /* OBSERVABLES_CUH_ */
@@ -3,12 +3,31 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
+__host__ __device__ 
+void regulateDissipativeCurrentsCell(PRECISION t, 
+CONSERVED_VARIABLES * const __restrict__ currrentVars, 
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u,
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int s
+);
+
+// The physical cells of the rapidity planes kBegin <= k < kEnd, given with the ghost cells counted
 __global__ 
 void regulateDissipativeCurrents(PRECISION t, 
 CONSERVED_VARIABLES * const __restrict__ currrentVars, 
 const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
 const FLUID_VELOCITY * const __restrict__ u,
-VALIDITY_DOMAIN * const __restrict__ validityDomain
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int kBegin, int kEnd
+);
+
+void regulateDissipativeCurrentsHost(PRECISION t, 
+CONSERVED_VARIABLES * const __restrict__ currrentVars, 
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u,
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int kBegin, int kEnd
 );
 
 #endif /* REGULATEDISSIPATIVECURRENTS_CUH_ */
@@ -10,7 +10,25 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+// Relaxation equation sources of the dissipative currents (pitt, ..., pinn, Pi) of a cell
+template <int MODE>
+__host__ __device__
+void setPimunuSourceTerms(PRECISION * const __restrict__ pimunuRHS,
+PRECISION t, PRECISION e, PRECISION p,
+PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un, PRECISION utp,
+PRECISION uxp, PRECISION uyp, PRECISION unp,
+PRECISION pitt, PRECISION pitx, PRECISION pity,
+PRECISION pitn, PRECISION pixx, PRECISION pixy, PRECISION pixn,
+PRECISION piyy,
+PRECISION piyn, PRECISION pinn, PRECISION Pi,
+PRECISION dxut, PRECISION dyut, PRECISION dnut, PRECISION dxux,
+PRECISION dyux, PRECISION dnux,
+PRECISION dxuy, PRECISION dyuy, PRECISION dnuy, PRECISION dxun,
+PRECISION dyun, PRECISION dnun, PRECISION dkvk);
+
+
+template <int MODE>
+__host__ __device__ 
 void loadSourceTerms(
 const PRECISION * const __restrict__ I, const PRECISION * const __restrict__ J, const PRECISION * const __restrict__ K, 
 const PRECISION * const __restrict__ Q, PRECISION * const __restrict__ S,
@@ -20,14 +38,19 @@ PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec,
 int s
 );
 //=================================================================
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void loadSourceTermsX(const PRECISION * const __restrict__ I, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s);
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void loadSourceTermsY(const PRECISION * const __restrict__ J, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s);
-__device__ 
+template <int MODE>
+__host__ __device__ 
 void loadSourceTermsZ(const PRECISION * const __restrict__ K, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s, 
 PRECISION t);
-__device__ 
+// Source terms of a cell, without the derivatives along the trivial directions of DIMS
+template <int MODE, int DIMS>
+__host__ __device__ 
 void loadSourceTerms2(const PRECISION * const __restrict__ Q, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u,
 PRECISION utp, PRECISION uxp, PRECISION uyp, PRECISION unp,
 PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec,
@@ -10,11 +10,11 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusX(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusY(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusZ(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un);
 
 #endif /* SPECTRALRADIUS_CUH_ */
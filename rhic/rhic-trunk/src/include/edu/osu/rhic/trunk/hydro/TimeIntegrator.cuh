@@ -0,0 +1,39 @@
+/*
+ * TimeIntegrator.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TIMEINTEGRATOR_CUH_
+#define TIMEINTEGRATOR_CUH_
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+/*********************************************************/
+// Runge-Kutta schemes built from the Euler step, selected by name in lattice.properties
+#define TIME_INTEGRATOR_RK2 0			// Heun's method, twoStepRungeKutta
+#define TIME_INTEGRATOR_SSP_RK3 1		// third order strong stability preserving, threeStepRungeKutta
+#define NUMBER_TIME_INTEGRATORS 2
+/*********************************************************/
+
+// Advances q from t to t+dt into Q
+typedef void (*TIME_INTEGRATOR_FUNCTION)(PRECISION t, PRECISION dt,
+		CONSERVED_VARIABLES * __restrict__ q,
+		CONSERVED_VARIABLES * __restrict__ Q);
+
+// A named Runge-Kutta scheme with its number of Euler steps per time step and its device and host implementation
+typedef struct
+{
+	const char *name;
+	int eulerSteps;
+	TIME_INTEGRATOR_FUNCTION device;
+	TIME_INTEGRATOR_FUNCTION host;
+} TIME_INTEGRATOR;
+
+// Returns the index of the integrator with the given name, or -1 if there is none
+int findTimeIntegrator(const char *name);
+
+template <int MODE>
+const TIME_INTEGRATOR * getTimeIntegrator(int integrator);
+
+#endif /* TIMEINTEGRATOR_CUH_ */
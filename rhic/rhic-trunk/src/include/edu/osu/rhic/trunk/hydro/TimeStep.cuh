@@ -0,0 +1,35 @@
+/*
+ * TimeStep.cuh
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TIMESTEP_CUH_
+#define TIMESTEP_CUH_
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+
+// Launch configuration of the spectral radius reduction (grid-stride loop, one partial result per block)
+#define SPECTRAL_RADIUS_BLOCKS 256
+#define SPECTRAL_RADIUS_THREADS 256
+
+__global__
+void maximumSpectralRadiiKernel(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const __restrict__ blockMaxima);
+
+// Largest spectralRadiusX/Y/Z over the physical lattice, in radii[0..2]
+void maximumSpectralRadii(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const radii);
+void maximumSpectralRadiiHost(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const radii);
+void freeSpectralRadiusMemory();
+
+/*
+ * Time step for proper time t from the CFL condition of the largest spectral radii,
+ *		dt = C min(dx/a_x, dy/a_y, deta/a_eta, t),
+ * clamped to the bounds in the lattice parameters. The last term keeps the step a fraction of the
+ * longitudinal expansion time 1/theta = t, which dominates while the fluid is still at rest.
+ */
+double courantTimeStep(const PRECISION * const radii, double t, void * latticeParams);
+
+#endif /* TIMESTEP_CUH_ */
@@ -17,6 +17,6 @@ const PRECISION lambda_piPi = 1.2;
 //
 const PRECISION delta_PiPi = 0.666667;
 
-__device__ PRECISION bulkViscosityToEntropyDensity(PRECISION T);
+__host__ __device__ PRECISION bulkViscosityToEntropyDensity(PRECISION T);
 
 #endif /* TRANSPORTCOEFFICIENTS_CUH_ */
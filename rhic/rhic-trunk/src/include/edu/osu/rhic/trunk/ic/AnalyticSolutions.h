@@ -0,0 +1,23 @@
+/*
+ * AnalyticSolutions.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ANALYTICSOLUTIONS_H_
+#define ANALYTICSOLUTIONS_H_
+
+/*
+ * Energy densities [fm^-4] of the test problems of an ideal conformal fluid (p = e/3) with known solutions
+ */
+
+// Gubser flow (q = 1 fm^-1) at proper time t and transverse position (x, y), e0 as in its initial condition at t = 1 fm
+double idealGubserEnergyDensity(double e0, double t, double x, double y);
+
+/*
+ * Riemann problem of a fluid at rest with eL for x <= 0 and eR < eL for x > 0, a time t after the diaphragm is
+ * removed: a rarefaction wave moving left and a shock moving right, with no contact discontinuity between them
+ */
+double riemannProblemEnergyDensity(double eL, double eR, double t, double x);
+
+#endif /* ANALYTICSOLUTIONS_H_ */
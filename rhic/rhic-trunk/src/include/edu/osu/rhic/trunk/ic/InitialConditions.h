@@ -8,6 +8,10 @@
 #ifndef INITIALCONDITIONS_H_
 #define INITIALCONDITIONS_H_
 
+// Energy densities [fm^-4] on the high and low pressure sides of the diaphragm of the Sod shock-tube tests
+#define SOD_SHOCK_TUBE_LEFT_ENERGY_DENSITY 0.124503
+#define SOD_SHOCK_TUBE_RIGHT_ENERGY_DENSITY 0.00778147
+
 void setInitialConditions(void * latticeParams, void * initCondParams, void * hydroParams, const char *rootDirectory);
 
 #endif /* INITIALCONDITIONS_H_ */
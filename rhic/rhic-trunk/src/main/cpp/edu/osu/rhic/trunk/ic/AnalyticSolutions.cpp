@@ -0,0 +1,49 @@
+/*
+ * AnalyticSolutions.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/ic/AnalyticSolutions.h"
+
+double idealGubserEnergyDensity(double e0, double t, double x, double y) {
+	double r2 = x*x + y*y;
+	double T = 1.9048812623618392/pow(t * (1 + 2*(t*t + r2) + pow(t*t - r2, 2)), 1/3.);
+	return e0 * pow(T, 4);
+}
+
+// the rarefaction wave keeps the Riemann invariant atanh(v) + sqrt(3)/4 ln(e) of the left state
+static double rarefactionVelocity(double eL, double e) {
+	return tanh(-sqrt(3.) / 4 * log(e / eL));
+}
+
+// fluid velocity behind a shock of energy density e moving into the fluid at rest with eR
+static double shockVelocity(double eR, double e) {
+	double p = e / 3, pR = eR / 3;
+	return sqrt((p - pR) * (e - eR) / ((eR + p) * (e + pR)));
+}
+
+double riemannProblemEnergyDensity(double eL, double eR, double t, double x) {
+	if (t <= 0) return x > 0 ? eR : eL;
+	const double cs = 1 / sqrt(3.);
+	// the fluid between the waves moves with the velocity of both
+	double lower = eR, upper = eL, e = eL;
+	for (int n = 0; n < 100; ++n) {
+		e = (lower + upper) / 2;
+		if (rarefactionVelocity(eL, e) > shockVelocity(eR, e)) lower = e;
+		else upper = e;
+	}
+	double v = rarefactionVelocity(eL, e);
+	double w = (e + e / 3) / (1 - v * v);
+	double vShock = w * v / (w - e / 3 - eR);
+
+	double xi = x / t;
+	if (xi <= -cs) return eL;
+	if (xi < (v - cs) / (1 - v * cs)) {
+		double vFan = (xi + cs) / (1 + xi * cs);
+		return eL * pow((1 - vFan) / (1 + vFan), 2 / sqrt(3.));
+	}
+	return xi < vShock ? e : eR;
+}
@@ -82,19 +82,19 @@ void setPimunuNavierStokesInitialCondition(void * latticeParams, void * initCond
 				PRECISION pinn = -2/(3*t*t*t)*etabar*(e[s]+p[s])/T;
 				// pinn from xi=100
 				pinn = 0.324594*e[s]/t/t;
-#ifdef PIMUNU
-				q->pitt[s] = 0;
-				q->pitx[s] = 0;
-				q->pity[s] = 0;
-				q->pitn[s] = 0;
-				q->pixx[s] = -t*t*pinn/2;
-				q->pixy[s] = 0;
-				q->pixn[s] = 0;
-				q->piyy[s] = -t*t*pinn/2;
-				q->piyn[s] = 0;
-				q->pinn[s] = pinn;
-#endif
-#ifdef PI
+				if (EVOLVE_PIMUNU(physicsMode)) {
+					q->pitt[s] = 0;
+					q->pitx[s] = 0;
+					q->pity[s] = 0;
+					q->pitn[s] = 0;
+					q->pixx[s] = -t*t*pinn/2;
+					q->pixy[s] = 0;
+					q->pixn[s] = 0;
+					q->piyy[s] = -t*t*pinn/2;
+					q->piyn[s] = 0;
+					q->pinn[s] = pinn;
+				}
+				if (EVOLVE_PI(physicsMode)) {
 #define A_1 -13.77
 #define A_2 27.55
 #define A_3 13.45
@@ -108,14 +108,14 @@ void setPimunuNavierStokesInitialCondition(void * latticeParams, void * initCond
 #define SIGMA_2 0.13
 #define SIGMA_3 0.0025
 #define SIGMA_4 0.022
-				PRECISION x = T/1.01355;
-				PRECISION zetabar = A_1*x*x + A_2*x - A_3;
-				if(x > 1.05)
-					zetabar = LAMBDA_1*exp(-(x-1)/SIGMA_1) + LAMBDA_2*exp(-(x-1)/SIGMA_2)+0.001;
-				else if(x < 0.995)
-					zetabar = LAMBDA_3*exp((x-1)/SIGMA_3)+ LAMBDA_4*exp((x-1)/SIGMA_4)+0.03;
-				q->Pi[s] = -zetabar*(e[s]+p[s])/T/t;
-#endif
+					PRECISION x = T/1.01355;
+					PRECISION zetabar = A_1*x*x + A_2*x - A_3;
+					if(x > 1.05)
+						zetabar = LAMBDA_1*exp(-(x-1)/SIGMA_1) + LAMBDA_2*exp(-(x-1)/SIGMA_2)+0.001;
+					else if(x < 0.995)
+						zetabar = LAMBDA_3*exp((x-1)/SIGMA_3)+ LAMBDA_4*exp((x-1)/SIGMA_4)+0.03;
+					q->Pi[s] = -zetabar*(e[s]+p[s])/T/t;
+				}
 			}
 		}
 	}
@@ -126,9 +126,9 @@ void setPimunuInitialCondition(void * latticeParams, void * initCondParams, void
 	int initializePimunuNavierStokes = hydro->initializePimunuNavierStokes;
 	if (initializePimunuNavierStokes==1) {
 		printf("Initialize \\pi^\\mu\\nu to its asymptotic Navier-Stokes value.\n");
-#ifdef PI
-		printf("Initialize \\Pi to its asymptotic Navier-Stokes value.\n");
-#endif
+		if (EVOLVE_PI(physicsMode)) {
+			printf("Initialize \\Pi to its asymptotic Navier-Stokes value.\n");
+		}
 		setPimunuNavierStokesInitialCondition(latticeParams, initCondParams, hydroParams);
 		return;
 	}
@@ -142,21 +142,21 @@ void setPimunuInitialCondition(void * latticeParams, void * initCondParams, void
 			for(int j = 2; j < ny+2; ++j) {
 				for(int k = 2; k < nz+2; ++k) {
 					int s = columnMajorLinearIndex(i, j, k, nx+4, ny+4);
-#ifdef PIMUNU
-			  		q->pitt[s] = 0;								
-			  		q->pitx[s] = 0;							
-			  		q->pity[s] = 0;						
-			  		q->pitn[s] = 0;								
-			  		q->pixx[s] = 0;			
-			  		q->pixy[s] = 0;				
-			  		q->pixn[s] = 0;								
-			  		q->piyy[s] = 0;			
-			  		q->piyn[s] = 0;								
-			  		q->pinn[s] = 0;	
-#endif
-#ifdef PI
-			  		q->Pi[s] = 0;	
-#endif
+					if (EVOLVE_PIMUNU(physicsMode)) {
+						q->pitt[s] = 0;								
+						q->pitx[s] = 0;							
+						q->pity[s] = 0;						
+						q->pitn[s] = 0;								
+						q->pixx[s] = 0;			
+						q->pixy[s] = 0;				
+						q->pixn[s] = 0;								
+						q->piyy[s] = 0;			
+						q->piyn[s] = 0;								
+						q->pinn[s] = 0;	
+					}
+					if (EVOLVE_PI(physicsMode)) {
+						q->Pi[s] = 0;	
+					}
 				}
 			}
 		}
@@ -439,18 +439,18 @@ void setISGubserInitialCondition(void * latticeParams, const char *rootDirectory
 				u->uy[s] = u2;
 				u->un[s] = 0;
 				u->ut[s] = sqrt(1 + u1*u1 + u2*u2);
-#ifdef PIMUNU
-        		q->pitt[s] = (PRECISION) pitt;								
-        		q->pitx[s] = (PRECISION) pitx;							
-        		q->pity[s] = (PRECISION) pity;						
-        		q->pitn[s] = (PRECISION) pitn;								
-        		q->pixx[s] = (PRECISION) pixx;			
-        		q->pixy[s] = (PRECISION) pixy;				
-        		q->pixn[s] = (PRECISION) pixn;								
-        		q->piyy[s] = (PRECISION) piyy;			
-        		q->piyn[s] = (PRECISION) piyn;								
-        		q->pinn[s] = (PRECISION) pinn;			
-#endif			
+				if (EVOLVE_PIMUNU(physicsMode)) {
+					q->pitt[s] = (PRECISION) pitt;								
+					q->pitx[s] = (PRECISION) pitx;							
+					q->pity[s] = (PRECISION) pity;						
+					q->pitn[s] = (PRECISION) pitn;								
+					q->pixx[s] = (PRECISION) pixx;			
+					q->pixy[s] = (PRECISION) pixy;				
+					q->pixn[s] = (PRECISION) pixn;								
+					q->piyy[s] = (PRECISION) piyy;			
+					q->piyn[s] = (PRECISION) piyn;								
+					q->pinn[s] = (PRECISION) pinn;			
+				}
 			}
 		}
 	}
@@ -481,8 +481,8 @@ void setSodShockTubeInitialCondition(void * latticeParams, void * initCondParams
 
 			for(int k = 2; k < nz+2; ++k) {
 				int s = columnMajorLinearIndex(i, j, k, nx+4, ny+4);
-				if(x > 0) 	e[s] = (PRECISION) (0.00778147);
-				else 			e[s] = (PRECISION) (0.124503);
+				if(x > 0) 	e[s] = (PRECISION) (SOD_SHOCK_TUBE_RIGHT_ENERGY_DENSITY);
+				else 			e[s] = (PRECISION) (SOD_SHOCK_TUBE_LEFT_ENERGY_DENSITY);
 //				if(y > 0) 	e[s] = (PRECISION) (0.00778147);
 //				else 			e[s] = (PRECISION) (0.124503);
 //				if(x > 0) 	e[s] = (PRECISION) (1.0);
@@ -522,9 +522,9 @@ void set2dSodShockTubeInitialCondition(void * latticeParams, void * initCondPara
 
 			for(int k = 2; k < nz+2; ++k) {
 				int s = columnMajorLinearIndex(i, j, k, nx+4, ny+4);
-				if(y > x) 	e[s] = (PRECISION) (0.00778147);
+				if(y > x) 	e[s] = (PRECISION) (SOD_SHOCK_TUBE_RIGHT_ENERGY_DENSITY);
 //				if(atan(y/x)>0.7853981634) 	e[s] = (PRECISION) (0.00778147);
-				else 			e[s] = (PRECISION) (0.124503);
+				else 			e[s] = (PRECISION) (SOD_SHOCK_TUBE_LEFT_ENERGY_DENSITY);
 				p[s] = e[s]/3;
 				u->ux[s] = 0;
 				u->uy[s] = 0;
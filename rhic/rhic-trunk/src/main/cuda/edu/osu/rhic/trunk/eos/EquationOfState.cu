@@ -9,6 +9,7 @@
 
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 #include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfStateTable.cuh"
 /****************************************************************************\
  * Parameterization based on the Equation of state from the Wuppertal-Budapest collaboration
  * Tref 1.01355
@@ -28,8 +29,7 @@
 /****************************************************************************/
 
 __host__ __device__
-PRECISION equilibriumPressure(PRECISION e) {
-#ifndef CONFORMAL_EOS
+PRECISION equilibriumPressureParametrized(PRECISION e) {
     // Equation of state from the Wuppertal-Budapest collaboration
     double e1 = (double)e;
     double e2 = e*e;
@@ -74,14 +74,10 @@ PRECISION equilibriumPressure(PRECISION e) {
 	double b12 = 3.2581066229887368e-18;
 	PRECISION b = (PRECISION)fma(b12,e12,fma(b11,e11,fma(b10,e10,fma(b9,e9,fma(b8,e8,fma(b7,e7,fma(b6,e6,fma(b5,e5,fma(b4,e4,fma(b3,e3,fma(b2,e2,fma(b1,e1,b0))))))))))));
     return a/b;
-#else
-    return e/3;
-#endif
 }
 
 __host__ __device__
-PRECISION speedOfSoundSquared(PRECISION e) {
-#ifndef CONFORMAL_EOS
+PRECISION speedOfSoundSquaredParametrized(PRECISION e) {
 	// Speed of sound from the Wuppertal-Budapest collaboration
 	double e1 = (double) e;
 	double e2 = e * e1;
@@ -110,14 +106,10 @@ PRECISION speedOfSoundSquared(PRECISION e) {
 					+ 15190.225535036281 * e8 + 590.2572000057821 * e9
 					+ 293.99144775704605 * e10 + 21.461303090563028 * e11
 					+ 0.09301685073435291 * e12 + 0.000024810902623582917 * e13);
-#else
-	return 1/3;
-#endif
 }
 
 __host__ __device__
-PRECISION effectiveTemperature(PRECISION e) {
-#ifndef CONFORMAL_EOS
+PRECISION effectiveTemperatureParametrized(PRECISION e) {
 	// Effective temperature from the Wuppertal-Budapest collaboration
 	double e1 = (double) e;
 	double e2 = e * e1;
@@ -142,14 +134,10 @@ PRECISION effectiveTemperature(PRECISION e) {
 					+ 11179.193315394154 * e6 + 17965.67607192861 * e7
 					+ 1051.0730543534657 * e8 + 5.916312075925817 * e9
 					+ 0.003778342768228011 * e10 + 1.8472801679382593e-7 * e11);
-#else
-	return powf(e/EOS_FACTOR, 0.25);
-#endif
 }
 
 __host__ __device__
-PRECISION equilibriumEnergyDensity(PRECISION T) {
-#ifndef CONFORMAL_EOS
+PRECISION equilibriumEnergyDensityParametrized(PRECISION T) {
 	// Effective temperature from the Wuppertal-Budapest collaboration
 	double T1 = (double) T;
 	double T2 = T1 * T1;
@@ -198,7 +186,52 @@ PRECISION equilibriumEnergyDensity(PRECISION T) {
 					+ 1591.3177623932843 * T18 - 678.748230997762 * T19
 					- 33.58687934953277 * T20 + 3.2520554133126285 * T21
 					- 0.19647288043440464 * T22 + 0.005443394551264717 * T23);
+}
+
+__host__ __device__
+PRECISION equilibriumPressure(PRECISION e) {
+#ifndef CONFORMAL_EOS
+#ifdef TABULATED_EOS
+	return interpolateEquationOfState(EOS_TABLE_PRESSURE, e);
+#else
+	return equilibriumPressureParametrized(e);
+#endif
+#else
+    return e/3;
+#endif
+}
+
+__host__ __device__
+PRECISION speedOfSoundSquared(PRECISION e) {
+#ifndef CONFORMAL_EOS
+#ifdef TABULATED_EOS
+	return interpolateEquationOfState(EOS_TABLE_SPEED_OF_SOUND_SQUARED, e);
+#else
+	return speedOfSoundSquaredParametrized(e);
+#endif
+#else
+	return 1/3;
+#endif
+}
+
+__host__ __device__
+PRECISION effectiveTemperature(PRECISION e) {
+#ifndef CONFORMAL_EOS
+#ifdef TABULATED_EOS
+	return interpolateEquationOfState(EOS_TABLE_TEMPERATURE, e);
+#else
+	return effectiveTemperatureParametrized(e);
+#endif
+#else
+	return pow((PRECISION) (e/EOS_FACTOR), (PRECISION) 0.25);
+#endif
+}
+
+__host__ __device__
+PRECISION equilibriumEnergyDensity(PRECISION T) {
+#ifndef CONFORMAL_EOS
+	return equilibriumEnergyDensityParametrized(T);
 #else
-	return EOS_FACTOR*powf(T, 4.0);
+	return EOS_FACTOR*pow(T, (PRECISION) 4);
 #endif
 }
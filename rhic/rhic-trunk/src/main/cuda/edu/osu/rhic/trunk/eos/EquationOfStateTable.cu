@@ -0,0 +1,218 @@
+/*
+ * EquationOfStateTable.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/eos/EquationOfStateTable.cuh"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
+
+#define EOS_TABLE_LOG_MIN_ENERGY_DENSITY log(EOS_TABLE_MIN_ENERGY_DENSITY)
+#define EOS_TABLE_LOG_SPACING ((log(EOS_TABLE_MAX_ENERGY_DENSITY) - log(EOS_TABLE_MIN_ENERGY_DENSITY)) / (EOS_TABLE_SIZE - 1))
+
+__device__ PRECISION d_eosTable[NUMBER_EOS_TABLE_FUNCTIONS][EOS_TABLE_SIZE][2];
+PRECISION h_eosTable[NUMBER_EOS_TABLE_FUNCTIONS][EOS_TABLE_SIZE][2];
+
+const char *eosTableFunctionNames[NUMBER_EOS_TABLE_FUNCTIONS] = { "p", "cs2", "T" };
+
+__host__ __device__
+PRECISION evaluateEquationOfState(int function, PRECISION e) {
+	switch (function) {
+		case EOS_TABLE_PRESSURE: return equilibriumPressureParametrized(e);
+		case EOS_TABLE_SPEED_OF_SOUND_SQUARED: return speedOfSoundSquaredParametrized(e);
+		default: return effectiveTemperatureParametrized(e);
+	}
+}
+
+__host__ __device__
+PRECISION interpolateEquationOfState(int function, PRECISION e) {
+	const PRECISION logMin = (PRECISION) EOS_TABLE_LOG_MIN_ENERGY_DENSITY;
+	const PRECISION inverseSpacing = (PRECISION) (1 / EOS_TABLE_LOG_SPACING);
+
+	PRECISION x = (log(e) - logMin) * inverseSpacing;
+	// also catches e <= 0 and nan
+	if (!(x >= 0 && x < EOS_TABLE_SIZE - 1)) return evaluateEquationOfState(function, e);
+	int i = (int) x;
+	PRECISION s = x - i;
+	PRECISION s2 = s * s;
+	PRECISION s3 = s2 * s;
+
+	const PRECISION (* const table)[2] = CONST_PARAM(eosTable)[function];
+	PRECISION y0 = table[i][EOS_TABLE_VALUE];
+	PRECISION m0 = table[i][EOS_TABLE_SLOPE];
+	PRECISION y1 = table[i+1][EOS_TABLE_VALUE];
+	PRECISION m1 = table[i+1][EOS_TABLE_SLOPE];
+	// cubic Hermite basis functions
+	return (2*s3 - 3*s2 + 1) * y0 + (s3 - 2*s2 + s) * m0 + (3*s2 - 2*s3) * y1 + (s3 - s2) * m1;
+}
+
+// Fritsch-Carlson slopes of the n uniformly spaced values y, per node spacing
+static void setMonotoneSlopes(const double * const y, double * const m, int n) {
+	double *d = (double *) malloc((n - 1) * sizeof(double));
+	for (int k = 0; k < n - 1; ++k) d[k] = y[k+1] - y[k];
+
+	m[0] = d[0];
+	m[n-1] = d[n-2];
+	for (int k = 1; k < n - 1; ++k) m[k] = (d[k-1] * d[k] <= 0) ? 0 : (d[k-1] + d[k]) / 2;
+	for (int k = 0; k < n - 1; ++k) {
+		if (d[k] == 0) {
+			m[k] = 0;
+			m[k+1] = 0;
+			continue;
+		}
+		double a = m[k] / d[k];
+		double b = m[k+1] / d[k];
+		double r = a * a + b * b;
+		if (r > 9) {
+			double tau = 3 / sqrt(r);
+			m[k] = tau * a * d[k];
+			m[k+1] = tau * b * d[k];
+		}
+	}
+	free(d);
+}
+
+void initializeEquationOfStateTable(bool host) {
+	double *y = (double *) malloc(EOS_TABLE_SIZE * sizeof(double));
+	double *m = (double *) malloc(EOS_TABLE_SIZE * sizeof(double));
+	for (int f = 0; f < NUMBER_EOS_TABLE_FUNCTIONS; ++f) {
+		for (int i = 0; i < EOS_TABLE_SIZE; ++i) {
+			double e = exp(EOS_TABLE_LOG_MIN_ENERGY_DENSITY + i * EOS_TABLE_LOG_SPACING);
+			y[i] = (double) evaluateEquationOfState(f, (PRECISION) e);
+		}
+		setMonotoneSlopes(y, m, EOS_TABLE_SIZE);
+		for (int i = 0; i < EOS_TABLE_SIZE; ++i) {
+			h_eosTable[f][i][EOS_TABLE_VALUE] = (PRECISION) y[i];
+			h_eosTable[f][i][EOS_TABLE_SLOPE] = (PRECISION) m[i];
+		}
+	}
+	free(y);
+	free(m);
+
+	if (!host) cudaMemcpyToSymbol(d_eosTable, h_eosTable, sizeof(h_eosTable));
+}
+
+double equationOfStateTableError(int function, double *atEnergyDensity) {
+	const int samplesPerInterval = 16;
+	double maxError = 0;
+	*atEnergyDensity = EOS_TABLE_MIN_ENERGY_DENSITY;
+	for (int i = 0; i < EOS_TABLE_SIZE - 1; ++i) {
+		for (int j = 1; j < samplesPerInterval; ++j) {
+			double e = exp(EOS_TABLE_LOG_MIN_ENERGY_DENSITY + (i + j / (double) samplesPerInterval) * EOS_TABLE_LOG_SPACING);
+			double exact = (double) evaluateEquationOfState(function, (PRECISION) e);
+			double tabulated = (double) interpolateEquationOfState(function, (PRECISION) e);
+			// the parametrized pressure changes sign at e ~ 3e-5 fm^-4, so its error is taken relative to e
+			double scale = (function == EOS_TABLE_PRESSURE) ? e : fabs(exact);
+			double error = fabs(tabulated - exact) / scale;
+			if (error > maxError) {
+				maxError = error;
+				*atEnergyDensity = e;
+			}
+		}
+	}
+	return maxError;
+}
+
+void printEquationOfStateTableError() {
+	printf("EoS table: %d nodes for %.1e <= e <= %.1e [fm^-4]\n", EOS_TABLE_SIZE, EOS_TABLE_MIN_ENERGY_DENSITY, EOS_TABLE_MAX_ENERGY_DENSITY);
+	for (int f = 0; f < NUMBER_EOS_TABLE_FUNCTIONS; ++f) {
+		double e;
+		double error = equationOfStateTableError(f, &e);
+		printf("\t%s: max relative error %.3e at e = %.3e [fm^-4]\n", eosTableFunctionNames[f], error, e);
+	}
+}
+
+/**************************************************************************************************************************************************/
+// Microbenchmark
+/**************************************************************************************************************************************************/
+// energy densities from the dilute edge to the center of a central collision [fm^-4]
+#define EOS_BENCHMARK_SAMPLES 4096
+#define EOS_BENCHMARK_MIN_ENERGY_DENSITY 1.e-3
+#define EOS_BENCHMARK_MAX_ENERGY_DENSITY 1.e3
+#define EOS_BENCHMARK_THREADS 65536
+#define EOS_BENCHMARK_BLOCK_SIZE 256
+
+__global__
+void benchmarkEquationOfStateKernel(int function, bool tabulated, const PRECISION * const __restrict__ samples, int callsPerThread,
+		PRECISION * const __restrict__ result) {
+	int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+	PRECISION sum = 0;
+	for (int n = 0; n < callsPerThread; ++n) {
+		PRECISION e = samples[(threadID + n) % EOS_BENCHMARK_SAMPLES];
+		sum += tabulated ? interpolateEquationOfState(function, e) : evaluateEquationOfState(function, e);
+	}
+	result[threadID] = sum;
+}
+
+static double benchmarkHost(int function, bool tabulated, const PRECISION * const samples, int calls) {
+	volatile PRECISION sink;
+	PRECISION sum = 0;
+	double start = monotonicTime();
+	for (int n = 0; n < calls; ++n) {
+		PRECISION e = samples[n % EOS_BENCHMARK_SAMPLES];
+		sum += tabulated ? interpolateEquationOfState(function, e) : evaluateEquationOfState(function, e);
+	}
+	double elapsedTime = monotonicTime() - start;
+	sink = sum;
+	return 1.e6 * elapsedTime / calls;
+}
+
+static double benchmarkDevice(int function, bool tabulated, const PRECISION * const d_samples, PRECISION * const d_result, int calls) {
+	int callsPerThread = calls / EOS_BENCHMARK_THREADS > 0 ? calls / EOS_BENCHMARK_THREADS : 1;
+	int grid = EOS_BENCHMARK_THREADS / EOS_BENCHMARK_BLOCK_SIZE;
+	// untimed launch to exclude first-launch costs
+	benchmarkEquationOfStateKernel<<<grid, EOS_BENCHMARK_BLOCK_SIZE>>>(function, tabulated, d_samples, 1, d_result);
+	cudaDeviceSynchronize();
+	double start = monotonicTime();
+	benchmarkEquationOfStateKernel<<<grid, EOS_BENCHMARK_BLOCK_SIZE>>>(function, tabulated, d_samples, callsPerThread, d_result);
+	cudaDeviceSynchronize();
+	double elapsedTime = monotonicTime() - start;
+	return 1.e6 * elapsedTime / ((double) callsPerThread * EOS_BENCHMARK_THREADS);
+}
+
+void benchmarkEquationOfState(int calls, bool host) {
+	initializeEquationOfStateTable(host);
+	printEquationOfStateTableError();
+
+	PRECISION *samples = (PRECISION *) malloc(EOS_BENCHMARK_SAMPLES * sizeof(PRECISION));
+	// shuffled so that consecutive calls do not hit neighbouring table nodes
+	srand(1);
+	for (int n = 0; n < EOS_BENCHMARK_SAMPLES; ++n) {
+		double r = rand() / (double) RAND_MAX;
+		samples[n] = (PRECISION) (EOS_BENCHMARK_MIN_ENERGY_DENSITY * pow(EOS_BENCHMARK_MAX_ENERGY_DENSITY / EOS_BENCHMARK_MIN_ENERGY_DENSITY, r));
+	}
+
+	PRECISION *d_samples, *d_result;
+	if (!host) {
+		cudaMalloc((void **) &d_samples, EOS_BENCHMARK_SAMPLES * sizeof(PRECISION));
+		cudaMalloc((void **) &d_result, EOS_BENCHMARK_THREADS * sizeof(PRECISION));
+		cudaMemcpy(d_samples, samples, EOS_BENCHMARK_SAMPLES * sizeof(PRECISION), cudaMemcpyHostToDevice);
+	}
+
+	printf("===================================================\n");
+	printf("EoS cost per call [ns] (%d calls, %.0e <= e <= %.0e [fm^-4])\n", calls, EOS_BENCHMARK_MIN_ENERGY_DENSITY, EOS_BENCHMARK_MAX_ENERGY_DENSITY);
+	printf("\t\thost parametrized\thost tabulated");
+	if (!host) printf("\tdevice parametrized\tdevice tabulated");
+	printf("\n");
+	for (int f = 0; f < NUMBER_EOS_TABLE_FUNCTIONS; ++f) {
+		printf("%s\t\t%.3f\t\t\t%.3f", eosTableFunctionNames[f],
+				benchmarkHost(f, false, samples, calls), benchmarkHost(f, true, samples, calls));
+		if (!host) printf("\t\t\t%.4f\t\t\t%.4f",
+				benchmarkDevice(f, false, d_samples, d_result, calls), benchmarkDevice(f, true, d_samples, d_result, calls));
+		printf("\n");
+	}
+	printf("===================================================\n");
+
+	if (!host) {
+		cudaFree(d_samples);
+		cudaFree(d_result);
+	}
+	free(samples);
+}
@@ -4,6 +4,9 @@
  *  Created on: Oct 22, 2015
  *      Author: bazow
  */
+#include <stdlib.h>
+#include <string.h> // for memcpy
+
 #include <cuda.h>
 #include <cuda_runtime.h>
 
@@ -12,11 +15,30 @@
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 
+int physicsMode;
+int latticeDimensions = LATTICE_3D;
+
+static const char * const latticeDimensionsNames[NUMBER_LATTICE_DIMENSIONS] = {
+	"3D", "2D (boost invariant)", "1D"
+};
+
+int getLatticeDimensions(void * latticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	if (lattice->numLatticePointsRapidity != 1) return LATTICE_3D;
+	return (lattice->numLatticePointsY == 1) ? LATTICE_1D : LATTICE_2D;
+}
+
+const char * getLatticeDimensionsName(int dimensions) {
+	return latticeDimensionsNames[dimensions];
+}
+
 CONSERVED_VARIABLES *q;
 CONSERVED_VARIABLES *d_q, *d_Q, *d_qS;
+CONSERVED_VARIABLES *h_Q, *h_qS;
 
 FLUID_VELOCITY *u;
 FLUID_VELOCITY *d_u, *d_up, *d_uS;
+FLUID_VELOCITY *h_up, *h_uS;
 
 PRECISION *e, *p;
 PRECISION *d_e, *d_p;
@@ -51,24 +73,29 @@ void allocateHostMemory(int len) {
 	q->tty = (PRECISION *) calloc(len, bytes);
 	q->ttn = (PRECISION *) calloc(len, bytes);
 	// allocate space for \pi^\mu\nu
-#ifdef PIMUNU
-	q->pitt = (PRECISION *) calloc(len, bytes);
-	q->pitx = (PRECISION *) calloc(len, bytes);
-	q->pity = (PRECISION *) calloc(len, bytes);
-	q->pitn = (PRECISION *) calloc(len, bytes);
-	q->pixx = (PRECISION *) calloc(len, bytes);
-	q->pixy = (PRECISION *) calloc(len, bytes);
-	q->pixn = (PRECISION *) calloc(len, bytes);
-	q->piyy = (PRECISION *) calloc(len, bytes);
-	q->piyn = (PRECISION *) calloc(len, bytes);
-	q->pinn = (PRECISION *) calloc(len, bytes);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		q->pitt = (PRECISION *) calloc(len, bytes);
+		q->pitx = (PRECISION *) calloc(len, bytes);
+		q->pity = (PRECISION *) calloc(len, bytes);
+		q->pitn = (PRECISION *) calloc(len, bytes);
+		q->pixx = (PRECISION *) calloc(len, bytes);
+		q->pixy = (PRECISION *) calloc(len, bytes);
+		q->pixn = (PRECISION *) calloc(len, bytes);
+		q->piyy = (PRECISION *) calloc(len, bytes);
+		q->piyn = (PRECISION *) calloc(len, bytes);
+		q->pinn = (PRECISION *) calloc(len, bytes);
+	}
 	// allocate space for \Pi
-#ifdef PI
-	q->Pi = (PRECISION *) calloc(len, bytes);
-#endif
+	if (EVOLVE_PI(physicsMode)) {
+		q->Pi = (PRECISION *) calloc(len, bytes);
+	}
 
+	// the arrays are allocated by allocateValidityDomainHostMemory
 	validityDomain = (VALIDITY_DOMAIN *) calloc(1, sizeof(VALIDITY_DOMAIN));
+}
+
+void allocateValidityDomainHostMemory(int len) {
+	size_t bytes = sizeof(PRECISION);
 	validityDomain->regulations = (PRECISION *) calloc(len, bytes);
 	validityDomain->knudsenNumberTaupi = (PRECISION *) calloc(len, bytes);
 	validityDomain->knudsenNumberTauPi = (PRECISION *) calloc(len, bytes);
@@ -85,6 +112,58 @@ void allocateHostMemory(int len) {
 	validityDomain->theta = (PRECISION *) calloc(len, bytes);
 }
 
+FLUID_VELOCITY * allocateIntermidateFluidVelocityHostMemory(int len) {
+	size_t bytes = sizeof(PRECISION);
+	FLUID_VELOCITY *v = (FLUID_VELOCITY *) calloc(1, sizeof(FLUID_VELOCITY));
+	v->ut = (PRECISION *) calloc(len, bytes);
+	v->ux = (PRECISION *) calloc(len, bytes);
+	v->uy = (PRECISION *) calloc(len, bytes);
+	v->un = (PRECISION *) calloc(len, bytes);
+	return v;
+}
+
+CONSERVED_VARIABLES * allocateIntermidateConservedVarHostMemory(int len) {
+	size_t bytes = sizeof(PRECISION);
+	CONSERVED_VARIABLES *c = (CONSERVED_VARIABLES *) calloc(1, sizeof(CONSERVED_VARIABLES));
+	c->ttt = (PRECISION *) calloc(len, bytes);
+	c->ttx = (PRECISION *) calloc(len, bytes);
+	c->tty = (PRECISION *) calloc(len, bytes);
+	c->ttn = (PRECISION *) calloc(len, bytes);
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		c->pitt = (PRECISION *) calloc(len, bytes);
+		c->pitx = (PRECISION *) calloc(len, bytes);
+		c->pity = (PRECISION *) calloc(len, bytes);
+		c->pitn = (PRECISION *) calloc(len, bytes);
+		c->pixx = (PRECISION *) calloc(len, bytes);
+		c->pixy = (PRECISION *) calloc(len, bytes);
+		c->pixn = (PRECISION *) calloc(len, bytes);
+		c->piyy = (PRECISION *) calloc(len, bytes);
+		c->piyn = (PRECISION *) calloc(len, bytes);
+		c->pinn = (PRECISION *) calloc(len, bytes);
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		c->Pi = (PRECISION *) calloc(len, bytes);
+	}
+	return c;
+}
+
+/*
+ * Host counterparts of d_Q, d_qS, d_up and d_uS for the CPU backend. Must be called after the
+ * initial conditions are set, since the previous fluid velocity starts out equal to u.
+ */
+void allocateIntermediateHostMemory(int len) {
+	h_Q = allocateIntermidateConservedVarHostMemory(len);
+	h_qS = allocateIntermidateConservedVarHostMemory(len);
+	h_uS = allocateIntermidateFluidVelocityHostMemory(len);
+	h_up = allocateIntermidateFluidVelocityHostMemory(len);
+
+	size_t bytes = len * sizeof(PRECISION);
+	memcpy(h_up->ut, u->ut, bytes);
+	memcpy(h_up->ux, u->ux, bytes);
+	memcpy(h_up->uy, u->uy, bytes);
+	memcpy(h_up->un, u->un, bytes);
+}
+
 void allocateIntermidateFluidVelocityDeviceMemory(FLUID_VELOCITY *d_u, size_t size2) {
 	PRECISION *d_ut, *d_ux, *d_uy, *d_un;
 	cudaMalloc((void **) &d_ut, size2);
@@ -113,35 +192,35 @@ void allocateIntermidateConservedVarDeviceMemory(CONSERVED_VARIABLES *d_q, size_
 	cudaMemcpy(&(d_q->tty), &d_tty, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 	cudaMemcpy(&(d_q->ttn), &d_ttn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 	// allocate space for \pi^\mu\nu
-#ifdef PIMUNU
-	cudaMalloc((void **) &d_pitt, bytes);
-	cudaMalloc((void **) &d_pitx, bytes);
-	cudaMalloc((void **) &d_pity, bytes);
-	cudaMalloc((void **) &d_pitn, bytes);
-	cudaMalloc((void **) &d_pixx, bytes);
-	cudaMalloc((void **) &d_pixy, bytes);
-	cudaMalloc((void **) &d_pixn, bytes);
-	cudaMalloc((void **) &d_piyy, bytes);
-	cudaMalloc((void **) &d_piyn, bytes);
-	cudaMalloc((void **) &d_pinn, bytes);
-
-	cudaMemcpy(&(d_q->pitt), &d_pitt, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pitx), &d_pitx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pity), &d_pity, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pitn), &d_pitn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixx), &d_pixx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixy), &d_pixy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixn), &d_pixn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->piyy), &d_piyy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->piyn), &d_piyn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pinn), &d_pinn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		cudaMalloc((void **) &d_pitt, bytes);
+		cudaMalloc((void **) &d_pitx, bytes);
+		cudaMalloc((void **) &d_pity, bytes);
+		cudaMalloc((void **) &d_pitn, bytes);
+		cudaMalloc((void **) &d_pixx, bytes);
+		cudaMalloc((void **) &d_pixy, bytes);
+		cudaMalloc((void **) &d_pixn, bytes);
+		cudaMalloc((void **) &d_piyy, bytes);
+		cudaMalloc((void **) &d_piyn, bytes);
+		cudaMalloc((void **) &d_pinn, bytes);
+
+		cudaMemcpy(&(d_q->pitt), &d_pitt, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pitx), &d_pitx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pity), &d_pity, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pitn), &d_pitn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixx), &d_pixx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixy), &d_pixy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixn), &d_pixn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->piyy), &d_piyy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->piyn), &d_piyn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pinn), &d_pinn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+	}
 	// allocate space for \Pi
-#ifdef PI
-	cudaMalloc((void **) &d_Pi, bytes);
+	if (EVOLVE_PI(physicsMode)) {
+		cudaMalloc((void **) &d_Pi, bytes);
 
-	cudaMemcpy(&(d_q->Pi), &d_Pi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-#endif
+		cudaMemcpy(&(d_q->Pi), &d_Pi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+	}
 }
 
 void allocateDeviceMemory(size_t bytes) {
@@ -188,6 +267,10 @@ void allocateDeviceMemory(size_t bytes) {
 	cudaMalloc((void**) &d_q, sizeof(CONSERVED_VARIABLES));
 	cudaMalloc((void**) &d_Q, sizeof(CONSERVED_VARIABLES));
 	cudaMalloc((void**) &d_qS, sizeof(CONSERVED_VARIABLES));
+	// dissipative currents that are not evolved keep NULL pointers
+	cudaMemset(d_q, 0, sizeof(CONSERVED_VARIABLES));
+	cudaMemset(d_Q, 0, sizeof(CONSERVED_VARIABLES));
+	cudaMemset(d_qS, 0, sizeof(CONSERVED_VARIABLES));
 
 	cudaMemcpy(&(d_q->ttt), &d_ttt, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 	cudaMemcpy(&(d_q->ttx), &d_ttx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
@@ -195,35 +278,35 @@ void allocateDeviceMemory(size_t bytes) {
 	cudaMemcpy(&(d_q->ttn), &d_ttn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 
 	// allocate space for \pi^\mu\nu
-#ifdef PIMUNU
-	cudaMalloc((void **) &d_pitt, bytes);
-	cudaMalloc((void **) &d_pitx, bytes);
-	cudaMalloc((void **) &d_pity, bytes);
-	cudaMalloc((void **) &d_pitn, bytes);
-	cudaMalloc((void **) &d_pixx, bytes);
-	cudaMalloc((void **) &d_pixy, bytes);
-	cudaMalloc((void **) &d_pixn, bytes);
-	cudaMalloc((void **) &d_piyy, bytes);
-	cudaMalloc((void **) &d_piyn, bytes);
-	cudaMalloc((void **) &d_pinn, bytes);
-
-	cudaMemcpy(&(d_q->pitt), &d_pitt, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pitx), &d_pitx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pity), &d_pity, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pitn), &d_pitn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixx), &d_pixx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixy), &d_pixy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pixn), &d_pixn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->piyy), &d_piyy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->piyn), &d_piyn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-	cudaMemcpy(&(d_q->pinn), &d_pinn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		cudaMalloc((void **) &d_pitt, bytes);
+		cudaMalloc((void **) &d_pitx, bytes);
+		cudaMalloc((void **) &d_pity, bytes);
+		cudaMalloc((void **) &d_pitn, bytes);
+		cudaMalloc((void **) &d_pixx, bytes);
+		cudaMalloc((void **) &d_pixy, bytes);
+		cudaMalloc((void **) &d_pixn, bytes);
+		cudaMalloc((void **) &d_piyy, bytes);
+		cudaMalloc((void **) &d_piyn, bytes);
+		cudaMalloc((void **) &d_pinn, bytes);
+
+		cudaMemcpy(&(d_q->pitt), &d_pitt, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pitx), &d_pitx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pity), &d_pity, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pitn), &d_pitn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixx), &d_pixx, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixy), &d_pixy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pixn), &d_pixn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->piyy), &d_piyy, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->piyn), &d_piyn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+		cudaMemcpy(&(d_q->pinn), &d_pinn, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+	}
 	// allocate space for \Pi
-#ifdef PI
-	cudaMalloc((void **) &d_Pi, bytes);
+	if (EVOLVE_PI(physicsMode)) {
+		cudaMalloc((void **) &d_Pi, bytes);
 
-	cudaMemcpy(&(d_q->Pi), &d_Pi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
-#endif
+		cudaMemcpy(&(d_q->Pi), &d_Pi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
+	}
 
 	//=======================================================
 	// Intermediate fluid velocity/conserved variables
@@ -233,8 +316,13 @@ void allocateDeviceMemory(size_t bytes) {
 	allocateIntermidateFluidVelocityDeviceMemory(d_uS, bytes);
 
 	//=======================================================
-	// Hydrodynamic validity
+	// Hydrodynamic validity, without arrays until allocateValidityDomainDeviceMemory
 	//=======================================================
+	cudaMalloc((void**) &d_validityDomain, sizeof(VALIDITY_DOMAIN));
+	cudaMemset(d_validityDomain, 0, sizeof(VALIDITY_DOMAIN));
+}
+
+void allocateValidityDomainDeviceMemory(size_t bytes) {
 	cudaMalloc((void **) &d_regulations, bytes);
 	cudaMalloc((void **) &d_knudsenNumberTaupi, bytes);
 	cudaMalloc((void **) &d_knudsenNumberTauPi, bytes);
@@ -250,8 +338,6 @@ void allocateDeviceMemory(size_t bytes) {
 	cudaMalloc((void **) &d_dyuy, bytes);
 	cudaMalloc((void **) &d_theta, bytes);
 
-	cudaMalloc((void**) &d_validityDomain, sizeof(VALIDITY_DOMAIN));
-
 	cudaMemcpy(&(d_validityDomain->regulations), &d_regulations, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 	cudaMemcpy(&(d_validityDomain->knudsenNumberTaupi), &d_knudsenNumberTaupi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
 	cudaMemcpy(&(d_validityDomain->knudsenNumberTauPi), &d_knudsenNumberTauPi, sizeof(PRECISION*), cudaMemcpyHostToDevice);
@@ -269,66 +355,84 @@ void allocateDeviceMemory(size_t bytes) {
 }
 
 void copyHostToDeviceMemory(size_t bytes) {
+	// the steps of a previous event may have swapped d_q and d_u with d_Q and d_up, so write the arrays they point to now
+	CONSERVED_VARIABLES current;
+	FLUID_VELOCITY velocity, previousVelocity;
+	cudaMemcpy(&current, d_q, sizeof(CONSERVED_VARIABLES), cudaMemcpyDeviceToHost);
+	cudaMemcpy(&velocity, d_u, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+	cudaMemcpy(&previousVelocity, d_up, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+
 	cudaMemcpy(d_e, e, bytes, cudaMemcpyHostToDevice);
 	cudaMemcpy(d_p, p, bytes, cudaMemcpyHostToDevice);
 
-	cudaMemcpy(d_ut, u->ut, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_ux, u->ux, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_uy, u->uy, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_un, u->un, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.ut, u->ut, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.ux, u->ux, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.uy, u->uy, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.un, u->un, bytes, cudaMemcpyHostToDevice);
 
-	cudaMemcpy(d_utp, u->ut, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_uxp, u->ux, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_uyp, u->uy, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_unp, u->un, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(previousVelocity.ut, u->ut, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(previousVelocity.ux, u->ux, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(previousVelocity.uy, u->uy, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(previousVelocity.un, u->un, bytes, cudaMemcpyHostToDevice);
 
-	cudaMemcpy(d_ttt, q->ttt, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_ttx, q->ttx, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_tty, q->tty, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_ttn, q->ttn, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(current.ttt, q->ttt, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(current.ttx, q->ttx, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(current.tty, q->tty, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(current.ttn, q->ttn, bytes, cudaMemcpyHostToDevice);
 	// copy \pi^\mu\nu to device memory
-#ifdef PIMUNU
-	cudaMemcpy(d_pitt, q->pitt, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pitx, q->pitx, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pity, q->pity, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pitn, q->pitn, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pixx, q->pixx, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pixy, q->pixy, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pixn, q->pixn, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_piyy, q->piyy, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_piyn, q->piyn, bytes, cudaMemcpyHostToDevice);
-	cudaMemcpy(d_pinn, q->pinn, bytes, cudaMemcpyHostToDevice);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		cudaMemcpy(current.pitt, q->pitt, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pitx, q->pitx, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pity, q->pity, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pitn, q->pitn, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pixx, q->pixx, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pixy, q->pixy, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pixn, q->pixn, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.piyy, q->piyy, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.piyn, q->piyn, bytes, cudaMemcpyHostToDevice);
+		cudaMemcpy(current.pinn, q->pinn, bytes, cudaMemcpyHostToDevice);
+	}
 	// copy \Pi to device memory
-#ifdef PI
-	cudaMemcpy(d_Pi, q->Pi, bytes, cudaMemcpyHostToDevice);
-#endif
-	cudaMemcpy(d_regulations, validityDomain->regulations, bytes, cudaMemcpyHostToDevice);
+	if (EVOLVE_PI(physicsMode)) {
+		cudaMemcpy(current.Pi, q->Pi, bytes, cudaMemcpyHostToDevice);
+	}
+	if (validityDomain->regulations != NULL) cudaMemcpy(d_regulations, validityDomain->regulations, bytes, cudaMemcpyHostToDevice);
 }
 
 void copyDeviceToHostMemory(size_t bytes) {
+	// d_q and d_u are swapped with d_Q and d_up after every step, so read the arrays they point to now
+	CONSERVED_VARIABLES current;
+	FLUID_VELOCITY velocity;
+	cudaMemcpy(&current, d_q, sizeof(CONSERVED_VARIABLES), cudaMemcpyDeviceToHost);
+	cudaMemcpy(&velocity, d_u, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+
 	cudaMemcpy(e, d_e, bytes, cudaMemcpyDeviceToHost);
 	cudaMemcpy(p, d_p, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(u->ut, d_ut, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(u->ux, d_ux, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(u->uy, d_uy, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(u->un, d_un, bytes, cudaMemcpyDeviceToHost);
-#ifdef PIMUNU
-	cudaMemcpy(q->pitt, d_pitt, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pitx, d_pitx, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pity, d_pity, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pitn, d_pitn, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pixx, d_pixx, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pixy, d_pixy, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pixn, d_pixn, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->piyy, d_piyy, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->piyn, d_piyn, bytes, cudaMemcpyDeviceToHost);
-	cudaMemcpy(q->pinn, d_pinn, bytes, cudaMemcpyDeviceToHost);
-#endif
-#ifdef PI
-	cudaMemcpy(q->Pi, d_Pi, bytes, cudaMemcpyDeviceToHost);
-#endif
+	cudaMemcpy(u->ut, velocity.ut, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(u->ux, velocity.ux, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(u->uy, velocity.uy, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(u->un, velocity.un, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(q->ttt, current.ttt, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(q->ttx, current.ttx, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(q->tty, current.tty, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(q->ttn, current.ttn, bytes, cudaMemcpyDeviceToHost);
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		cudaMemcpy(q->pitt, current.pitt, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pitx, current.pitx, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pity, current.pity, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pitn, current.pitn, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pixx, current.pixx, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pixy, current.pixy, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pixn, current.pixn, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->piyy, current.piyy, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->piyn, current.piyn, bytes, cudaMemcpyDeviceToHost);
+		cudaMemcpy(q->pinn, current.pinn, bytes, cudaMemcpyDeviceToHost);
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		cudaMemcpy(q->Pi, current.Pi, bytes, cudaMemcpyDeviceToHost);
+	}
 
+	if (validityDomain->regulations == NULL) return;
 	cudaMemcpy(validityDomain->regulations, d_regulations, bytes, cudaMemcpyDeviceToHost);
 	cudaMemcpy(validityDomain->knudsenNumberTaupi, d_knudsenNumberTaupi, bytes, cudaMemcpyDeviceToHost);
 	cudaMemcpy(validityDomain->knudsenNumberTauPi, d_knudsenNumberTauPi, bytes, cudaMemcpyDeviceToHost);
@@ -345,6 +449,32 @@ void copyDeviceToHostMemory(size_t bytes) {
 	cudaMemcpy(validityDomain->theta, d_theta, bytes, cudaMemcpyDeviceToHost);
 }
 
+/*
+ * The previous fluid velocity d_up is only needed on the host for checkpoints. h_up holds it on
+ * the GPU backend, where the other intermediate host buffers are not allocated.
+ */
+void allocatePreviousFluidVelocityHostMemory(int len) {
+	h_up = allocateIntermidateFluidVelocityHostMemory(len);
+}
+
+void copyPreviousFluidVelocityDeviceToHost(size_t bytes) {
+	FLUID_VELOCITY velocity;
+	cudaMemcpy(&velocity, d_up, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+	cudaMemcpy(h_up->ut, velocity.ut, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(h_up->ux, velocity.ux, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(h_up->uy, velocity.uy, bytes, cudaMemcpyDeviceToHost);
+	cudaMemcpy(h_up->un, velocity.un, bytes, cudaMemcpyDeviceToHost);
+}
+
+void copyPreviousFluidVelocityHostToDevice(size_t bytes) {
+	FLUID_VELOCITY velocity;
+	cudaMemcpy(&velocity, d_up, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+	cudaMemcpy(velocity.ut, h_up->ut, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.ux, h_up->ux, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.uy, h_up->uy, bytes, cudaMemcpyHostToDevice);
+	cudaMemcpy(velocity.un, h_up->un, bytes, cudaMemcpyHostToDevice);
+}
+
 void setConservedVariables(double t, void * latticeParams) {
 	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
 
@@ -370,16 +500,16 @@ void setConservedVariables(double t, void * latticeParams) {
 				PRECISION pitx_s = 0;
 				PRECISION pity_s = 0;
 				PRECISION pitn_s = 0;
-#ifdef PIMUNU
-				pitt_s = q->pitt[s];
-				pitx_s = q->pitx[s];
-				pity_s = q->pity[s];
-				pitn_s = q->pitn[s];
-#endif
+				if (EVOLVE_PIMUNU(physicsMode)) {
+					pitt_s = q->pitt[s];
+					pitx_s = q->pitx[s];
+					pity_s = q->pity[s];
+					pitn_s = q->pitn[s];
+				}
 				PRECISION Pi_s = 0;
-#ifdef PI
-				Pi_s = q->Pi[s];
-#endif
+				if (EVOLVE_PI(physicsMode)) {
+					Pi_s = q->Pi[s];
+				}
 
 				q->ttt[s] = Ttt(e_s, p_s + Pi_s, ut_s, pitt_s);
 				q->ttx[s] = Ttx(e_s, p_s + Pi_s, ut_s, ux_s, pitx_s);
@@ -400,12 +530,84 @@ void setCurrentConservedVariables() {
 	swap(&d_q, &d_Q);
 }
 
+void setCurrentConservedVariablesHost() {
+	swap(&q, &h_Q);
+}
+
 void swapFluidVelocity(FLUID_VELOCITY **arr1, FLUID_VELOCITY **arr2) {
 	FLUID_VELOCITY *tmp = *arr1;
 	*arr1 = *arr2;
 	*arr2 = tmp;
 }
 
+static void clearConservedVariables(CONSERVED_VARIABLES *c, size_t bytes) {
+	memset(c->ttt, 0, bytes);
+	memset(c->ttx, 0, bytes);
+	memset(c->tty, 0, bytes);
+	memset(c->ttn, 0, bytes);
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		memset(c->pitt, 0, bytes);
+		memset(c->pitx, 0, bytes);
+		memset(c->pity, 0, bytes);
+		memset(c->pitn, 0, bytes);
+		memset(c->pixx, 0, bytes);
+		memset(c->pixy, 0, bytes);
+		memset(c->pixn, 0, bytes);
+		memset(c->piyy, 0, bytes);
+		memset(c->piyn, 0, bytes);
+		memset(c->pinn, 0, bytes);
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		memset(c->Pi, 0, bytes);
+	}
+}
+
+static void clearFluidVelocity(FLUID_VELOCITY *v, size_t bytes) {
+	memset(v->ut, 0, bytes);
+	memset(v->ux, 0, bytes);
+	memset(v->uy, 0, bytes);
+	memset(v->un, 0, bytes);
+}
+
+/*
+ * Returns the host arrays of allocateHostMemory to their freshly allocated state, so that another
+ * event can be evolved in them.
+ */
+void clearHostMemory(int len) {
+	size_t bytes = len * sizeof(PRECISION);
+	memset(e, 0, bytes);
+	memset(p, 0, bytes);
+	clearFluidVelocity(u, bytes);
+	clearConservedVariables(q, bytes);
+
+	if (validityDomain->regulations == NULL) return;
+	memset(validityDomain->knudsenNumberTaupi, 0, bytes);
+	memset(validityDomain->knudsenNumberTauPi, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumberPimunu, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumber2Pimunu, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumberTilde2Pimunu, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumberPi, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumber2Pi, 0, bytes);
+	memset(validityDomain->inverseReynoldsNumberTilde2Pi, 0, bytes);
+	for(int s=0; s<len; ++s) validityDomain->regulations[s] = (PRECISION) 1.0;
+	memset(validityDomain->taupi, 0, bytes);
+	memset(validityDomain->dxux, 0, bytes);
+	memset(validityDomain->dyuy, 0, bytes);
+	memset(validityDomain->theta, 0, bytes);
+}
+
+// Counterpart of allocateIntermediateHostMemory for the following events of a batch
+void resetIntermediateHostMemory(int len) {
+	size_t bytes = len * sizeof(PRECISION);
+	clearConservedVariables(h_Q, bytes);
+	clearConservedVariables(h_qS, bytes);
+	clearFluidVelocity(h_uS, bytes);
+	memcpy(h_up->ut, u->ut, bytes);
+	memcpy(h_up->ux, u->ux, bytes);
+	memcpy(h_up->uy, u->uy, bytes);
+	memcpy(h_up->un, u->un, bytes);
+}
+
 void freeHostMemory() {
 	free(e);
 	free(p);
@@ -420,23 +622,82 @@ void freeHostMemory() {
 	free(q->tty);
 	free(q->ttn);
 	// free \pi^\mu\nu
-#ifdef PIMUNU
-	free(q->pitt);
-	free(q->pitx);
-	free(q->pity);
-	free(q->pitn);
-	free(q->pixx);
-	free(q->pixy);
-	free(q->pixn);
-	free(q->piyy);
-	free(q->piyn);
-	free(q->pinn);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		free(q->pitt);
+		free(q->pitx);
+		free(q->pity);
+		free(q->pitn);
+		free(q->pixx);
+		free(q->pixy);
+		free(q->pixn);
+		free(q->piyy);
+		free(q->piyn);
+		free(q->pinn);
+	}
 	// free \Pi
-#ifdef PI
-	free(q->Pi);
-#endif
+	if (EVOLVE_PI(physicsMode)) {
+		free(q->Pi);
+	}
 	free(q);
+
+	if (validityDomain->regulations != NULL) {
+		free(validityDomain->regulations);
+		free(validityDomain->knudsenNumberTaupi);
+		free(validityDomain->knudsenNumberTauPi);
+		free(validityDomain->inverseReynoldsNumberPimunu);
+		free(validityDomain->inverseReynoldsNumber2Pimunu);
+		free(validityDomain->inverseReynoldsNumberTilde2Pimunu);
+		free(validityDomain->inverseReynoldsNumberPi);
+		free(validityDomain->inverseReynoldsNumber2Pi);
+		free(validityDomain->inverseReynoldsNumberTilde2Pi);
+		free(validityDomain->taupi);
+		free(validityDomain->dxux);
+		free(validityDomain->dyuy);
+		free(validityDomain->theta);
+	}
+	free(validityDomain);
+}
+
+void freeIntermidateFluidVelocityHostMemory(FLUID_VELOCITY *v) {
+	free(v->ut);
+	free(v->ux);
+	free(v->uy);
+	free(v->un);
+	free(v);
+}
+
+void freeIntermidateConservedVarHostMemory(CONSERVED_VARIABLES *c) {
+	free(c->ttt);
+	free(c->ttx);
+	free(c->tty);
+	free(c->ttn);
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		free(c->pitt);
+		free(c->pitx);
+		free(c->pity);
+		free(c->pitn);
+		free(c->pixx);
+		free(c->pixy);
+		free(c->pixn);
+		free(c->piyy);
+		free(c->piyn);
+		free(c->pinn);
+	}
+	if (EVOLVE_PI(physicsMode)) {
+		free(c->Pi);
+	}
+	free(c);
+}
+
+void freeIntermediateHostMemory() {
+	freeIntermidateConservedVarHostMemory(h_Q);
+	freeIntermidateConservedVarHostMemory(h_qS);
+	freeIntermidateFluidVelocityHostMemory(h_uS);
+	freeIntermidateFluidVelocityHostMemory(h_up);
+}
+
+void freePreviousFluidVelocityHostMemory() {
+	freeIntermidateFluidVelocityHostMemory(h_up);
 }
 
 void freeDeviceMemory() {
@@ -461,24 +722,41 @@ void freeDeviceMemory() {
 	cudaFree(d_tty);
 	cudaFree(d_ttn);
 	// free \pi^\mu\nu
-#ifdef PIMUNU
-	cudaFree(d_pitt);
-	cudaFree(d_pitx);
-	cudaFree(d_pity);
-	cudaFree(d_pitn);
-	cudaFree(d_pixx);
-	cudaFree(d_pixy);
-	cudaFree(d_pixn);
-	cudaFree(d_piyy);
-	cudaFree(d_piyn);
-	cudaFree(d_pinn);
-#endif
+	if (EVOLVE_PIMUNU(physicsMode)) {
+		cudaFree(d_pitt);
+		cudaFree(d_pitx);
+		cudaFree(d_pity);
+		cudaFree(d_pitn);
+		cudaFree(d_pixx);
+		cudaFree(d_pixy);
+		cudaFree(d_pixn);
+		cudaFree(d_piyy);
+		cudaFree(d_piyn);
+		cudaFree(d_pinn);
+	}
 	// free \Pi
-#ifdef PI
-	cudaFree(d_Pi);
-#endif
+	if (EVOLVE_PI(physicsMode)) {
+		cudaFree(d_Pi);
+	}
 
 	cudaFree(d_q);
 	cudaFree(d_Q);
 	cudaFree(d_qS);
+
+	if (d_regulations != NULL) {
+		cudaFree(d_regulations);
+		cudaFree(d_knudsenNumberTaupi);
+		cudaFree(d_knudsenNumberTauPi);
+		cudaFree(d_inverseReynoldsNumberPimunu);
+		cudaFree(d_inverseReynoldsNumber2Pimunu);
+		cudaFree(d_inverseReynoldsNumberTilde2Pimunu);
+		cudaFree(d_inverseReynoldsNumberPi);
+		cudaFree(d_inverseReynoldsNumber2Pi);
+		cudaFree(d_inverseReynoldsNumberTilde2Pi);
+		cudaFree(d_taupi);
+		cudaFree(d_dxux);
+		cudaFree(d_dyuy);
+		cudaFree(d_theta);
+	}
+	cudaFree(d_validityDomain);
 }
@@ -5,6 +5,7 @@
  *      Author: bazow
  */
 #include <math.h> // for math functions
+#include <string.h> // for memset
 
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
@@ -12,40 +13,84 @@
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 #include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
 
-#define MAX_ITERS 100000
 //const PRECISION ACC = 1e-2;
 
-__host__ __device__ 
-PRECISION energyDensityFromConservedVariables(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi) {
-#ifndef CONFORMAL_EOS
-	PRECISION e0 = ePrev;	// initial guess for energy density
-	for(int j = 0; j < MAX_ITERS; ++j) {
-		PRECISION p = equilibriumPressure(e0);
-		PRECISION cs2 = speedOfSoundSquared(e0);
-		PRECISION cst2 = p/e0;
+__device__ struct InferredVariablesStatistics d_inferredVariablesStatistics;
+struct InferredVariablesStatistics h_inferredVariablesStatistics;
 
-		PRECISION A = fmaf(M0,1-cst2,Pi);
-		PRECISION B = fmaf(M0,M0+Pi,-M);
-		PRECISION H = sqrtf(fabsf(A*A+4*cst2*B));
-		PRECISION D = (A-H)/(2*cst2);
+template <int EOS>
+__host__ __device__ static inline
+PRECISION solverPressure(PRECISION e) {
+	return EOS == PARAMETRIZED_EOS ? equilibriumPressureParametrized(e) : equilibriumPressure(e);
+}
 
-		PRECISION f = e0 + D;
-		PRECISION fp = 1 - ((cs2 - cst2)*(B + D*H - ((cs2 - cst2)*cst2*D*M0)/e0))/(cst2*e0*H);
+template <int EOS>
+__host__ __device__ static inline
+PRECISION solverSpeedOfSoundSquared(PRECISION e) {
+	return EOS == PARAMETRIZED_EOS ? speedOfSoundSquaredParametrized(e) : speedOfSoundSquared(e);
+}
+
+/*
+ * Newton's method, falling back to bisection whenever a step leaves the bracket of the root. The residual
+ * increases monotonically with e (its slope is 1 - cs^2 v^2 > 0), and p >= 0 brackets the root by
+ * M0 - M/(M0 + Pi) <= e <= M0.
+ */
+template <int EOS>
+__host__ __device__ 
+PRECISION solveEnergyDensity(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi, int * const status) {
+	PRECISION eMin = (M0 + Pi > 0) ? fmax(M0 - M/(M0 + Pi), (PRECISION) 0) : 0;
+	PRECISION eMax = fmax(M0, eMin);
+	// initial guess: the energy density of the previous step if it is bracketed, else the conformal solution
+	PRECISION e0 = ePrev;
+	if (!(e0 >= eMin && e0 <= eMax)) {
+		e0 = fabs(sqrt(fabs(4 * M0 * M0 - 3 * M)) - M0);
+		if (!(e0 >= eMin && e0 <= eMax)) e0 = (eMin + eMax)/2;
+	}
+	int bisected = 0;
+	for(int j = 1; j <= INFERRED_VARIABLES_MAX_ITERATIONS; ++j) {
+		PRECISION p = solverPressure<EOS>(e0);
+		PRECISION cs2 = solverSpeedOfSoundSquared<EOS>(e0);
+		PRECISION W = 1/(M0 + p + Pi);
+
+		PRECISION f = e0 - M0 + M * W;
+		PRECISION fp = 1 - cs2 * M * W * W;
+		if (f < 0) eMin = e0;
+		else eMax = e0;
 
 		PRECISION e = e0 - f/fp;
-		if(fabsf(e - e0) <=  0.001 * fabsf(e)) return e;
+		// also catches a vanishing slope
+		if (!(e >= eMin && e <= eMax)) {
+			e = (eMin + eMax)/2;
+			bisected = INFERRED_VARIABLES_BISECTED;
+		}
+		if(fabs(e - e0) <=  0.001 * fabs(e)) {
+			*status = j | bisected;
+			return e;
+		}
 		e0 = e;
 	}
-//	printf("Maximum number of iterations exceeded.\n");
-	printf("Maximum number of iterations exceeded.\tePrev=%.3f,\tM0=%.3f,\t M=%.3f,\t Pi=%.3f\n",ePrev,M0,M,Pi);
+	*status = INFERRED_VARIABLES_MAX_ITERATIONS | bisected | INFERRED_VARIABLES_NOT_CONVERGED;
 	return e0;
+}
+
+__host__ __device__ 
+PRECISION energyDensityFromConservedVariables(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi, int * const status) {
+#ifndef CONFORMAL_EOS
+	return solveEnergyDensity<EQUILIBRIUM_EOS>(ePrev, M0, M, Pi, status);
 #else
-	return fabsf(sqrtf(fabsf(4 * M0 * M0 - 3 * M)) - M0);
+	*status = 0;
+	return fabs(sqrt(fabs(4 * M0 * M0 - 3 * M)) - M0);
 #endif
 }
 
+template __host__ __device__ PRECISION solveEnergyDensity<EQUILIBRIUM_EOS>(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi,
+		int * const status);
+template __host__ __device__ PRECISION solveEnergyDensity<PARAMETRIZED_EOS>(PRECISION ePrev, PRECISION M0, PRECISION M, PRECISION Pi,
+		int * const status);
+
+template <int MODE>
 __host__ __device__ 
-void getInferredVariables(PRECISION t, const PRECISION * const __restrict__ q, PRECISION ePrev,
+int getInferredVariables(PRECISION t, const PRECISION * const __restrict__ q, PRECISION ePrev,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, 
 PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION * const __restrict__ uy, PRECISION * const __restrict__ un
 ) {
@@ -53,23 +98,12 @@ PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION
 	PRECISION ttx = q[1];
 	PRECISION tty = q[2];
 	PRECISION ttn = q[3];
-#ifdef PIMUNU
-	PRECISION pitt = q[4];
-	PRECISION pitx = q[5];
-	PRECISION pity = q[6];
-	PRECISION pitn = q[7];
-#else
-	PRECISION pitt = 0;
-	PRECISION pitx = 0;
-	PRECISION pity = 0;
-	PRECISION pitn = 0;
-#endif
+	PRECISION pitt = EVOLVE_PIMUNU(MODE) ? q[4] : 0;
+	PRECISION pitx = EVOLVE_PIMUNU(MODE) ? q[5] : 0;
+	PRECISION pity = EVOLVE_PIMUNU(MODE) ? q[6] : 0;
+	PRECISION pitn = EVOLVE_PIMUNU(MODE) ? q[7] : 0;
 	// \Pi
-#ifdef PI
-	PRECISION Pi = q[14];
-#else
-	PRECISION Pi = 0;
-#endif
+	PRECISION Pi = EVOLVE_PI(MODE) ? q[14] : 0;
 
 	PRECISION M0 = ttt - pitt;
 	PRECISION M1 = ttx - pitx;
@@ -81,10 +115,11 @@ PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION
 		Pi = M / M0 - M0;
 #endif
 /****************************************************************************/
+	int status;
 //	if (ePrev <= 0.1) {
 //		*e = M0 - M / M0;
 //	} else {
-		*e = energyDensityFromConservedVariables(ePrev, M0, M, Pi);
+		*e = energyDensityFromConservedVariables(ePrev, M0, M, Pi, &status);
 //	}
 	if (isnan(*e)) {
 		printf("M0=%.3f,\t M1=%.3f,\t M2=%.3f,\t M3=%.3f\n", M0, M1, M2, M3);
@@ -97,32 +132,26 @@ PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION
 
 	PRECISION P = *p + Pi;
 	PRECISION E = 1/(*e + P);
-	*ut = sqrtf(fabsf((M0 + P) * E));
+	*ut = sqrt(fabs((M0 + P) * E));
 	PRECISION E2 = E/(*ut);
 	*ux = M1 * E2;
 	*uy = M2 * E2;
 	*un = M3 * E2;
+	return status;
 }
 
-__global__ 
-void setInferredVariablesKernel(const CONSERVED_VARIABLES * const __restrict__ q, 
+template <int MODE>
+__host__ __device__ 
+int setInferredVariablesCell(const CONSERVED_VARIABLES * const __restrict__ q, 
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
-PRECISION t
+PRECISION t, int s
 ) {
-	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
-
-	if (threadID < d_nElements) {
-		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
-		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
-		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
-		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION q_s[NUMBER_CONSERVED_VARIABLES];
-		q_s[0] = q->ttt[s];
-		q_s[1] = q->ttx[s];
-		q_s[2] = q->tty[s];
-		q_s[3] = q->ttn[s];
-#ifdef PIMUNU
+	PRECISION q_s[NUMBER_CONSERVED_VARIABLES(MODE)];
+	q_s[0] = q->ttt[s];
+	q_s[1] = q->ttx[s];
+	q_s[2] = q->tty[s];
+	q_s[3] = q->ttn[s];
+	if (EVOLVE_PIMUNU(MODE)) {
 		q_s[4] = q->pitt[s];
 		q_s[5] = q->pitx[s];
 		q_s[6] = q->pity[s];
@@ -135,19 +164,103 @@ PRECISION t
 		q_s[12] = q->piyn[s];
 		q_s[13] = q->pinn[s];
 /****************************************************************************/
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		q_s[14] = q->Pi[s];
-#endif
-		PRECISION _e, _p, ut, ux, uy, un;
-		getInferredVariables(t, q_s, e[s], &_e, &_p, &ut, &ux, &uy, &un);
-		e[s] = _e;
-		p[s] = _p;
-		u->ut[s] = ut;
-		u->ux[s] = ux;
-		u->uy[s] = uy;
-		u->un[s] = un;
 	}
+	PRECISION _e, _p, ut, ux, uy, un;
+	int status = getInferredVariables<MODE>(t, q_s, e[s], &_e, &_p, &ut, &ux, &uy, &un);
+	e[s] = _e;
+	p[s] = _p;
+	u->ut[s] = ut;
+	u->ux[s] = ux;
+	u->uy[s] = uy;
+	u->un[s] = un;
+	return status;
+}
+
+template <int MODE>
+__global__ 
+void setInferredVariablesKernel(const CONSERVED_VARIABLES * const __restrict__ q, 
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
+PRECISION t, int kBegin, int kEnd
+) {
+	// solver statistics are summed in shared memory and added to the global counters once per block
+	__shared__ unsigned int cells, iterations, bisected, notConverged, maxIterations;
+	if (threadIdx.x == 0) {
+		cells = 0;
+		iterations = 0;
+		bisected = 0;
+		notConverged = 0;
+		maxIterations = 0;
+	}
+	__syncthreads();
+
+	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+
+	if (threadID < d_nx * d_ny * (kEnd - kBegin)) {
+		unsigned int k = threadID / (d_nx * d_ny) + kBegin;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		int status = setInferredVariablesCell<MODE>(q, e, p, u, t, s);
+		unsigned int n = INFERRED_VARIABLES_ITERATIONS(status);
+		atomicAdd(&cells, 1u);
+		atomicAdd(&iterations, n);
+		atomicMax(&maxIterations, n);
+		if (status & INFERRED_VARIABLES_BISECTED) atomicAdd(&bisected, 1u);
+		if (status & INFERRED_VARIABLES_NOT_CONVERGED) atomicAdd(&notConverged, 1u);
+	}
+	__syncthreads();
+
+	if (threadIdx.x == 0) {
+		struct InferredVariablesStatistics * const stats = &d_inferredVariablesStatistics;
+		atomicAdd(&stats->cells, (unsigned long long) cells);
+		atomicAdd(&stats->iterations, (unsigned long long) iterations);
+		atomicAdd(&stats->bisected, (unsigned long long) bisected);
+		atomicAdd(&stats->notConverged, (unsigned long long) notConverged);
+		atomicMax(&stats->maxIterations, maxIterations);
+	}
+}
+
+template <int MODE>
+void setInferredVariablesHost(const CONSERVED_VARIABLES * const __restrict__ q, 
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, 
+PRECISION t, int kBegin, int kEnd
+) {
+	unsigned long long cells = 0, iterations = 0, bisected = 0, notConverged = 0;
+	unsigned int maxIterations = 0;
+#pragma omp parallel for collapse(2) reduction(+:cells,iterations,bisected,notConverged) reduction(max:maxIterations)
+	for (int k = kBegin; k < kEnd; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				int status = setInferredVariablesCell<MODE>(q, e, p, u, t, s);
+				unsigned int n = INFERRED_VARIABLES_ITERATIONS(status);
+				cells++;
+				iterations += n;
+				if (n > maxIterations) maxIterations = n;
+				if (status & INFERRED_VARIABLES_BISECTED) bisected++;
+				if (status & INFERRED_VARIABLES_NOT_CONVERGED) notConverged++;
+			}
+		}
+	}
+	struct InferredVariablesStatistics * const stats = &h_inferredVariablesStatistics;
+	stats->cells += cells;
+	stats->iterations += iterations;
+	stats->bisected += bisected;
+	stats->notConverged += notConverged;
+	if (maxIterations > stats->maxIterations) stats->maxIterations = maxIterations;
+}
+
+void resetInferredVariablesStatistics(bool host) {
+	memset(&h_inferredVariablesStatistics, 0, sizeof(h_inferredVariablesStatistics));
+	if (!host) cudaMemcpyToSymbol(d_inferredVariablesStatistics, &h_inferredVariablesStatistics, sizeof(h_inferredVariablesStatistics));
+}
+
+void getInferredVariablesStatistics(struct InferredVariablesStatistics * const stats, bool host) {
+	if (host) *stats = h_inferredVariablesStatistics;
+	else cudaMemcpyFromSymbol(stats, d_inferredVariablesStatistics, sizeof(*stats));
 }
 
 //===================================================================
@@ -202,3 +315,13 @@ __host__ __device__
 PRECISION Tnn(PRECISION e, PRECISION p, PRECISION un, PRECISION pinn, PRECISION t) {
 	return (e+p)*un*un+p/t/t+pinn;
 }
+
+#define INSTANTIATE_INFERRED_VARIABLES(MODE) \
+template __host__ __device__ int getInferredVariables<MODE>(PRECISION t, const PRECISION * const __restrict__ q, PRECISION ePrev, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		PRECISION * const __restrict__ ut, PRECISION * const __restrict__ ux, PRECISION * const __restrict__ uy, PRECISION * const __restrict__ un); \
+template __global__ void setInferredVariablesKernel<MODE>(const CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, PRECISION t, int kBegin, int kEnd); \
+template void setInferredVariablesHost<MODE>(const CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, FLUID_VELOCITY * const __restrict__ u, PRECISION t, int kBegin, int kEnd);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_INFERRED_VARIABLES)
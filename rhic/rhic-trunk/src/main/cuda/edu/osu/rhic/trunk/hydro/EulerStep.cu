@@ -15,122 +15,16 @@
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 #include "edu/osu/rhic/trunk/hydro/RegulateDissipativeCurrents.cuh"
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
 
-/**************************************************************************************************************************************************\
-__device__ 
-void setNeighborCells(const PRECISION * const __restrict__ data,
-PRECISION * const __restrict__ I, PRECISION * const __restrict__ J, PRECISION * const __restrict__ K, PRECISION * const __restrict__ Q,
-int s, unsigned int n, int ptr, int simm, int sim, int sip, int sipp, int sjmm, int sjm, int sjp, int sjpp, int skmm, int skm, int skp, int skpp) {
-	PRECISION data_ns = data[s];
-	// I
-	*(I+ptr) = *(data+simm);
-	*(I+ptr+1) = *(data+sim);
-	*(I+ptr+2) = data_ns;
-	*(I+ptr+3) = *(data+sip);
-	*(I+ptr+4) = *(data+sipp);
-	// J
-	*(J+ptr) = *(data+sjmm);
-	*(J+ptr+1) = *(data+sjm);
-	*(J+ptr+2) = data_ns;
-	*(J+ptr+3) = *(data+sjp);
-	*(J+ptr+4) = *(data+sjpp);
-	// K
-	*(K+ptr) = *(data+skmm);
-	*(K+ptr+1) = *(data+skm);
-	*(K+ptr+2) = data_ns;
-	*(K+ptr+3) = *(data+skp);
-	*(K+ptr+4) = *(data+skpp);
-	// Q
-	*(Q + n) = data_ns;
-}
-
-__global__
-void eulerStepKernel(PRECISION t,
-const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
-const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
-) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
-
-	PRECISION I[5 * NUMBER_CONSERVED_VARIABLES], J[5* NUMBER_CONSERVED_VARIABLES], K[5 * NUMBER_CONSERVED_VARIABLES];
-	PRECISION hpx[NUMBER_CONSERVED_VARIABLES], hmx[NUMBER_CONSERVED_VARIABLES],
-		hpy[NUMBER_CONSERVED_VARIABLES], hmy[NUMBER_CONSERVED_VARIABLES],
-		hpz[NUMBER_CONSERVED_VARIABLES],	hmz[NUMBER_CONSERVED_VARIABLES];
-	PRECISION Q[NUMBER_CONSERVED_VARIABLES], S[NUMBER_CONSERVED_VARIABLES];
-
-	int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-	// calculate neighbor cell indices;
-	int sim = s-1;
-	int simm = sim-1;
-	int sip = s+1;
-	int sipp = sip+1;
-
-	int sjm = s-d_ncx;
-	int sjmm = sjm-d_ncx;
-	int sjp = s+d_ncx;
-	int sjpp = sjp+d_ncx;
-
-	int stride = d_ncx * d_ncy;
-	int skm = s-stride;
-	int skmm = skm-stride;
-	int skp = s+stride;
-	int skpp = skp+stride;
-
-	int ptr = 0;
-	setNeighborCells(currrentVars->ttt,I,J,K,Q,s,0,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->ttx,I,J,K,Q,s,1,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->tty,I,J,K,Q,s,2,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->ttn,I,J,K,Q,s,3,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pitt,I,J,K,Q,s,4,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pitx,I,J,K,Q,s,5,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pity,I,J,K,Q,s,6,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pitn,I,J,K,Q,s,7,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pixx,I,J,K,Q,s,8,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pixy,I,J,K,Q,s,9,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pixn,I,J,K,Q,s,10,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->piyy,I,J,K,Q,s,11,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->piyn,I,J,K,Q,s,12,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-	setNeighborCells(currrentVars->pinn,I,J,K,Q,s,13,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp);
-
-	flux(I, hpx, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, e[s]);
-	flux(I, hmx, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, e[s]);
-	flux(J, hpy, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, e[s]);
-	flux(J, hmy, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, e[s]);
-	flux(K, hpz, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, e[s]);
-	flux(K, hmz, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, e[s]);
-
-	loadSourceTerms(I, J, K, Q, S, u, up->ut[s], up->ux[s], up->uy[s], up->un[s], t, e[s], p, s);
-
-	PRECISION result[NUMBER_CONSERVED_VARIABLES];
-	for (int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-		*(result+n) = *(Q+n) + d_dt * ( *(S+n) - ( *(hpx+n) - *(hmx+n) + *(hpy+n) - *(hmy+n) ) / d_dx - ( *(hpz+n) - *(hmz+n) )/d_dz );
-	}
-
-	updatedVars->ttt[s] = result[0];
-	updatedVars->ttx[s] = result[1];
-	updatedVars->tty[s] = result[2];
-	updatedVars->ttn[s] = result[3];
-	updatedVars->pitt[s] = result[4];
-	updatedVars->pitx[s] = result[5];
-	updatedVars->pity[s] = result[6];
-	updatedVars->pitn[s] = result[7];
-	updatedVars->pixx[s] = result[8];
-	updatedVars->pixy[s] = result[9];
-	updatedVars->pixn[s] = result[10];
-	updatedVars->piyy[s] = result[11];
-	updatedVars->piyn[s] = result[12];
-	updatedVars->pinn[s] = result[13];
-}
 /**************************************************************************************************************************************************/
-
-/**************************************************************************************************************************************************\
-__device__ 
-void setNeighborCells2(const PRECISION * const __restrict__ in, PRECISION * const __restrict__ out, PRECISION data_ns,
-int ptr, int smm, int sm, int sp, int spp
+// Per-cell updates shared by the device kernels and the host backend
+/**************************************************************************************************************************************************/
+__host__ __device__
+void setNeighborCellsJK2(const PRECISION * const __restrict__ in, PRECISION * const __restrict__ out,
+int s, int ptr, int smm, int sm, int sp, int spp
 ) {
+	PRECISION data_ns = in[s];
 	*(out + ptr		) = in[smm];
 	*(out + ptr + 1) = in[sm];
 	*(out + ptr + 2) = data_ns;
@@ -138,150 +32,21 @@ int ptr, int smm, int sm, int sp, int spp
 	*(out + ptr + 4) = in[spp];
 }
 
-__device__
-void setNeighborCells3(const PRECISION * const __restrict__ in, PRECISION * const __restrict__ out, int ptr, int smm, int sm, int sp, int spp
-) {
-	*(out + ptr		) = in[smm];
-	*(out + ptr + 1) = in[sm];
-	*(out + ptr + 3) = in[sp];
-	*(out + ptr + 4) = in[spp];
-}
-
-__global__
-void eulerStepKernel_1D(PRECISION t,
-const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
-const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
-) {
-	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
-	if (threadID < d_nElements) {
-		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
-		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
-		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
-		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION I[5 * NUMBER_CONSERVED_VARIABLES], J[5* NUMBER_CONSERVED_VARIABLES], K[5 * NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES], Q[NUMBER_CONSERVED_VARIABLES];
-
-		// calculate neighbor cell indices;
-		int sim = s-1;
-		int simm = sim-1;
-		int sip = s+1;
-		int sipp = sip+1;
-
-		int sjm = s-d_ncx;
-		int sjmm = sjm-d_ncx;
-		int sjp = s+d_ncx;
-		int sjpp = sjp+d_ncx;
-
-		int stride = d_ncx * d_ncy;
-		int skm = s-stride;
-		int skmm = skm-stride;
-		int skp = s+stride;
-		int skpp = skp+stride;
-
-		int ptr = 0;
-		setNeighborCells(currrentVars->ttt,I,J,K,Q,s,0,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->ttx,I,J,K,Q,s,1,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->tty,I,J,K,Q,s,2,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->ttn,I,J,K,Q,s,3,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pitt,I,J,K,Q,s,4,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pitx,I,J,K,Q,s,5,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pity,I,J,K,Q,s,6,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pitn,I,J,K,Q,s,7,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pixx,I,J,K,Q,s,8,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pixy,I,J,K,Q,s,9,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pixn,I,J,K,Q,s,10,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->piyy,I,J,K,Q,s,11,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->piyn,I,J,K,Q,s,12,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->pinn,I,J,K,Q,s,13,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCells(currrentVars->Pi,I,J,K,Q,s,14,ptr,simm,sim,sip,sipp,sjmm,sjm,sjp,sjpp,skmm,skm,skp,skpp);
-
-		//=======================================================================================================================
-		PRECISION es = e[s];
-		loadSourceTerms(I, J, K, Q, H, u, up->ut[s], up->ux[s], up->uy[s], up->un[s], t, es, p, s);
-
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = *(Q+n) + d_dt * ( *(H+n) );
-		}
-		// X derivatives
-		PRECISION facX = d_dt/d_dx;
-		flux(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) -= *(H+n)*facX;
-		}
-		flux(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n)*facX;
-		}
-		// Y derivatives
-		flux(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) -= *(H+n)*facX;
-		}
-		flux(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n)*facX;
-		}
-		// Z derivatives
-		PRECISION facZ = d_dt/d_dz;
-		flux(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) -= *(H+n)*facZ;
-		}
-		flux(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, es);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n)*facZ;
-		}
-
-		//=======================================================================================================================
-
-		updatedVars->ttt[s] = result[0];
-		updatedVars->ttx[s] = result[1];
-		updatedVars->tty[s] = result[2];
-		updatedVars->ttn[s] = result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] = result[4];
-		updatedVars->pitx[s] = result[5];
-		updatedVars->pity[s] = result[6];
-		updatedVars->pitn[s] = result[7];
-		updatedVars->pixx[s] = result[8];
-		updatedVars->pixy[s] = result[9];
-		updatedVars->pixn[s] = result[10];
-		updatedVars->piyy[s] = result[11];
-		updatedVars->piyn[s] = result[12];
-		updatedVars->pinn[s] = result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] = result[14];
-#endif
-	}
-}
-/**************************************************************************************************************************************************/
-
-/**************************************************************************************************************************************************/
-__global__
-void eulerStepKernelSource(PRECISION t,
+template <int MODE, int DIMS>
+__host__ __device__
+void eulerStepSourceCell(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
 const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
-const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up, int s
 ) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
-
-	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		PRECISION Q[NUMBER_CONSERVED_VARIABLES];
-		PRECISION S[NUMBER_CONSERVED_VARIABLES];
-
-		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		Q[0] = currrentVars->ttt[s];
-		Q[1] = currrentVars->ttx[s];
-		Q[2] = currrentVars->tty[s];
-		Q[3] = currrentVars->ttn[s];
-#ifdef PIMUNU
+	PRECISION Q[NUMBER_CONSERVED_VARIABLES(MODE)];
+	PRECISION S[NUMBER_CONSERVED_VARIABLES(MODE)];
+
+	Q[0] = currrentVars->ttt[s];
+	Q[1] = currrentVars->ttx[s];
+	Q[2] = currrentVars->tty[s];
+	Q[3] = currrentVars->ttn[s];
+	if (EVOLVE_PIMUNU(MODE)) {
 		Q[4] = currrentVars->pitt[s];
 		Q[5] = currrentVars->pitx[s];
 		Q[6] = currrentVars->pity[s];
@@ -292,23 +57,23 @@ const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __rest
 		Q[11] = currrentVars->piyy[s];
 		Q[12] = currrentVars->piyn[s];
 		Q[13] = currrentVars->pinn[s];
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		Q[14] = currrentVars->Pi[s];
-#endif
+	}
 
-		loadSourceTerms2(Q, S, u, up->ut[s], up->ux[s], up->uy[s], up->un[s], t, e[s], p, s);
+	loadSourceTerms2<MODE, DIMS>(Q, S, u, up->ut[s], up->ux[s], up->uy[s], up->un[s], t, e[s], p, s);
 
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = *(Q+n) + d_dt * ( *(S+n) );
-		}
+	PRECISION result[NUMBER_CONSERVED_VARIABLES(MODE)];
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) = *(Q+n) + CONST_PARAM(dt) * ( *(S+n) );
+	}
 
-		updatedVars->ttt[s] = result[0];
-		updatedVars->ttx[s] = result[1];
-		updatedVars->tty[s] = result[2];
-		updatedVars->ttn[s] = result[3];
-#ifdef PIMUNU
+	updatedVars->ttt[s] = result[0];
+	updatedVars->ttx[s] = result[1];
+	updatedVars->tty[s] = result[2];
+	updatedVars->ttn[s] = result[3];
+	if (EVOLVE_PIMUNU(MODE)) {
 		updatedVars->pitt[s] = result[4];
 		updatedVars->pitx[s] = result[5];
 		updatedVars->pity[s] = result[6];
@@ -319,54 +84,33 @@ const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __rest
 		updatedVars->piyy[s] = result[11];
 		updatedVars->piyn[s] = result[12];
 		updatedVars->pinn[s] = result[13];
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		updatedVars->Pi[s] = result[14];
-#endif
 	}
 }
-/**************************************************************************************************************************************************/
 
-/**************************************************************************************************************************************************/
-__device__
-void setNeighborCellsJK2(const PRECISION * const __restrict__ in, PRECISION * const __restrict__ out,
-int s, int ptr, int smm, int sm, int sp, int spp
-) {
-	PRECISION data_ns = in[s];
-	*(out + ptr		) = in[smm];
-	*(out + ptr + 1) = in[sm];
-	*(out + ptr + 2) = data_ns;
-	*(out + ptr + 3) = in[sp];
-	*(out + ptr + 4) = in[spp];
-}
-
-__global__
-void eulerStepKernelX(PRECISION t,
+template <int MODE>
+__host__ __device__
+void eulerStepXCell(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e, int s
 ) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
-
-	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		PRECISION I[5 * NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
-
-		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+	PRECISION I[5 * NUMBER_CONSERVED_VARIABLES(MODE)];
+	PRECISION H[NUMBER_CONSERVED_VARIABLES(MODE)];
 
-		// calculate neighbor cell indices;
-		int sim = s-1;
-		int simm = sim-1;
-		int sip = s+1;
-		int sipp = sip+1;
+	// calculate neighbor cell indices;
+	int sim = s-1;
+	int simm = sim-1;
+	int sip = s+1;
+	int sipp = sip+1;
 
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-#ifdef PIMUNU
+	int ptr=0;
+	setNeighborCellsJK2(currrentVars->ttt,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->tty,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
+	if (EVOLVE_PIMUNU(MODE)) {
 		setNeighborCellsJK2(currrentVars->pitt,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pitx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pity,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
@@ -377,41 +121,41 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		setNeighborCellsJK2(currrentVars->piyy,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->piyn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pinn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		setNeighborCellsJK2(currrentVars->Pi,I,s,ptr,simm,sim,sip,sipp);
-#endif
+	}
 
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dx;
-		}
-#ifndef IDEAL
-		loadSourceTermsX(I, H, u, s);
+	PRECISION result[NUMBER_CONSERVED_VARIABLES(MODE)];
+	flux<MODE>(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) = - *(H+n);
+	}
+	flux<MODE>(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) += *(H+n);
+		*(result+n) /= CONST_PARAM(dx);
+	}
+	if (EVOLVE_PIMUNU(MODE)) {
+		loadSourceTermsX<MODE>(I, H, u, s);
 		for (unsigned int n = 0; n < 4; ++n) {
 			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
-#else
+	} else {
 		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
-		}
-#endif	
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
+	}
+	for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) *= CONST_PARAM(dt);
+	}
 
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
+	updatedVars->ttt[s] += result[0];
+	updatedVars->ttx[s] += result[1];
+	updatedVars->tty[s] += result[2];
+	updatedVars->ttn[s] += result[3];
+	if (EVOLVE_PIMUNU(MODE)) {
 		updatedVars->pitt[s] += result[4];
 		updatedVars->pitx[s] += result[5];
 		updatedVars->pity[s] += result[6];
@@ -422,40 +166,33 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		updatedVars->piyy[s] += result[11];
 		updatedVars->piyn[s] += result[12];
 		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		updatedVars->Pi[s] += result[14];
-#endif
 	}
 }
 
-__global__
-void eulerStepKernelY(PRECISION t,
+template <int MODE>
+__host__ __device__
+void eulerStepYCell(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e, int s
 ) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
-
-	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		PRECISION J[5* NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
+	PRECISION J[5 * NUMBER_CONSERVED_VARIABLES(MODE)];
+	PRECISION H[NUMBER_CONSERVED_VARIABLES(MODE)];
 
-		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		// calculate neighbor cell indices;
-		int sjm = s-d_ncx;
-		int sjmm = sjm-d_ncx;
-		int sjp = s+d_ncx;
-		int sjpp = sjp+d_ncx;
-
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-#ifdef PIMUNU
+	// calculate neighbor cell indices;
+	int sjm = s-CONST_PARAM(ncx);
+	int sjmm = sjm-CONST_PARAM(ncx);
+	int sjp = s+CONST_PARAM(ncx);
+	int sjpp = sjp+CONST_PARAM(ncx);
+
+	int ptr=0;
+	setNeighborCellsJK2(currrentVars->ttt,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->tty,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
+	if (EVOLVE_PIMUNU(MODE)) {
 		setNeighborCellsJK2(currrentVars->pitt,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pitx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pity,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
@@ -466,41 +203,41 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		setNeighborCellsJK2(currrentVars->piyy,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->piyn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pinn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		setNeighborCellsJK2(currrentVars->Pi,J,s,ptr,sjmm,sjm,sjp,sjpp);
-#endif
+	}
 
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(J, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux(J, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dy;
-		}
-#ifndef IDEAL
-		loadSourceTermsY(J, H, u, s);
+	PRECISION result[NUMBER_CONSERVED_VARIABLES(MODE)];
+	flux<MODE>(J, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) = - *(H+n);
+	}
+	flux<MODE>(J, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) += *(H+n);
+		*(result+n) /= CONST_PARAM(dy);
+	}
+	if (EVOLVE_PIMUNU(MODE)) {
+		loadSourceTermsY<MODE>(J, H, u, s);
 		for (unsigned int n = 0; n < 4; ++n) {
 			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
-#else
+	} else {
 		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
-		}
-#endif
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
+	}
+	for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) *= CONST_PARAM(dt);
+	}
 
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
+	updatedVars->ttt[s] += result[0];
+	updatedVars->ttx[s] += result[1];
+	updatedVars->tty[s] += result[2];
+	updatedVars->ttn[s] += result[3];
+	if (EVOLVE_PIMUNU(MODE)) {
 		updatedVars->pitt[s] += result[4];
 		updatedVars->pitx[s] += result[5];
 		updatedVars->pity[s] += result[6];
@@ -511,42 +248,34 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		updatedVars->piyy[s] += result[11];
 		updatedVars->piyn[s] += result[12];
 		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		updatedVars->Pi[s] += result[14];
-#endif
 	}
 }
 
-__global__
-void eulerStepKernelZ(PRECISION t,
+template <int MODE>
+__host__ __device__
+void eulerStepZCell(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e, int s
 ) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
-
-	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-//printf("(i,j,k)=(%d,%d,%d)\n",i,j,k);
-		PRECISION K[5 * NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
-
-		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+	PRECISION K[5 * NUMBER_CONSERVED_VARIABLES(MODE)];
+	PRECISION H[NUMBER_CONSERVED_VARIABLES(MODE)];
 
-		// calculate neighbor cell indices;
-		int stride = d_ncx * d_ncy;
-		int skm = s-stride;
-		int skmm = skm-stride;
-		int skp = s+stride;
-		int skpp = skp+stride;
+	// calculate neighbor cell indices;
+	int stride = CONST_PARAM(ncx) * CONST_PARAM(ncy);
+	int skm = s-stride;
+	int skmm = skm-stride;
+	int skp = s+stride;
+	int skpp = skp+stride;
 
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-#ifdef PIMUNU
+	int ptr=0;
+	setNeighborCellsJK2(currrentVars->ttt,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->tty,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
+	setNeighborCellsJK2(currrentVars->ttn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
+	if (EVOLVE_PIMUNU(MODE)) {
 		setNeighborCellsJK2(currrentVars->pitt,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pitx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pity,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
@@ -557,41 +286,41 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		setNeighborCellsJK2(currrentVars->piyy,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->piyn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
 		setNeighborCellsJK2(currrentVars->pinn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		setNeighborCellsJK2(currrentVars->Pi,K,s,ptr,skmm,skm,skp,skpp);
-#endif
+	}
 
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(K, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = -*(H+n);
-		}
-		flux(K, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dz;
-		}
-#ifndef IDEAL
-		loadSourceTermsZ(K, H, u, s, t);
+	PRECISION result[NUMBER_CONSERVED_VARIABLES(MODE)];
+	flux<MODE>(K, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) = - *(H+n);
+	}
+	flux<MODE>(K, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, e[s]);
+	for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) += *(H+n);
+		*(result+n) /= CONST_PARAM(dz);
+	}
+	if (EVOLVE_PIMUNU(MODE)) {
+		loadSourceTermsZ<MODE>(K, H, u, s, t);
 		for (unsigned int n = 0; n < 4; ++n) {
 			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
-#else
+	} else {
 		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
-		}
-#endif
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
+			*(result+n) *= CONST_PARAM(dt);
 		}
+	}
+	for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES(MODE); ++n) {
+		*(result+n) *= CONST_PARAM(dt);
+	}
 
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
+	updatedVars->ttt[s] += result[0];
+	updatedVars->ttx[s] += result[1];
+	updatedVars->tty[s] += result[2];
+	updatedVars->ttn[s] += result[3];
+	if (EVOLVE_PIMUNU(MODE)) {
 		updatedVars->pitt[s] += result[4];
 		updatedVars->pitx[s] += result[5];
 		updatedVars->pity[s] += result[6];
@@ -602,144 +331,49 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		updatedVars->piyy[s] += result[11];
 		updatedVars->piyn[s] += result[12];
 		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		updatedVars->Pi[s] += result[14];
-#endif
 	}
 }
 
-/**************************************************************************************************************************************************\
-
-/**************************************************************************************************************************************************\
-__device__
-void setSharedData(const CONSERVED_VARIABLES * const __restrict__ in, PRECISION * const __restrict__ out,
-int i, int j, int k, int nx, int ny, int stride, int s) {
-	int ptr = i + nx*(j + ny*k);
-	*(out + ptr) = in->ttt[s]; 	ptr+=stride;
-	*(out + ptr) = in->ttx[s]; 	ptr+=stride;
-	*(out + ptr) = in->tty[s]; 	ptr+=stride;
-	*(out + ptr) = in->ttn[s]; 	ptr+=stride;
-	*(out + ptr) = in->pitt[s]; 	ptr+=stride;
-	*(out + ptr) = in->pitx[s]; 	ptr+=stride;
-	*(out + ptr) = in->pity[s]; 	ptr+=stride;
-	*(out + ptr) = in->pitn[s]; 	ptr+=stride;
-	*(out + ptr) = in->pixx[s]; 	ptr+=stride;
-	*(out + ptr) = in->pixy[s]; 	ptr+=stride;
-	*(out + ptr) = in->pixn[s]; 	ptr+=stride;
-	*(out + ptr) = in->piyy[s]; 	ptr+=stride;
-	*(out + ptr) = in->piyn[s]; 	ptr+=stride;
-	*(out + ptr) = in->pinn[s]; 	ptr+=stride;
-#ifdef PI
-	*(out + ptr) = in->Pi[s];
-#endif
+// Source term and the flux differences along the directions of DIMS for one cell in a single pass; the X, Y
+// and Z updates only read currrentVars, so applying them one after another gives the split result
+template <int MODE, int DIMS>
+__host__ __device__
+void eulerStepFusedCell(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up, int s
+) {
+	eulerStepSourceCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+	eulerStepXCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	if (EVOLVE_Y(DIMS)) eulerStepYCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	if (EVOLVE_Z(DIMS)) eulerStepZCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 }
+/**************************************************************************************************************************************************/
 
-
+/**************************************************************************************************************************************************/
+template <int MODE, int DIMS>
 __global__
-void eulerStepKernelSharedX(PRECISION t,
+void eulerStepKernelSource(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
-const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
 ) {
 	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
 	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
 	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
 
 	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		__shared__ PRECISION s_data[NUMBER_CONSERVED_VARIABLES*(BSX_X+4)*BSX_Y*BSX_Z];
-
-		int tx = threadIdx.x + N_GHOST_CELLS_M;
-		int ty = threadIdx.y;
-		int tz = threadIdx.z;
 		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		int stride = (BSX_X+4)*BSX_Y*BSX_Z;
-		int ts = tx + (BSX_X+4) * (ty + BSX_Y * tz);
-
-		setSharedData(currrentVars, s_data, tx, ty, tz, BSX_X+4, BSX_Y, stride, s);
-
-		if(threadIdx.x==0) {
-			int sim = s-1;
-			int simm = sim-1;
-			setSharedData(currrentVars, s_data, tx-1, ty, tz, BSX_X+4, BSX_Y, stride, sim);
-			setSharedData(currrentVars, s_data, tx-2, ty, tz, BSX_X+4, BSX_Y, stride, simm);
-		}
-		if(threadIdx.x==blockDim.x-1) {
-			int sip = s+1;
-			int sipp = sip+1;
-			setSharedData(currrentVars, s_data, tx+1, ty, tz, BSX_X+4, BSX_Y, stride, sip);
-			setSharedData(currrentVars, s_data, tx+2, ty, tz, BSX_X+4, BSX_Y, stride, sipp);
-		}
-
-		__syncthreads();
-		//==========================================================================================
-
-		PRECISION e_s = e[s];
-		PRECISION result[NUMBER_CONSERVED_VARIABLES], H[NUMBER_CONSERVED_VARIABLES];
-		flux2(s_data, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux2(s_data, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dx;
-		}
-		// source
-		PRECISION facX = 1/d_dx/2;
-		int ptr = ts+4*stride;
-		PRECISION dxpitt = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpitx = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpity = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpitn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpixx = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpixy = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=stride;
-		PRECISION dxpixn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;	ptr+=4*stride;
-
-		PRECISION ut = u->ut[s];
-		PRECISION ux = u->ux[s];
-		PRECISION vx = fdividef(ux, ut);
-#ifndef PI
-		result[0] += dxpitt*vx - dxpitx;
-		result[1] += dxpitx*vx - dxpixx;
-#else
-		PRECISION dxPi = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facX;
-		result[0] += dxpitt*vx - dxpitx - vx*dxPi;
-		result[1] += dxpitx*vx - dxpixx - dxPi;
-#endif
-		result[2] += dxpity*vx - dxpixy;
-		result[3] += dxpitn*vx - dxpixn;
-
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
-		}
-		//==========================================================================================
-
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
+		eulerStepSourceCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
 	}
 }
 
+template <int MODE>
 __global__
-//__launch_bounds__(1024, 3)
-void eulerStepKernelSharedY(PRECISION t,
+void eulerStepKernelX(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
 const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
 ) {
@@ -748,99 +382,14 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
 
 	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		__shared__ PRECISION s_data[NUMBER_CONSERVED_VARIABLES*(BSY_Y+4)*BSY_X*BSY_Z];
-
-		int tx = threadIdx.x;
-		int ty = threadIdx.y + N_GHOST_CELLS_M;
-		int tz = threadIdx.z;
 		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		int stride = (BSY_Y+4)*BSY_X*BSY_Z;
-		int ts = ty + (BSY_Y+4) * (tx + BSY_X * tz);
-
-		setSharedData(currrentVars, s_data, ty, tx, tz, BSY_Y+4, BSY_X, stride, s);
-
-		if(threadIdx.y==0) {
-			int sjm = s-d_ncx;
-			int sjmm = sjm-d_ncx;
-			setSharedData(currrentVars, s_data, ty-1, tx, tz, BSY_Y+4, BSY_X, stride, sjm);
-			setSharedData(currrentVars, s_data, ty-2, tx, tz, BSY_Y+4, BSY_X, stride, sjmm);
-		}
-		if(threadIdx.y==blockDim.y-1) {
-			int sjp = s+d_ncx;
-			int sjpp = sjp+d_ncx;
-			setSharedData(currrentVars, s_data, ty+1, tx, tz, BSY_Y+4, BSY_X, stride, sjp);
-			setSharedData(currrentVars, s_data, ty+2, tx, tz, BSY_Y+4, BSY_X, stride, sjpp);
-		}
-
-		__syncthreads();
-		//==========================================================================================
-
-		PRECISION e_s = e[s];
-		PRECISION result[NUMBER_CONSERVED_VARIABLES], H[NUMBER_CONSERVED_VARIABLES];
-		flux2(s_data, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux2(s_data, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dy;
-		}
-		// source
-		PRECISION facY = 1/d_dy/2;
-		int ptr = ts+4*stride;
-		PRECISION dypitt = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride;
-		PRECISION dypitx = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride;
-		PRECISION dypity = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride;
-		PRECISION dypitn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride; ptr+=stride;
-		PRECISION dypixy = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride; ptr+=stride;
-		PRECISION dypiyy = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride;
-		PRECISION dypiyn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;	ptr+=stride; ptr+=stride;
-
-		PRECISION ut = u->ut[s];
-		PRECISION uy = u->uy[s];
-		PRECISION vy =fdividef(uy, ut);
-#ifndef PI
-		result[0] += dypitt*vy - dypity;
-		result[2] += dypity*vy - dypiyy;
-#else
-		PRECISION dyPi = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facY;
-		result[0] += dypitt*vy - dypity - vy*dyPi;
-		result[2] += dypity*vy - dypiyy - dyPi;
-#endif
-		result[1] += dypitx*vy - dypixy;
-		result[3] += dypitn*vy - dypiyn;
-
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
-		}
-		//==========================================================================================
-
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
+		eulerStepXCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 	}
 }
 
+template <int MODE>
 __global__
-void eulerStepKernelSharedZ(PRECISION t,
+void eulerStepKernelY(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
 const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
 ) {
@@ -849,101 +398,48 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
 
 	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
-		printf("(i,j,k)=(%d,%d,%d)\n",i,j,k);
-		__shared__ PRECISION s_data[NUMBER_CONSERVED_VARIABLES*(BSZ_Z+4)*BSZ_X*BSZ_Y];
-
-		int tx = threadIdx.x;
-		int ty = threadIdx.y;
-		int tz = threadIdx.z + N_GHOST_CELLS_M;
 		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		eulerStepYCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	}
+}
 
-		int stride = (BSZ_Z+4)*BSZ_X*BSZ_Y;
-		int ts = tz + (BSZ_Z+4) * (ty + BSZ_Y * tx);
-
-		setSharedData(currrentVars, s_data, tz, ty, tx, BSZ_Z+4, BSZ_Y, stride, s);
-
-		if(threadIdx.z==0) {
-			int skm = s-d_ncx*d_ncy;
-			int skmm = skm-d_ncx*d_ncy;
-			setSharedData(currrentVars, s_data, tz-1, ty, tx, BSZ_Z+4, BSZ_Y, stride, skm);
-			setSharedData(currrentVars, s_data, tz-2, ty, tx, BSZ_Z+4, BSZ_Y, stride, skmm);
-		}
-		if(threadIdx.z==blockDim.z-1) {
-			int skp = s+d_ncx*d_ncy;
-			int skpp = skp+d_ncx*d_ncy;
-			setSharedData(currrentVars, s_data, tz+1, ty, tx, BSZ_Z+4, BSZ_Y, stride, skp);
-			setSharedData(currrentVars, s_data, tz+2, ty, tx, BSZ_Z+4, BSZ_Y, stride, skpp);
-		}
-
-		__syncthreads();
-		//==========================================================================================
-
-		PRECISION e_s = e[s];
-		PRECISION result[NUMBER_CONSERVED_VARIABLES], H[NUMBER_CONSERVED_VARIABLES];
-		flux2(s_data, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux2(s_data, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, ts, stride, e_s);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dz;
-		}
-		// source
-		PRECISION facZ = 1/d_dz/2;
-		int ptr = ts+4*stride;
-		PRECISION dnpitt = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride;
-		PRECISION dnpitx = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride;
-		PRECISION dnpity = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride;
-		PRECISION dnpitn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride; ptr+=stride;  ptr+=stride;
-		PRECISION dnpixn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride; ptr+=stride;
-		PRECISION dnpiyn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride;
-		PRECISION dnpinn = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;	ptr+=stride;
+template <int MODE>
+__global__
+void eulerStepKernelZ(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+) {
+	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
+	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
+	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
 
-		PRECISION ut = u->ut[s];
-		PRECISION un = u->un[s];
-		PRECISION vn = fdividef(un, ut);
-#ifndef PI
-		result[0] += dnpitt*vn - dnpitn;
-		result[3] += dnpitn*vn - dnpinn;
-#else
-		PRECISION dnPi = (*(s_data + ptr + 1) - *(s_data + ptr - 1)) *facZ;
-		result[0] += dnpitt*vn - dnpitn - vn*dnPi;
-		result[3] += dnpitn*vn - dnpinn - dnPi/powf(t,2.0f);
-#endif
-		result[1] += dnpitx*vn - dnpixn;
-		result[2] += dnpity*vn - dnpiyn;
+	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
+		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		eulerStepZCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	}
+}
 
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
-		}
-		//==========================================================================================
+template <int MODE, int DIMS>
+__global__
+void eulerStepKernelFused(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
+	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
+	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
 
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
+	if ( (i < d_ncx-2) && (j < d_ncy-2) && (k < d_ncz-2) ) {
+		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		eulerStepFusedCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
 	}
 }
-/**************************************************************************************************************************************************\
+/**************************************************************************************************************************************************/
 
 /**************************************************************************************************************************************************/
-__global__ 
+template <int MODE, int DIMS>
+__global__
 void eulerStepKernelSource_1D(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
 const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
@@ -955,59 +451,11 @@ const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __rest
 		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
 		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
 		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION Q[NUMBER_CONSERVED_VARIABLES];
-		PRECISION S[NUMBER_CONSERVED_VARIABLES];
-
-		Q[0] = currrentVars->ttt[s];
-		Q[1] = currrentVars->ttx[s];
-		Q[2] = currrentVars->tty[s];
-		Q[3] = currrentVars->ttn[s];
-#ifdef PIMUNU
-		Q[4] = currrentVars->pitt[s];
-		Q[5] = currrentVars->pitx[s];
-		Q[6] = currrentVars->pity[s];
-		Q[7] = currrentVars->pitn[s];
-		Q[8] = currrentVars->pixx[s];
-		Q[9] = currrentVars->pixy[s];
-		Q[10] = currrentVars->pixn[s];
-		Q[11] = currrentVars->piyy[s];
-		Q[12] = currrentVars->piyn[s];
-		Q[13] = currrentVars->pinn[s];
-#endif
-#ifdef PI
-		Q[14] = currrentVars->Pi[s];
-#endif
-
-		loadSourceTerms2(Q, S, u, up->ut[s], up->ux[s], up->uy[s], up->un[s], t, e[s], p, s);
-
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = *(Q+n) + d_dt * ( *(S+n) );
-		}
-
-		updatedVars->ttt[s] = result[0];
-		updatedVars->ttx[s] = result[1];
-		updatedVars->tty[s] = result[2];
-		updatedVars->ttn[s] = result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] = result[4];
-		updatedVars->pitx[s] = result[5];
-		updatedVars->pity[s] = result[6];
-		updatedVars->pitn[s] = result[7];
-		updatedVars->pixx[s] = result[8];
-		updatedVars->pixy[s] = result[9];
-		updatedVars->pixn[s] = result[10];
-		updatedVars->piyy[s] = result[11];
-		updatedVars->piyn[s] = result[12];
-		updatedVars->pinn[s] = result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] = result[14];
-#endif
+		eulerStepSourceCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
 	}
 }
 
+template <int MODE>
 __global__
 void eulerStepKernelX_1D(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
@@ -1019,84 +467,11 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
 		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
 		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION I[5 * NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
-
-		// calculate neighbor cell indices;
-		int sim = s-1;
-		int simm = sim-1;
-		int sip = s+1;
-		int sipp = sip+1;
-
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-#ifdef PIMUNU
-		setNeighborCellsJK2(currrentVars->pitt,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pity,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixx,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixy,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyy,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pinn,I,s,ptr,simm,sim,sip,sipp); ptr+=5;
-#endif
-#ifdef PI
-		setNeighborCellsJK2(currrentVars->Pi,I,s,ptr,simm,sim,sip,sipp);
-#endif
-
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(I, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusX, &Fx, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux(I, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusX, &Fx, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dx;
-		}
-#ifndef IDEAL
-		loadSourceTermsX(I, H, u, s);
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
-		}
-#else
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
-		}
-#endif
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
-		}
-
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
+		eulerStepXCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 	}
 }
 
+template <int MODE>
 __global__
 void eulerStepKernelY_1D(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
@@ -1108,84 +483,11 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
 		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
 		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION J[5* NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
-
-		// calculate neighbor cell indices;
-		int sjm = s-d_ncx;
-		int sjmm = sjm-d_ncx;
-		int sjp = s+d_ncx;
-		int sjpp = sjp+d_ncx;
-
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-#ifdef PIMUNU
-		setNeighborCellsJK2(currrentVars->pitt,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pity,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixx,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixy,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyy,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pinn,J,s,ptr,sjmm,sjm,sjp,sjpp); ptr+=5;
-#endif
-#ifdef PI
-		setNeighborCellsJK2(currrentVars->Pi,J,s,ptr,sjmm,sjm,sjp,sjpp);
-#endif
-
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(J, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusY, &Fy, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = - *(H+n);
-		}
-		flux(J, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusY, &Fy, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dy;
-		}
-#ifndef IDEAL
-		loadSourceTermsY(J, H, u, s);
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
-		}
-#else
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
-		}
-#endif
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
-		}
-
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
+		eulerStepYCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 	}
 }
 
+template <int MODE>
 __global__
 void eulerStepKernelZ_1D(PRECISION t,
 const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
@@ -1197,82 +499,281 @@ const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict_
 		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
 		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
 		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		eulerStepZCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	}
+}
 
-		PRECISION K[5 * NUMBER_CONSERVED_VARIABLES];
-		PRECISION H[NUMBER_CONSERVED_VARIABLES];
+template <int MODE, int DIMS>
+__global__
+void eulerStepKernelFused_1D(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+	if (threadID < d_nElements) {
+		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		eulerStepFusedCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+	}
+}
+/**************************************************************************************************************************************************/
 
-		// calculate neighbor cell indices;
-		int stride = d_ncx * d_ncy;
-		int skm = s-stride;
-		int skmm = skm-stride;
-		int skp = s+stride;
-		int skpp = skp+stride;
+/**************************************************************************************************************************************************/
+// Host backend: the same per-cell updates over the interior of the lattice
+/**************************************************************************************************************************************************/
+template <int MODE, int DIMS>
+void eulerStepSourceHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				eulerStepSourceCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+			}
+		}
+	}
+}
 
-		int ptr=0;
-		setNeighborCellsJK2(currrentVars->ttt,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->tty,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->ttn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-#ifdef PIMUNU
-		setNeighborCellsJK2(currrentVars->pitt,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pity,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pitn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixx,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixy,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pixn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyy,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->piyn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-		setNeighborCellsJK2(currrentVars->pinn,K,s,ptr,skmm,skm,skp,skpp); ptr+=5;
-#endif
-#ifdef PI
-		setNeighborCellsJK2(currrentVars->Pi,K,s,ptr,skmm,skm,skp,skpp);
-#endif
+template <int MODE>
+void eulerStepXHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				eulerStepXCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+			}
+		}
+	}
+}
 
-		PRECISION result[NUMBER_CONSERVED_VARIABLES];
-		flux(K, H, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward, &spectralRadiusZ, &Fz, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) = -*(H+n);
+template <int MODE>
+void eulerStepYHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				eulerStepYCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+			}
 		}
-		flux(K, H, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards, &spectralRadiusZ, &Fz, t, e[s]);
-		for (unsigned int n = 0; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) /= d_dz;
+	}
+}
+
+template <int MODE>
+void eulerStepZHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const FLUID_VELOCITY * const __restrict__ u, const PRECISION * const __restrict__ e
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				eulerStepZCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+			}
 		}
-#ifndef IDEAL
-		loadSourceTermsZ(K, H, u, s, t);
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) += *(H+n);
-			*(result+n) *= d_dt;
+	}
+}
+
+template <int MODE, int DIMS>
+void eulerStepFusedHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				eulerStepFusedCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+			}
 		}
-#else
-		for (unsigned int n = 0; n < 4; ++n) {
-			*(result+n) *= d_dt;
+	}
+}
+
+// Flat loops over the interior with the index arithmetic of the 1D kernels
+template <int MODE, int DIMS>
+void eulerStepFused1DHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+#pragma omp parallel for
+	for (int threadID = 0; threadID < h_nElements; ++threadID) {
+		int k = threadID / (h_nx * h_ny) + N_GHOST_CELLS_M;
+		int j = (threadID % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+		int i = threadID % h_nx + N_GHOST_CELLS_M;
+		int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+		eulerStepFusedCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+	}
+}
+
+template <int MODE, int DIMS>
+void eulerStepSplit1DHost(PRECISION t,
+const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up
+) {
+	beginPhase(PHASE_SOURCE_TERMS);
+#pragma omp parallel for
+	for (int threadID = 0; threadID < h_nElements; ++threadID) {
+		int k = threadID / (h_nx * h_ny) + N_GHOST_CELLS_M;
+		int j = (threadID % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+		int i = threadID % h_nx + N_GHOST_CELLS_M;
+		int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+		eulerStepSourceCell<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up, s);
+	}
+	endPhase(PHASE_SOURCE_TERMS);
+	beginPhase(PHASE_FLUXES);
+#pragma omp parallel for
+	for (int threadID = 0; threadID < h_nElements; ++threadID) {
+		int k = threadID / (h_nx * h_ny) + N_GHOST_CELLS_M;
+		int j = (threadID % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+		int i = threadID % h_nx + N_GHOST_CELLS_M;
+		int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+		eulerStepXCell<MODE>(t, currrentVars, updatedVars, u, e, s);
+	}
+	if (EVOLVE_Y(DIMS)) {
+#pragma omp parallel for
+		for (int threadID = 0; threadID < h_nElements; ++threadID) {
+			int k = threadID / (h_nx * h_ny) + N_GHOST_CELLS_M;
+			int j = (threadID % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+			int i = threadID % h_nx + N_GHOST_CELLS_M;
+			int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+			eulerStepYCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 		}
-#endif
-		for (unsigned int n = 4; n < NUMBER_CONSERVED_VARIABLES; ++n) {
-			*(result+n) *= d_dt;
+	}
+	if (EVOLVE_Z(DIMS)) {
+#pragma omp parallel for
+		for (int threadID = 0; threadID < h_nElements; ++threadID) {
+			int k = threadID / (h_nx * h_ny) + N_GHOST_CELLS_M;
+			int j = (threadID % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+			int i = threadID % h_nx + N_GHOST_CELLS_M;
+			int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+			eulerStepZCell<MODE>(t, currrentVars, updatedVars, u, e, s);
 		}
-
-		updatedVars->ttt[s] += result[0];
-		updatedVars->ttx[s] += result[1];
-		updatedVars->tty[s] += result[2];
-		updatedVars->ttn[s] += result[3];
-#ifdef PIMUNU
-		updatedVars->pitt[s] += result[4];
-		updatedVars->pitx[s] += result[5];
-		updatedVars->pity[s] += result[6];
-		updatedVars->pitn[s] += result[7];
-		updatedVars->pixx[s] += result[8];
-		updatedVars->pixy[s] += result[9];
-		updatedVars->pixn[s] += result[10];
-		updatedVars->piyy[s] += result[11];
-		updatedVars->piyn[s] += result[12];
-		updatedVars->pinn[s] += result[13];
-#endif
-#ifdef PI
-		updatedVars->Pi[s] += result[14];
-#endif
 	}
+	endPhase(PHASE_FLUXES);
 }
 /**************************************************************************************************************************************************/
+
+#define INSTANTIATE_EULER_STEP_DIMENSIONS(MODE, DIMS) \
+template __global__ void eulerStepKernelSource<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template __global__ void eulerStepKernelSource_1D<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template __global__ void eulerStepKernelFused<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template __global__ void eulerStepKernelFused_1D<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template void eulerStepSourceHost<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template void eulerStepFusedHost<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template void eulerStepFused1DHost<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up); \
+template void eulerStepSplit1DHost<MODE, DIMS>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const PRECISION * const __restrict__ e, \
+		const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const FLUID_VELOCITY * const __restrict__ up);
+#define INSTANTIATE_EULER_STEP(MODE) \
+template __global__ void eulerStepKernelX<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template __global__ void eulerStepKernelY<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template __global__ void eulerStepKernelZ<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template __global__ void eulerStepKernelX_1D<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template __global__ void eulerStepKernelY_1D<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template __global__ void eulerStepKernelZ_1D<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template void eulerStepXHost<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template void eulerStepYHost<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+template void eulerStepZHost<MODE>(PRECISION t, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		CONSERVED_VARIABLES * const __restrict__ updatedVars, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		const PRECISION * const __restrict__ e); \
+INSTANTIATE_LATTICE_DIMENSIONS(INSTANTIATE_EULER_STEP_DIMENSIONS, MODE)
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_EULER_STEP)
@@ -0,0 +1,196 @@
+/*
+ * EulerStepStrategy.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h> // for printf
+#include <string.h> // for strcmp
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
+#include "edu/osu/rhic/trunk/hydro/EulerStep.cuh"
+#include "edu/osu/rhic/trunk/hydro/GhostCells.cuh"
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
+
+int eulerStepStrategy = DEFAULT_EULER_STEP_STRATEGY;
+
+static const char * const eulerStepStrategyNames[NUMBER_EULER_STEP_STRATEGIES] = {
+	"fused", "fused_1d", "split", "split_1d"
+};
+
+int findEulerStepStrategy(const char *name) {
+	for (int n = 0; n < NUMBER_EULER_STEP_STRATEGIES; ++n) {
+		if (strcmp(name, eulerStepStrategyNames[n]) == 0) return n;
+	}
+	return -1;
+}
+
+const char * getEulerStepStrategyName(int strategy) {
+	if (strategy < 0 || strategy >= NUMBER_EULER_STEP_STRATEGIES) return "unknown";
+	return eulerStepStrategyNames[strategy];
+}
+
+/**************************************************************************************************************************************************/
+// Device implementations
+/**************************************************************************************************************************************************/
+template <int MODE, int DIMS>
+void eulerStepFused(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	eulerStepKernelFused<MODE, DIMS><<<GF, BF>>>(t, currrentVars, updatedVars, e, p, u, up);
+}
+
+template <int MODE, int DIMS>
+void eulerStepFused1D(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	eulerStepKernelFused_1D<MODE, DIMS><<<grid_fused_1D, block_fused_1D>>>(t, currrentVars, updatedVars, e, p, u, up);
+}
+
+template <int MODE, int DIMS>
+void eulerStepSplit(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	beginPhase(PHASE_SOURCE_TERMS);
+	eulerStepKernelSource<MODE, DIMS><<<grid, block>>>(t, currrentVars, updatedVars, e, p, u, up);
+	endPhase(PHASE_SOURCE_TERMS);
+	beginPhase(PHASE_FLUXES);
+	eulerStepKernelX<MODE><<<grid_X, block_X>>>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Y(DIMS)) eulerStepKernelY<MODE><<<grid_Y, block_Y>>>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Z(DIMS)) eulerStepKernelZ<MODE><<<grid_Z, block_Z>>>(t, currrentVars, updatedVars, u, e);
+	endPhase(PHASE_FLUXES);
+}
+
+template <int MODE, int DIMS>
+void eulerStepSplit1D(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	beginPhase(PHASE_SOURCE_TERMS);
+	eulerStepKernelSource_1D<MODE, DIMS><<<grid_1D, block_1D>>>(t, currrentVars, updatedVars, e, p, u, up);
+	endPhase(PHASE_SOURCE_TERMS);
+	beginPhase(PHASE_FLUXES);
+	eulerStepKernelX_1D<MODE><<<gridX_1D, blockX_1D>>>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Y(DIMS)) eulerStepKernelY_1D<MODE><<<gridY_1D, blockY_1D>>>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Z(DIMS)) eulerStepKernelZ_1D<MODE><<<gridZ_1D, blockZ_1D>>>(t, currrentVars, updatedVars, u, e);
+	endPhase(PHASE_FLUXES);
+}
+
+/**************************************************************************************************************************************************/
+// Host implementations
+/**************************************************************************************************************************************************/
+template <int MODE, int DIMS>
+void eulerStepSplitHost(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	beginPhase(PHASE_SOURCE_TERMS);
+	eulerStepSourceHost<MODE, DIMS>(t, currrentVars, updatedVars, e, p, u, up);
+	endPhase(PHASE_SOURCE_TERMS);
+	beginPhase(PHASE_FLUXES);
+	eulerStepXHost<MODE>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Y(DIMS)) eulerStepYHost<MODE>(t, currrentVars, updatedVars, u, e);
+	if (EVOLVE_Z(DIMS)) eulerStepZHost<MODE>(t, currrentVars, updatedVars, u, e);
+	endPhase(PHASE_FLUXES);
+}
+/**************************************************************************************************************************************************/
+
+#define EULER_STEP_STRATEGIES(MODE, DIMS) { \
+		{ eulerStepStrategyNames[EULER_STEP_FUSED], &eulerStepFused<MODE, DIMS>, &eulerStepFusedHost<MODE, DIMS> }, \
+		{ eulerStepStrategyNames[EULER_STEP_FUSED_1D], &eulerStepFused1D<MODE, DIMS>, &eulerStepFused1DHost<MODE, DIMS> }, \
+		{ eulerStepStrategyNames[EULER_STEP_SPLIT], &eulerStepSplit<MODE, DIMS>, &eulerStepSplitHost<MODE, DIMS> }, \
+		{ eulerStepStrategyNames[EULER_STEP_SPLIT_1D], &eulerStepSplit1D<MODE, DIMS>, &eulerStepSplit1DHost<MODE, DIMS> } \
+	}
+
+template <int MODE>
+const EULER_STEP_STRATEGY * getEulerStepStrategy(int strategy) {
+	static const EULER_STEP_STRATEGY strategies[NUMBER_LATTICE_DIMENSIONS][NUMBER_EULER_STEP_STRATEGIES] = {
+		EULER_STEP_STRATEGIES(MODE, LATTICE_3D),
+		EULER_STEP_STRATEGIES(MODE, LATTICE_2D),
+		EULER_STEP_STRATEGIES(MODE, LATTICE_1D)
+	};
+	return &strategies[latticeDimensions][strategy];
+}
+
+static void timedEulerStep(const EULER_STEP_STRATEGY * strategy, PRECISION t, bool host) {
+	if (host) strategy->host(t, q, h_qS, e, p, u, h_up);
+	else strategy->device(t, d_q, d_qS, d_e, d_p, d_u, d_up);
+}
+
+template <int MODE>
+int autotuneEulerStep(PRECISION t, int steps, bool host) {
+	int fastest = eulerStepStrategy;
+	double fastestTime = -1;
+
+	printf("===================================================\n");
+	printf("Autotuning the Euler step (%d steps per strategy)\n", steps);
+	for (int n = 0; n < NUMBER_EULER_STEP_STRATEGIES; ++n) {
+		const EULER_STEP_STRATEGY * strategy = getEulerStepStrategy<MODE>(n);
+		// untimed step to exclude first-launch and cache warm-up costs
+		timedEulerStep(strategy, t, host);
+		if (!host) {
+			cudaDeviceSynchronize();
+			// e.g. a block size that exceeds the register file for the fused kernels
+			cudaError_t error = cudaGetLastError();
+			if (error != cudaSuccess) {
+				printf("%s= not available (%s)\n", strategy->name, cudaGetErrorString(error));
+				continue;
+			}
+		}
+
+		double start = monotonicTime();
+		for (int i = 0; i < steps; ++i) timedEulerStep(strategy, t, host);
+		if (!host) cudaDeviceSynchronize();
+		double elapsedTime = (monotonicTime() - start) / steps;
+
+		printf("%s= %.3f ms/step\n", strategy->name, elapsedTime);
+		if (fastestTime < 0 || elapsedTime < fastestTime) {
+			fastest = n;
+			fastestTime = elapsedTime;
+		}
+	}
+	printf("===================================================\n");
+	return fastest;
+}
+
+template <int MODE>
+static double timedLatticeStep(PRECISION t, int steps, bool host) {
+	const EULER_STEP_STRATEGY * strategy = getEulerStepStrategy<MODE>(eulerStepStrategy);
+	// untimed step to exclude first-launch and cache warm-up costs
+	timedEulerStep(strategy, t, host);
+	double start = monotonicTime();
+	for (int i = 0; i < steps; ++i) {
+		timedEulerStep(strategy, t, host);
+		if (host) setGhostCellsHost<MODE>(h_qS, e, p, u);
+		else setGhostCells<MODE>(d_qS, d_e, d_p, d_u);
+	}
+	if (!host) cudaDeviceSynchronize();
+	return (monotonicTime() - start) / steps;
+}
+
+template <int MODE>
+void benchmarkLatticeDimensions(PRECISION t, int steps, bool host) {
+	int dimensions = latticeDimensions;
+	printf("===================================================\n");
+	printf("Benchmarking the %s Euler step (%d steps)\n", eulerStepStrategyNames[eulerStepStrategy], steps);
+	latticeDimensions = LATTICE_3D;
+	double time3D = timedLatticeStep<MODE>(t, steps, host);
+	latticeDimensions = dimensions;
+	double time = timedLatticeStep<MODE>(t, steps, host);
+	printf("%s= %.3f ms/step\n", getLatticeDimensionsName(LATTICE_3D), time3D);
+	if (dimensions != LATTICE_3D) {
+		printf("%s= %.3f ms/step (%.1f%% saved)\n", getLatticeDimensionsName(dimensions), time, 100 * (1 - time / time3D));
+	}
+	printf("===================================================\n");
+}
+
+#define INSTANTIATE_EULER_STEP_STRATEGY(MODE) \
+template const EULER_STEP_STRATEGY * getEulerStepStrategy<MODE>(int strategy); \
+template int autotuneEulerStep<MODE>(PRECISION t, int steps, bool host); \
+template void benchmarkLatticeDimensions<MODE>(PRECISION t, int steps, bool host);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_EULER_STEP_STRATEGY)
@@ -24,57 +24,31 @@
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 #include "edu/osu/rhic/trunk/hydro/RegulateDissipativeCurrents.cuh"
 #include "edu/osu/rhic/trunk/hydro/EulerStep.cuh"
-#include "edu/osu/rhic/trunk/hydro/HydrodynamicValidity.cuh"
-
-//#define EULER_STEP_FUSED
-//#define EULER_STEP_FUSED_1D
-//#define EULER_STEP_SPLIT
-//#define EULER_STEP_SMEM
-#define EULER_STEP_SPLIT_1D
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+#include "edu/osu/rhic/trunk/hydro/HaloExchange.cuh"
+#include "edu/osu/rhic/harness/util/PhaseTimers.h"
 
+template <int MODE>
 void eulerStep(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
 		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
 		const FLUID_VELOCITY * const __restrict__ up) {
-#if defined EULER_STEP_FUSED
-	eulerStepKernel<<<GF, BF>>>(t, currrentVars, updatedVars, e, p, u, up);
-#elif defined EULER_STEP_FUSED_1D
-	eulerStepKernel_1D<<<grid_fused_1D, block_fused_1D>>>(t, currrentVars, updatedVars, e, p, u, up);
-#elif defined EULER_STEP_SPLIT
-	eulerStepKernelSource<<<grid, block>>>(t, currrentVars, updatedVars, e, p, u, up);
-	eulerStepKernelX<<<grid_X, block_X>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelY<<<grid_Y, block_Y>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelZ<<<grid_Z, block_Z>>>(t, currrentVars, updatedVars, u, e);
-#elif defined EULER_STEP_SMEM
-	eulerStepKernelSource<<<grid, block>>>(t, currrentVars, updatedVars, e, p, u, up);
-	eulerStepKernelSharedX<<<GSX, BSX>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelSharedY<<<GSY, BSY>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelSharedZ<<<GSZ, BSZ>>>(t, currrentVars, updatedVars, u, e);
-#elif defined EULER_STEP_SPLIT_1D
-	eulerStepKernelSource_1D<<<grid_1D, block_1D>>>(t, currrentVars, updatedVars, e, p, u, up);
-	eulerStepKernelX_1D<<<gridX_1D, blockX_1D>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelY_1D<<<gridY_1D, blockY_1D>>>(t, currrentVars, updatedVars, u, e);
-	eulerStepKernelZ_1D<<<gridZ_1D, blockZ_1D>>>(t, currrentVars, updatedVars, u, e);
-#endif
+	beginPhase(PHASE_EULER_STEP);
+	getEulerStepStrategy<MODE>(eulerStepStrategy)->device(t, currrentVars, updatedVars, e, p, u, up);
+	endPhase(PHASE_EULER_STEP);
 }
 
-__global__
-void convexCombinationEulerStepKernel(const CONSERVED_VARIABLES * const __restrict__ q, CONSERVED_VARIABLES * const __restrict__ Q) {
-	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
-	if (threadID < d_nElements) {
-		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
-		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
-		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
-		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		Q->ttt[s] += q->ttt[s];
-		Q->ttt[s] /= 2;
-		Q->ttx[s] += q->ttx[s];
-		Q->ttx[s] /= 2;
-		Q->tty[s] += q->tty[s];
-		Q->tty[s] /= 2;
-		Q->ttn[s] += q->ttn[s];
-		Q->ttn[s] /= 2;
-#ifdef PIMUNU
+template <int MODE>
+__host__ __device__
+void convexCombinationEulerStepCell(const CONSERVED_VARIABLES * const __restrict__ q, CONSERVED_VARIABLES * const __restrict__ Q, int s) {
+	Q->ttt[s] += q->ttt[s];
+	Q->ttt[s] /= 2;
+	Q->ttx[s] += q->ttx[s];
+	Q->ttx[s] /= 2;
+	Q->tty[s] += q->tty[s];
+	Q->tty[s] /= 2;
+	Q->ttn[s] += q->ttn[s];
+	Q->ttn[s] /= 2;
+	if (EVOLVE_PIMUNU(MODE)) {
 		Q->pitt[s] += q->pitt[s];
 		Q->pitt[s] /= 2;
 		Q->pitx[s] += q->pitx[s];
@@ -95,51 +69,323 @@ void convexCombinationEulerStepKernel(const CONSERVED_VARIABLES * const __restri
 		Q->piyn[s] /= 2;
 		Q->pinn[s] += q->pinn[s];
 		Q->pinn[s] /= 2;
-#endif
-#ifdef PI
+	}
+	if (EVOLVE_PI(MODE)) {
 		Q->Pi[s] += q->Pi[s];
 		Q->Pi[s] /= 2;
-#endif
 	}
 }
 
-#ifndef IDEAL
+template <int MODE>
+__global__
+void convexCombinationEulerStepKernel(const CONSERVED_VARIABLES * const __restrict__ q, CONSERVED_VARIABLES * const __restrict__ Q) {
+	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+	if (threadID < d_nElements) {
+		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		convexCombinationEulerStepCell<MODE>(q, Q, s);
+	}
+}
+
+/*
+ * Q = a q + (1-a) S in cell s, the averaging stages of the SSP Runge-Kutta scheme. S may be Q.
+ */
+template <int MODE>
+__host__ __device__
+void convexCombinationCell(PRECISION a, const CONSERVED_VARIABLES * const __restrict__ q, const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q, int s) {
+	PRECISION b = 1 - a;
+	Q->ttt[s] = a * q->ttt[s] + b * S->ttt[s];
+	Q->ttx[s] = a * q->ttx[s] + b * S->ttx[s];
+	Q->tty[s] = a * q->tty[s] + b * S->tty[s];
+	Q->ttn[s] = a * q->ttn[s] + b * S->ttn[s];
+	if (EVOLVE_PIMUNU(MODE)) {
+		Q->pitt[s] = a * q->pitt[s] + b * S->pitt[s];
+		Q->pitx[s] = a * q->pitx[s] + b * S->pitx[s];
+		Q->pity[s] = a * q->pity[s] + b * S->pity[s];
+		Q->pitn[s] = a * q->pitn[s] + b * S->pitn[s];
+		Q->pixx[s] = a * q->pixx[s] + b * S->pixx[s];
+		Q->pixy[s] = a * q->pixy[s] + b * S->pixy[s];
+		Q->pixn[s] = a * q->pixn[s] + b * S->pixn[s];
+		Q->piyy[s] = a * q->piyy[s] + b * S->piyy[s];
+		Q->piyn[s] = a * q->piyn[s] + b * S->piyn[s];
+		Q->pinn[s] = a * q->pinn[s] + b * S->pinn[s];
+	}
+	if (EVOLVE_PI(MODE)) {
+		Q->Pi[s] = a * q->Pi[s] + b * S->Pi[s];
+	}
+}
+
+template <int MODE>
+__global__
+void convexCombinationKernel(PRECISION a, const CONSERVED_VARIABLES * const __restrict__ q, const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q) {
+	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+	if (threadID < d_nElements) {
+		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		convexCombinationCell<MODE>(a, q, S, Q, s);
+	}
+}
+
+template <int MODE>
+void eulerStepHost(PRECISION t, const CONSERVED_VARIABLES * const __restrict__ currrentVars, CONSERVED_VARIABLES * const __restrict__ updatedVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	beginPhase(PHASE_EULER_STEP);
+	getEulerStepStrategy<MODE>(eulerStepStrategy)->host(t, currrentVars, updatedVars, e, p, u, up);
+	endPhase(PHASE_EULER_STEP);
+}
+
+template <int MODE>
+void convexCombinationEulerStepHost(const CONSERVED_VARIABLES * const __restrict__ q, CONSERVED_VARIABLES * const __restrict__ Q) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				convexCombinationEulerStepCell<MODE>(q, Q, s);
+			}
+		}
+	}
+}
+
+template <int MODE>
+void convexCombinationHost(PRECISION a, const CONSERVED_VARIABLES * const __restrict__ q, const CONSERVED_VARIABLES * const S,
+		CONSERVED_VARIABLES * const Q) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				convexCombinationCell<MODE>(a, q, S, Q, s);
+			}
+		}
+	}
+}
+
 #define REGULATE_DISSIPATIVE_CURRENTS
+
+// Inferred variables of the stage solution q and the regulation of its dissipative currents in the planes kBegin <= k < kEnd
+template <int MODE>
+void setStagePlanes(PRECISION t, CONSERVED_VARIABLES * const __restrict__ q, FLUID_VELOCITY * const __restrict__ u, int kBegin, int kEnd) {
+	int len = h_nx * h_ny * (kEnd - kBegin);
+	beginPhase(PHASE_INFERRED_VARIABLES);
+	setInferredVariablesKernel<MODE><<<(len + blockSizeInferredVars - 1) / blockSizeInferredVars, blockSizeInferredVars>>>(q, d_e, d_p, u, t, kBegin, kEnd);
+	endPhase(PHASE_INFERRED_VARIABLES);
+#ifdef REGULATE_DISSIPATIVE_CURRENTS
+	if (EVOLVE_PIMUNU(MODE)) {
+		beginPhase(PHASE_REGULATION);
+		regulateDissipativeCurrents<<<(len + blockSizeReg - 1) / blockSizeReg, blockSizeReg>>>(t, q, d_e, d_p, u, d_validityDomain, kBegin, kEnd);
+		endPhase(PHASE_REGULATION);
+	}
 #endif
+}
+
+template <int MODE>
+void setStagePlanesHost(PRECISION t, CONSERVED_VARIABLES * const __restrict__ q, FLUID_VELOCITY * const __restrict__ u, int kBegin, int kEnd) {
+	beginPhase(PHASE_INFERRED_VARIABLES);
+	setInferredVariablesHost<MODE>(q, e, p, u, t, kBegin, kEnd);
+	endPhase(PHASE_INFERRED_VARIABLES);
+#ifdef REGULATE_DISSIPATIVE_CURRENTS
+	if (EVOLVE_PIMUNU(MODE)) {
+		beginPhase(PHASE_REGULATION);
+		regulateDissipativeCurrentsHost(t, q, e, p, u, validityDomain, kBegin, kEnd);
+		endPhase(PHASE_REGULATION);
+	}
+#endif
+}
+
+/*
+ * Energy density, pressure and fluid velocity u of the stage solution q at time t, followed by the
+ * regulation of the dissipative currents and the ghost cells. With a domain decomposition the planes
+ * sent to the neighbouring slabs are set first, and the transfer overlaps with the remaining planes.
+ */
+template <int MODE>
+void setStageVariables(PRECISION t, CONSERVED_VARIABLES * const __restrict__ q, FLUID_VELOCITY * const __restrict__ u) {
+	if (!isHaloExchangeEnabled()) {
+		setStagePlanes<MODE>(t, q, u, N_GHOST_CELLS_M, h_nz + N_GHOST_CELLS_M);
+		beginPhase(PHASE_GHOST_CELLS);
+		setGhostCells<MODE>(q, d_e, d_p, u);
+		endPhase(PHASE_GHOST_CELLS);
+		return;
+	}
+	setStagePlanes<MODE>(t, q, u, N_GHOST_CELLS_M, 2 * N_GHOST_CELLS_M);
+	setStagePlanes<MODE>(t, q, u, h_nz, h_nz + N_GHOST_CELLS_M);
+	beginPhase(PHASE_HALO_EXCHANGE);
+	beginHaloExchange<MODE>(q, d_e, d_p, u, false);
+	endPhase(PHASE_HALO_EXCHANGE);
+	setStagePlanes<MODE>(t, q, u, 2 * N_GHOST_CELLS_M, h_nz);
+	beginPhase(PHASE_GHOST_CELLS);
+	setGhostCells<MODE>(q, d_e, d_p, u);
+	endPhase(PHASE_GHOST_CELLS);
+	beginPhase(PHASE_HALO_EXCHANGE);
+	endHaloExchange(false);
+	endPhase(PHASE_HALO_EXCHANGE);
+}
+
+template <int MODE>
+void setStageVariablesHost(PRECISION t, CONSERVED_VARIABLES * const __restrict__ q, FLUID_VELOCITY * const __restrict__ u) {
+	if (!isHaloExchangeEnabled()) {
+		setStagePlanesHost<MODE>(t, q, u, N_GHOST_CELLS_M, h_nz + N_GHOST_CELLS_M);
+		beginPhase(PHASE_GHOST_CELLS);
+		setGhostCellsHost<MODE>(q, e, p, u);
+		endPhase(PHASE_GHOST_CELLS);
+		return;
+	}
+	setStagePlanesHost<MODE>(t, q, u, N_GHOST_CELLS_M, 2 * N_GHOST_CELLS_M);
+	setStagePlanesHost<MODE>(t, q, u, h_nz, h_nz + N_GHOST_CELLS_M);
+	beginPhase(PHASE_HALO_EXCHANGE);
+	beginHaloExchange<MODE>(q, e, p, u, true);
+	endPhase(PHASE_HALO_EXCHANGE);
+	setStagePlanesHost<MODE>(t, q, u, 2 * N_GHOST_CELLS_M, h_nz);
+	beginPhase(PHASE_GHOST_CELLS);
+	setGhostCellsHost<MODE>(q, e, p, u);
+	endPhase(PHASE_GHOST_CELLS);
+	beginPhase(PHASE_HALO_EXCHANGE);
+	endHaloExchange(true);
+	endPhase(PHASE_HALO_EXCHANGE);
+}
+
+template <int MODE>
 void twoStepRungeKutta(PRECISION t, PRECISION dt, CONSERVED_VARIABLES * __restrict__ d_q, CONSERVED_VARIABLES * __restrict__ d_Q) {
 	//===================================================
 	// Predicted step
 	//===================================================
-	eulerStep(t, d_q, d_qS, d_e, d_p, d_u, d_up);
+	eulerStep<MODE>(t, d_q, d_qS, d_e, d_p, d_u, d_up);
 
 	t += dt;
+	// from here on u is differentiated against the fluid velocity at the start of the step
+	setPreviousTimeStep(dt, false);
 
-	setInferredVariablesKernel<<<gridSizeInferredVars, blockSizeInferredVars>>>(d_qS, d_e, d_p, d_uS, t);
+	setStageVariables<MODE>(t, d_qS, d_uS);
 
-#ifdef REGULATE_DISSIPATIVE_CURRENTS
-	regulateDissipativeCurrents<<<gridSizeReg, blockSizeReg>>>(t, d_qS, d_e, d_p, d_uS, d_validityDomain);
-#endif
+	//===================================================
+	// Corrected step
+	//===================================================
+	eulerStep<MODE>(t, d_qS, d_Q, d_e, d_p, d_uS, d_u);
 
-	setGhostCells(d_qS, d_e, d_p, d_uS);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationEulerStepKernel<MODE><<<gridSizeConvexComb, blockSizeConvexComb>>>(d_q, d_Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
+
+	swapFluidVelocity(&d_up, &d_u);
+	setStageVariables<MODE>(t, d_Q, d_u);
+	cudaDeviceSynchronize();
+}
+
+/*
+ * Same sequence of stages as twoStepRungeKutta, run on the host lattice (q, e, p, u) with the
+ * intermediate buffers h_qS, h_Q, h_uS and h_up. Each stage is an OpenMP loop over the interior.
+ */
+template <int MODE>
+void twoStepRungeKuttaHost(PRECISION t, PRECISION dt, CONSERVED_VARIABLES * __restrict__ q, CONSERVED_VARIABLES * __restrict__ Q) {
+	//===================================================
+	// Predicted step
+	//===================================================
+	eulerStepHost<MODE>(t, q, h_qS, e, p, u, h_up);
+
+	t += dt;
+	setPreviousTimeStep(dt, true);
+
+	setStageVariablesHost<MODE>(t, h_qS, h_uS);
 
 	//===================================================
 	// Corrected step
 	//===================================================
-	eulerStep(t, d_qS, d_Q, d_e, d_p, d_uS, d_u);
+	eulerStepHost<MODE>(t, h_qS, Q, e, p, h_uS, u);
 
-	convexCombinationEulerStepKernel<<<gridSizeConvexComb, blockSizeConvexComb>>>(d_q, d_Q);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationEulerStepHost<MODE>(q, Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
 
-	swapFluidVelocity(&d_up, &d_u);
-	setInferredVariablesKernel<<<gridSizeInferredVars, blockSizeInferredVars>>>(d_Q, d_e, d_p, d_u, t);
+	swapFluidVelocity(&h_up, &u);
+	setStageVariablesHost<MODE>(t, Q, u);
+}
 
-#ifdef REGULATE_DISSIPATIVE_CURRENTS	
-	regulateDissipativeCurrents<<<gridSizeReg, blockSizeReg>>>(t, d_Q, d_e, d_p, d_u, d_validityDomain);
-#endif
+/*
+ * Third order strong stability preserving Runge-Kutta scheme (Shu and Osher):
+ *   q1 = q + dt L(q),  q2 = 3/4 q + 1/4 (q1 + dt L(q1)),  Q = 1/3 q + 2/3 (q2 + dt L(q2)).
+ * The stages are at t, t+dt and t+dt/2. The source terms differentiate the stage fluid velocity against the
+ * one at t, so the lag dtp is the previous time step, dt and dt/2. Like twoStepRungeKutta the result is left in Q
+ * (with e, p and u) and the fluid velocity at t in up. The intermediate stages use qS, uS and Q itself.
+ */
+template <int MODE>
+void threeStepRungeKutta(PRECISION t, PRECISION dt, CONSERVED_VARIABLES * __restrict__ d_q, CONSERVED_VARIABLES * __restrict__ d_Q) {
+	// q1 at t+dt
+	eulerStep<MODE>(t, d_q, d_qS, d_e, d_p, d_u, d_up);
+	setPreviousTimeStep(dt, false);
+	setStageVariables<MODE>(t + dt, d_qS, d_uS);
 
-	setGhostCells(d_Q, d_e, d_p, d_u);
+	// q2 at t+dt/2
+	eulerStep<MODE>(t + dt, d_qS, d_Q, d_e, d_p, d_uS, d_u);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationKernel<MODE><<<gridSizeConvexComb, blockSizeConvexComb>>>((PRECISION) 0.75, d_q, d_Q, d_Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
+	setPreviousTimeStep(dt/2, false);
+	setStageVariables<MODE>(t + dt/2, d_Q, d_uS);
 
-//#ifndef IDEAL
-	checkValidity(t, d_validityDomain, d_q, d_e, d_p, d_u, d_up);
-//#endif
+	// Q at t+dt
+	eulerStep<MODE>(t + dt/2, d_Q, d_qS, d_e, d_p, d_uS, d_u);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationKernel<MODE><<<gridSizeConvexComb, blockSizeConvexComb>>>((PRECISION) (1./3), d_q, d_qS, d_Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
+	setPreviousTimeStep(dt, false);
+	swapFluidVelocity(&d_up, &d_u);
+	setStageVariables<MODE>(t + dt, d_Q, d_u);
 	cudaDeviceSynchronize();
 }
+
+template <int MODE>
+void threeStepRungeKuttaHost(PRECISION t, PRECISION dt, CONSERVED_VARIABLES * __restrict__ q, CONSERVED_VARIABLES * __restrict__ Q) {
+	// q1 at t+dt
+	eulerStepHost<MODE>(t, q, h_qS, e, p, u, h_up);
+	setPreviousTimeStep(dt, true);
+	setStageVariablesHost<MODE>(t + dt, h_qS, h_uS);
+
+	// q2 at t+dt/2
+	eulerStepHost<MODE>(t + dt, h_qS, Q, e, p, h_uS, u);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationHost<MODE>((PRECISION) 0.75, q, Q, Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
+	setPreviousTimeStep(dt/2, true);
+	setStageVariablesHost<MODE>(t + dt/2, Q, h_uS);
+
+	// Q at t+dt
+	eulerStepHost<MODE>(t + dt/2, Q, h_qS, e, p, h_uS, u);
+	beginPhase(PHASE_CONVEX_COMBINATION);
+	convexCombinationHost<MODE>((PRECISION) (1./3), q, h_qS, Q);
+	endPhase(PHASE_CONVEX_COMBINATION);
+	setPreviousTimeStep(dt, true);
+	swapFluidVelocity(&h_up, &u);
+	setStageVariablesHost<MODE>(t + dt, Q, u);
+}
+
+#define INSTANTIATE_RUNGE_KUTTA(MODE) \
+template __global__ void convexCombinationEulerStepKernel<MODE>(const CONSERVED_VARIABLES * const __restrict__ q, \
+		CONSERVED_VARIABLES * const __restrict__ Q); \
+template void twoStepRungeKutta<MODE>(PRECISION t, PRECISION dt, \
+		CONSERVED_VARIABLES * __restrict__ d_q, \
+		CONSERVED_VARIABLES * __restrict__ d_Q); \
+template void convexCombinationEulerStepHost<MODE>(const CONSERVED_VARIABLES * const __restrict__ q, \
+		CONSERVED_VARIABLES * const __restrict__ Q); \
+template void twoStepRungeKuttaHost<MODE>(PRECISION t, PRECISION dt, \
+		CONSERVED_VARIABLES * __restrict__ q, \
+		CONSERVED_VARIABLES * __restrict__ Q); \
+template __global__ void convexCombinationKernel<MODE>(PRECISION a, const CONSERVED_VARIABLES * const __restrict__ q, \
+		const CONSERVED_VARIABLES * const S, CONSERVED_VARIABLES * const Q); \
+template void convexCombinationHost<MODE>(PRECISION a, const CONSERVED_VARIABLES * const __restrict__ q, \
+		const CONSERVED_VARIABLES * const S, CONSERVED_VARIABLES * const Q); \
+template void threeStepRungeKutta<MODE>(PRECISION t, PRECISION dt, \
+		CONSERVED_VARIABLES * __restrict__ d_q, \
+		CONSERVED_VARIABLES * __restrict__ d_Q); \
+template void threeStepRungeKuttaHost<MODE>(PRECISION t, PRECISION dt, \
+		CONSERVED_VARIABLES * __restrict__ q, \
+		CONSERVED_VARIABLES * __restrict__ Q); \
+template void setStageVariablesHost<MODE>(PRECISION t, CONSERVED_VARIABLES * const __restrict__ q, \
+		FLUID_VELOCITY * const __restrict__ u);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_RUNGE_KUTTA)
@@ -12,6 +12,7 @@
 #include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 
+template <int MODE>
 void setGhostCells(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
@@ -21,14 +22,16 @@ FLUID_VELOCITY * const __restrict__ u
 #pragma unroll 3
    for (int i = 0; i < nstreams; i++) cudaStreamCreate(&(streams[i]));
 
-	setGhostCellsKernelI<<<gridSizeGhostI, blockSizeGhostI, 0, streams[0]>>>(q,e,p,u);
-	setGhostCellsKernelJ<<<gridSizeGhostJ, blockSizeGhostJ, 0, streams[1]>>>(q,e,p,u);
-	setGhostCellsKernelK<<<gridSizeGhostK, blockSizeGhostK, 0, streams[2]>>>(q,e,p,u);
+	setGhostCellsKernelI<MODE><<<gridSizeGhostI, blockSizeGhostI, 0, streams[0]>>>(q,e,p,u);
+	// faces along trivial directions are never read
+	if (EVOLVE_Y(latticeDimensions)) setGhostCellsKernelJ<MODE><<<gridSizeGhostJ, blockSizeGhostJ, 0, streams[1]>>>(q,e,p,u);
+	if (EVOLVE_Z(latticeDimensions)) setGhostCellsKernelK<MODE><<<gridSizeGhostK, blockSizeGhostK, 0, streams[2]>>>(q,e,p,u);
 #pragma unroll 3
 	for (int i = 0; i < nstreams; i++) cudaStreamDestroy(streams[i]);
 }
 
-__device__
+template <int MODE>
+__host__ __device__
 void setGhostCellVars(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u,
@@ -44,51 +47,56 @@ int s, int sBC) {
 	q->tty[s] = q->tty[sBC];
 	q->ttn[s] = q->ttn[sBC];
 	// set \pi^\mu\nu ghost cells if evolved
-#ifdef PIMUNU
-	q->pitt[s] = q->pitt[sBC];
-	q->pitx[s] = q->pitx[sBC];
-	q->pity[s] = q->pity[sBC];
-	q->pitn[s] = q->pitn[sBC];
-	q->pixx[s] = q->pixx[sBC];
-	q->pixy[s] = q->pixy[sBC];
-	q->pixn[s] = q->pixn[sBC];
-	q->piyy[s] = q->piyy[sBC];
-	q->piyn[s] = q->piyn[sBC];
-	q->pinn[s] = q->pinn[sBC];
-#endif
-	// set \Pi ghost cells if evolved
-#ifdef PI
-	q->Pi[s] = q->Pi[sBC];
-#endif
+	if (EVOLVE_PIMUNU(MODE)) {
+			q->pitt[s] = q->pitt[sBC];
+			q->pitx[s] = q->pitx[sBC];
+			q->pity[s] = q->pity[sBC];
+			q->pitn[s] = q->pitn[sBC];
+			q->pixx[s] = q->pixx[sBC];
+			q->pixy[s] = q->pixy[sBC];
+			q->pixn[s] = q->pixn[sBC];
+			q->piyy[s] = q->piyy[sBC];
+			q->piyn[s] = q->piyn[sBC];
+			q->pinn[s] = q->pinn[sBC];
+		}
+		// set \Pi ghost cells if evolved
+	if (EVOLVE_PI(MODE)) {
+			q->Pi[s] = q->Pi[sBC];
+	}
 }
 
+template <int MODE>
 __global__
 void setGhostCellsKernelI(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
 FLUID_VELOCITY * const __restrict__ u
 ) {
 	unsigned int id = blockDim.x * blockIdx.x + threadIdx.x;
-	if (id < d_ny*d_nz) {
+	if (id < d_ny*d_nz*d_ensembleSize) {
 		unsigned int j = (id % d_ny) + N_GHOST_CELLS_M;
-		unsigned int k = id / d_ny + N_GHOST_CELLS_M;
+		unsigned int k = (id / d_ny) % d_nz + N_GHOST_CELLS_M;
+		// every event of an ensemble has its own x faces
+		unsigned int ncx = d_ncx / d_ensembleSize;
+		unsigned int i0 = id / (d_ny*d_nz) * ncx;
 
-		int iBC = 2;
+		int iBC = i0 + 2;
 #pragma unroll 2
-		for (int i = 0; i <= 1; ++i) {
+		for (int i = i0; i <= i0 + 1; ++i) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(iBC, j, k, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
 		}
-		iBC = d_nx + 1;
+		iBC = i0 + ncx - 3;
 #pragma unroll 2
-		for (int i = d_nx + 2; i <= d_nx + 3; ++i) {
+		for (int i = i0 + ncx - 2; i <= i0 + ncx - 1; ++i) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(iBC, j, k, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
 		}
 	}
 }
 
+template <int MODE>
 __global__
 void setGhostCellsKernelJ(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
@@ -104,18 +112,19 @@ FLUID_VELOCITY * const __restrict__ u
 		for (int j = 0; j <= 1; ++j) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(i, jBC, k, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
 		}
 		jBC = d_ny + 1;
 #pragma unroll 2
 		for (int j = d_ny + 2; j <= d_ny + 3; ++j) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(i, jBC, k, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
 		}
 	}
 }
 
+template <int MODE>
 __global__
 void setGhostCellsKernelK(CONSERVED_VARIABLES * const __restrict__ q,
 PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
@@ -131,15 +140,77 @@ FLUID_VELOCITY * const __restrict__ u
 		for (int k = 0; k <= 1; ++k) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(i, j, kBC, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
 		}
 		kBC = d_nz + 1;
 #pragma unroll 2
 		for (int k = d_nz + 2; k <= d_nz + 3; ++k) {
 			unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
 			unsigned int sBC = columnMajorLinearIndex(i, j, kBC, d_ncx, d_ncy);
-			setGhostCellVars(q,e,p,u,s,sBC);
+			setGhostCellVars<MODE>(q,e,p,u,s,sBC);
+		}
+	}
+}
+
+
+template <int MODE>
+void setGhostCellsHost(CONSERVED_VARIABLES * const __restrict__ q,
+PRECISION * const __restrict__ e, PRECISION * const __restrict__ p,
+FLUID_VELOCITY * const __restrict__ u
+) {
+	// I faces, of every event of an ensemble
+	int ncx = h_ncx / h_ensembleSize;
+#pragma omp parallel for collapse(3)
+	for (int n = 0; n < h_ensembleSize; ++n) {
+		for (int k = N_GHOST_CELLS_M; k < h_nz + N_GHOST_CELLS_M; ++k) {
+			for (int j = N_GHOST_CELLS_M; j < h_ny + N_GHOST_CELLS_M; ++j) {
+				int i0 = n * ncx;
+				for (int i = i0; i <= i0 + 1; ++i)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i0 + 2, j, k, h_ncx, h_ncy));
+				for (int i = i0 + ncx - 2; i <= i0 + ncx - 1; ++i)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i0 + ncx - 3, j, k, h_ncx, h_ncy));
+			}
+		}
+	}
+	// J and K faces, unless the direction is trivial
+	if (EVOLVE_Y(latticeDimensions)) {
+#pragma omp parallel for collapse(2)
+		for (int k = N_GHOST_CELLS_M; k < h_nz + N_GHOST_CELLS_M; ++k) {
+			for (int i = N_GHOST_CELLS_M; i < h_nx + N_GHOST_CELLS_M; ++i) {
+				for (int j = 0; j <= 1; ++j)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i, 2, k, h_ncx, h_ncy));
+				for (int j = h_ny + 2; j <= h_ny + 3; ++j)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i, h_ny + 1, k, h_ncx, h_ncy));
+			}
+		}
+	}
+	if (EVOLVE_Z(latticeDimensions)) {
+#pragma omp parallel for collapse(2)
+		for (int j = N_GHOST_CELLS_M; j < h_ny + N_GHOST_CELLS_M; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_nx + N_GHOST_CELLS_M; ++i) {
+				for (int k = 0; k <= 1; ++k)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i, j, 2, h_ncx, h_ncy));
+				for (int k = h_nz + 2; k <= h_nz + 3; ++k)
+					setGhostCellVars<MODE>(q,e,p,u,columnMajorLinearIndex(i, j, k, h_ncx, h_ncy),columnMajorLinearIndex(i, j, h_nz + 1, h_ncx, h_ncy));
+			}
 		}
 	}
 }
 
+#define INSTANTIATE_GHOST_CELLS(MODE) \
+template void setGhostCells<MODE>(CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		FLUID_VELOCITY * const __restrict__ u); \
+template __global__ void setGhostCellsKernelI<MODE>(CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		FLUID_VELOCITY * const __restrict__ u); \
+template __global__ void setGhostCellsKernelJ<MODE>(CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		FLUID_VELOCITY * const __restrict__ u); \
+template __global__ void setGhostCellsKernelK<MODE>(CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		FLUID_VELOCITY * const __restrict__ u); \
+template void setGhostCellsHost<MODE>(CONSERVED_VARIABLES * const __restrict__ q, \
+		PRECISION * const __restrict__ e, PRECISION * const __restrict__ p, \
+		FLUID_VELOCITY * const __restrict__ u);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_GHOST_CELLS)
@@ -0,0 +1,264 @@
+/*
+ * HaloExchange.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+#include "edu/osu/rhic/trunk/hydro/HaloExchange.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/lattice/DomainDecomposition.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+#define MAX_EXCHANGED_VARIABLES (6 + NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO))
+
+// transfer buffers of the planes sent to and received from either neighbour
+static PRECISION *sendBuffer[2], *receiveBuffer[2];
+static size_t haloBufferBytes = 0;
+static bool haloBuffersOnHost;
+
+// arrays of the transfer in progress
+static PRECISION *exchangedVariables[MAX_EXCHANGED_VARIABLES];
+static int numExchangedVariables;
+#ifdef USE_MPI
+static MPI_Request requests[4];
+static int numRequests = 0;
+
+// Contiguous type of one x-y plane of an array: the messages are counted in planes, which fits an int where their
+// bytes would not on large transverse lattices in double precision
+static MPI_Datatype planeType;
+static size_t planeTypeBytes = 0;
+
+static MPI_Datatype getPlaneType(size_t plane) {
+	size_t bytes = plane * sizeof(PRECISION);
+	if (bytes != planeTypeBytes) {
+		if (bytes > INT_MAX) {
+			fprintf(stderr, "An x-y plane of %zu bytes is too large for an MPI message. Exiting ...\n", bytes);
+			exit(-1);
+		}
+		// messages in progress keep a freed type until they complete
+		if (planeTypeBytes > 0) MPI_Type_free(&planeType);
+		MPI_Type_contiguous((int) bytes, MPI_BYTE, &planeType);
+		MPI_Type_commit(&planeType);
+		planeTypeBytes = bytes;
+	}
+	return planeType;
+}
+#endif
+
+// Arrays exchanged between the slabs in the order they are packed
+static int getExchangedVariables(int mode, const CONSERVED_VARIABLES *q, const PRECISION *e, const PRECISION *p,
+		const FLUID_VELOCITY *u, PRECISION **arrays) {
+	int n = 0;
+	arrays[n++] = (PRECISION *) e;
+	arrays[n++] = (PRECISION *) p;
+	arrays[n++] = u->ut;
+	arrays[n++] = u->ux;
+	arrays[n++] = u->uy;
+	arrays[n++] = u->un;
+	arrays[n++] = q->ttt;
+	arrays[n++] = q->ttx;
+	arrays[n++] = q->tty;
+	arrays[n++] = q->ttn;
+	if (EVOLVE_PIMUNU(mode)) {
+		arrays[n++] = q->pitt;
+		arrays[n++] = q->pitx;
+		arrays[n++] = q->pity;
+		arrays[n++] = q->pitn;
+		arrays[n++] = q->pixx;
+		arrays[n++] = q->pixy;
+		arrays[n++] = q->pixn;
+		arrays[n++] = q->piyy;
+		arrays[n++] = q->piyn;
+		arrays[n++] = q->pinn;
+	}
+	if (EVOLVE_PI(mode)) {
+		arrays[n++] = q->Pi;
+	}
+	return n;
+}
+
+// the planes of each array are contiguous in column-major order and packed one array after the other
+static void packPlanes(PRECISION * const * const arrays, int numArrays, int side, PRECISION * const buffer, bool host) {
+	size_t plane = (size_t) h_ncx * h_ncy;
+	size_t planes = N_GHOST_CELLS_M * plane;
+	const int firstSentPlane[2] = { N_GHOST_CELLS_M, h_nz };
+	for (int n = 0; n < numArrays; ++n) {
+		const PRECISION *sent = arrays[n] + firstSentPlane[side] * plane;
+		if (host) memcpy(buffer + n * planes, sent, planes * sizeof(PRECISION));
+		else cudaMemcpyAsync(buffer + n * planes, sent, planes * sizeof(PRECISION), cudaMemcpyDeviceToHost, 0);
+	}
+}
+
+static void unpackPlanes(PRECISION * const * const arrays, int numArrays, int side, const PRECISION * const buffer, bool host) {
+	size_t plane = (size_t) h_ncx * h_ncy;
+	size_t planes = N_GHOST_CELLS_M * plane;
+	const int firstReceivedPlane[2] = { 0, h_nz + N_GHOST_CELLS_M };
+	for (int n = 0; n < numArrays; ++n) {
+		PRECISION *received = arrays[n] + firstReceivedPlane[side] * plane;
+		if (host) memcpy(received, buffer + n * planes, planes * sizeof(PRECISION));
+		// after the ghost cell kernels, which are on blocking streams
+		else cudaMemcpyAsync(received, buffer + n * planes, planes * sizeof(PRECISION), cudaMemcpyHostToDevice, 0);
+	}
+}
+
+size_t getHaloBufferBytes(int mode) {
+	return (6 + NUMBER_CONSERVED_VARIABLES(mode)) * N_GHOST_CELLS_M * (size_t) h_ncx * h_ncy * sizeof(PRECISION);
+}
+
+template <int MODE>
+void packHaloPlanes(const CONSERVED_VARIABLES * const q, const PRECISION * const e, const PRECISION * const p,
+		const FLUID_VELOCITY * const u, int side, PRECISION * const buffer) {
+	PRECISION *arrays[MAX_EXCHANGED_VARIABLES];
+	int numArrays = getExchangedVariables(MODE, q, e, p, u, arrays);
+	packPlanes(arrays, numArrays, side, buffer, true);
+}
+
+template <int MODE>
+void unpackHaloPlanes(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u,
+		int side, const PRECISION * const buffer) {
+	PRECISION *arrays[MAX_EXCHANGED_VARIABLES];
+	int numArrays = getExchangedVariables(MODE, q, e, p, u, arrays);
+	unpackPlanes(arrays, numArrays, side, buffer, true);
+}
+
+void allocateHaloExchangeMemory(bool host) {
+	if (domain.numRanks == 1) return;
+	haloBuffersOnHost = host;
+	haloBufferBytes = getHaloBufferBytes(physicsMode);
+	for (int side = LOWER_NEIGHBOUR; side <= UPPER_NEIGHBOUR; ++side) {
+		if (host) {
+			sendBuffer[side] = (PRECISION *) malloc(haloBufferBytes);
+			receiveBuffer[side] = (PRECISION *) malloc(haloBufferBytes);
+		}
+		else {
+			cudaMallocHost((void **) &sendBuffer[side], haloBufferBytes);
+			cudaMallocHost((void **) &receiveBuffer[side], haloBufferBytes);
+		}
+	}
+}
+
+void freeHaloExchangeMemory() {
+	if (haloBufferBytes == 0) return;
+	for (int side = LOWER_NEIGHBOUR; side <= UPPER_NEIGHBOUR; ++side) {
+		if (haloBuffersOnHost) {
+			free(sendBuffer[side]);
+			free(receiveBuffer[side]);
+		}
+		else {
+			cudaFreeHost(sendBuffer[side]);
+			cudaFreeHost(receiveBuffer[side]);
+		}
+	}
+	haloBufferBytes = 0;
+}
+
+bool isHaloExchangeEnabled() {
+	return haloBufferBytes > 0;
+}
+
+template <int MODE>
+void beginHaloExchange(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u, bool host) {
+#ifdef USE_MPI
+	CONSERVED_VARIABLES arrays;
+	FLUID_VELOCITY velocity;
+	const CONSERVED_VARIABLES *qArrays = q;
+	const FLUID_VELOCITY *uArrays = u;
+	if (!host) {
+		// the structs in device memory hold the device pointers of the arrays
+		cudaMemcpy(&arrays, q, sizeof(CONSERVED_VARIABLES), cudaMemcpyDeviceToHost);
+		cudaMemcpy(&velocity, u, sizeof(FLUID_VELOCITY), cudaMemcpyDeviceToHost);
+		qArrays = &arrays;
+		uArrays = &velocity;
+	}
+	numExchangedVariables = getExchangedVariables(MODE, qArrays, e, p, uArrays, exchangedVariables);
+
+	const int neighbour[2] = { domain.lowerRank, domain.upperRank };
+	for (int side = LOWER_NEIGHBOUR; side <= UPPER_NEIGHBOUR; ++side)
+		if (neighbour[side] >= 0) packPlanes(exchangedVariables, numExchangedVariables, side, sendBuffer[side], host);
+	if (!host) cudaStreamSynchronize(0);
+
+	// messages are tagged with the side of the sender they leave from
+	MPI_Datatype type = getPlaneType((size_t) h_ncx * h_ncy);
+	int count = numExchangedVariables * N_GHOST_CELLS_M;
+	numRequests = 0;
+	for (int side = LOWER_NEIGHBOUR; side <= UPPER_NEIGHBOUR; ++side) {
+		if (neighbour[side] < 0) continue;
+		MPI_Irecv(receiveBuffer[side], count, type, neighbour[side], UPPER_NEIGHBOUR - side, MPI_COMM_WORLD, &requests[numRequests++]);
+		MPI_Isend(sendBuffer[side], count, type, neighbour[side], side, MPI_COMM_WORLD, &requests[numRequests++]);
+	}
+#endif
+}
+
+void endHaloExchange(bool host) {
+#ifdef USE_MPI
+	MPI_Waitall(numRequests, requests, MPI_STATUSES_IGNORE);
+
+	const int neighbour[2] = { domain.lowerRank, domain.upperRank };
+	for (int side = LOWER_NEIGHBOUR; side <= UPPER_NEIGHBOUR; ++side)
+		if (neighbour[side] >= 0) unpackPlanes(exchangedVariables, numExchangedVariables, side, receiveBuffer[side], host);
+#endif
+}
+
+template <int MODE>
+void exchangeHalos(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, FLUID_VELOCITY * const u, bool host) {
+	if (!isHaloExchangeEnabled()) return;
+	beginHaloExchange<MODE>(q, e, p, u, host);
+	endHaloExchange(host);
+}
+
+void scatterHostVariables(void * latticeParams, const CONSERVED_VARIABLES * const wholeQ, const PRECISION * const wholeE,
+		const PRECISION * const wholeP, const FLUID_VELOCITY * const wholeU) {
+#ifdef USE_MPI
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	int nz = lattice->numLatticePointsRapidity;
+	size_t plane = (size_t) lattice->numComputationalLatticePointsX * lattice->numComputationalLatticePointsY;
+
+	MPI_Datatype type = getPlaneType(plane);
+
+	PRECISION *slabVariables[MAX_EXCHANGED_VARIABLES];
+	int numVariables = getExchangedVariables(physicsMode, q, e, p, u, slabVariables);
+	if (!isRootRank()) {
+		int first, count;
+		getRapiditySlab(nz, domain.numRanks, domain.rank, &first, &count);
+		for (int n = 0; n < numVariables; ++n)
+			MPI_Recv(slabVariables[n], count + N_GHOST_CELLS, type, 0, n, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+		return;
+	}
+
+	PRECISION *wholeVariables[MAX_EXCHANGED_VARIABLES];
+	getExchangedVariables(physicsMode, wholeQ, wholeE, wholeP, wholeU, wholeVariables);
+	for (int r = 0; r < domain.numRanks; ++r) {
+		int first, count;
+		getRapiditySlab(nz, domain.numRanks, r, &first, &count);
+		// planes first to first + count + N_GHOST_CELLS - 1 of the whole lattice, ghost cells counted
+		for (int n = 0; n < numVariables; ++n) {
+			const PRECISION *slab = wholeVariables[n] + first * plane;
+			if (r == 0) memcpy(slabVariables[n], slab, (count + N_GHOST_CELLS) * plane * sizeof(PRECISION));
+			else MPI_Send((void *) slab, count + N_GHOST_CELLS, type, r, n, MPI_COMM_WORLD);
+		}
+	}
+#endif
+}
+
+#define INSTANTIATE_HALO_EXCHANGE(MODE) \
+template void beginHaloExchange<MODE>(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, \
+		FLUID_VELOCITY * const u, bool host); \
+template void exchangeHalos<MODE>(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, \
+		FLUID_VELOCITY * const u, bool host); \
+template void packHaloPlanes<MODE>(const CONSERVED_VARIABLES * const q, const PRECISION * const e, const PRECISION * const p, \
+		const FLUID_VELOCITY * const u, int side, PRECISION * const buffer); \
+template void unpackHaloPlanes<MODE>(CONSERVED_VARIABLES * const q, PRECISION * const e, PRECISION * const p, \
+		FLUID_VELOCITY * const u, int side, const PRECISION * const buffer);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_HALO_EXCHANGE)
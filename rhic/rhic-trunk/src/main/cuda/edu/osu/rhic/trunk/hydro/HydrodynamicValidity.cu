@@ -5,6 +5,8 @@
  *      Author: bazow
  */
 
+#include <math.h>
+
 #include <cuda.h>
 #include <cuda_runtime.h>
 
@@ -15,124 +17,125 @@
 #include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
 #include "edu/osu/rhic/trunk/hydro/TransportCoefficients.cuh"
 
-__global__
-void checkValidityKernel(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+template <int MODE, int DIMS>
+__host__ __device__
+void checkValidityCell(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
-		const FLUID_VELOCITY * const __restrict__ up) {
-	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
-	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
-	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
+		const FLUID_VELOCITY * const __restrict__ up, int s) {
+	PRECISION e_s = e[s];
+	PRECISION p_s = p[s];
 
-	if ((i < d_ncx - 2) && (j < d_ncy - 2) && (k < d_ncz - 2)) {
-		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+	PRECISION *utvec = u->ut;
+	PRECISION *uxvec = u->ux;
+	PRECISION *uyvec = u->uy;
+	PRECISION *unvec = u->un;
 
-		PRECISION e_s = e[s];
-		PRECISION p_s = p[s];
-
-		PRECISION *utvec = u->ut;
-		PRECISION *uxvec = u->ux;
-		PRECISION *uyvec = u->uy;
-		PRECISION *unvec = u->un;
-
-		PRECISION ut = utvec[s];
-		PRECISION ux = uxvec[s];
-		PRECISION uy = uyvec[s];
-		PRECISION un = unvec[s];
-
-		PRECISION utp = up->ut[s];
-		PRECISION uxp = up->ux[s];
-		PRECISION uyp = up->uy[s];
-		PRECISION unp = up->un[s];
-
-		//=========================================================
-		// spatial derivatives of primary variables
-		//=========================================================
-		PRECISION facX = 1 / d_dx / 2;
-		PRECISION facY = 1 / d_dy / 2;
-		PRECISION facZ = 1 / d_dz / 2;
-		// dx of u^{\mu} components
-		PRECISION dxut = (*(utvec + s + 1) - *(utvec + s - 1)) * facX;
-		PRECISION dxux = (*(uxvec + s + 1) - *(uxvec + s - 1)) * facX;
-		PRECISION dxuy = (*(uyvec + s + 1) - *(uyvec + s - 1)) * facX;
-		PRECISION dxun = (*(unvec + s + 1) - *(unvec + s - 1)) * facX;
+	PRECISION ut = utvec[s];
+	PRECISION ux = uxvec[s];
+	PRECISION uy = uyvec[s];
+	PRECISION un = unvec[s];
+
+	PRECISION utp = up->ut[s];
+	PRECISION uxp = up->ux[s];
+	PRECISION uyp = up->uy[s];
+	PRECISION unp = up->un[s];
+
+	//=========================================================
+	// spatial derivatives of primary variables
+	//=========================================================
+	PRECISION facX = 1 / CONST_PARAM(dx) / 2;
+	PRECISION facY = 1 / CONST_PARAM(dy) / 2;
+	PRECISION facZ = 1 / CONST_PARAM(dz) / 2;
+	// dx of u^{\mu} components
+	PRECISION dxut = (*(utvec + s + 1) - *(utvec + s - 1)) * facX;
+	PRECISION dxux = (*(uxvec + s + 1) - *(uxvec + s - 1)) * facX;
+	PRECISION dxuy = (*(uyvec + s + 1) - *(uyvec + s - 1)) * facX;
+	PRECISION dxun = (*(unvec + s + 1) - *(unvec + s - 1)) * facX;
+	// the derivatives along trivial directions vanish, their ghost cells are not set
+	PRECISION dyut = 0, dyux = 0, dyuy = 0, dyun = 0;
+	PRECISION dnut = 0, dnux = 0, dnuy = 0, dnun = 0;
+	if (EVOLVE_Y(DIMS)) {
 		// dy of u^{\mu} components
-		PRECISION dyut = (*(utvec + s + d_ncx) - *(utvec + s - d_ncx)) * facY;
-		PRECISION dyux = (*(uxvec + s + d_ncx) - *(uxvec + s - d_ncx)) * facY;
-		PRECISION dyuy = (*(uyvec + s + d_ncx) - *(uyvec + s - d_ncx)) * facY;
-		PRECISION dyun = (*(unvec + s + d_ncx) - *(unvec + s - d_ncx)) * facY;
+		dyut = (*(utvec + s + CONST_PARAM(ncx)) - *(utvec + s - CONST_PARAM(ncx))) * facY;
+		dyux = (*(uxvec + s + CONST_PARAM(ncx)) - *(uxvec + s - CONST_PARAM(ncx))) * facY;
+		dyuy = (*(uyvec + s + CONST_PARAM(ncx)) - *(uyvec + s - CONST_PARAM(ncx))) * facY;
+		dyun = (*(unvec + s + CONST_PARAM(ncx)) - *(unvec + s - CONST_PARAM(ncx))) * facY;
+	}
+	if (EVOLVE_Z(DIMS)) {
 		// dn of u^{\mu} components
-		int stride = d_ncx * d_ncy;
-		PRECISION dnut = (*(utvec + s + stride) - *(utvec + s - stride)) * facZ;
-		PRECISION dnux = (*(uxvec + s + stride) - *(uxvec + s - stride)) * facZ;
-		PRECISION dnuy = (*(uyvec + s + stride) - *(uyvec + s - stride)) * facZ;
-		PRECISION dnun = (*(unvec + s + stride) - *(unvec + s - stride)) * facZ;
-
-		PRECISION ut2 = ut * ut;
-		PRECISION un2 = un * un;
-		PRECISION t2 = t * t;
-		PRECISION t3 = t * t2;
-
-		// transport coefficients
-		PRECISION T = effectiveTemperature(e_s);
-
-		PRECISION cs2 = speedOfSoundSquared(e_s);
-		PRECISION a = 0.333333f - cs2;
-		PRECISION a2 = a * a;
-		PRECISION lambda_Pipi = 1.6f * a;
-		PRECISION zetabar = bulkViscosityToEntropyDensity(T);
-		PRECISION tauPiInv = 15 * a2 * fdividef(T, zetabar);
-
-		// time derivatives of u
-		PRECISION dtut = (ut - utp) / d_dt;
-		PRECISION dtux = (ux - uxp) / d_dt;
-		PRECISION dtuy = (uy - uyp) / d_dt;
-		PRECISION dtun = (un - unp) / d_dt;
-
-		// Covariant derivatives
-		PRECISION Dut = ut * dtut + ux * dxut + uy * dyut + un * dnut + t * un * un;
-		PRECISION dut = Dut - t * un * un;
-		PRECISION dux = ut * dtux + ux * dxux + uy * dyux + un * dnux;
-		PRECISION duy = ut * dtuy + ux * dxuy + uy * dyuy + un * dnuy;
-		PRECISION dun = ut * dtun + ux * dxun + uy * dyun + un * dnun;
-		PRECISION Dun = -t2 * dun - 2 * t * ut * un;
-
-		// expansion rate
-		PRECISION theta = ut / t + dtut + dxux + dyuy + dnun;
-
-		// Velocity shear stress tensor
-		PRECISION theta3 = theta / 3;
-		PRECISION stt = -t * ut * un2 + (dtut - ut * dut) + (ut2 - 1) * theta3;
-		PRECISION stx = -(t * un2 * ux) / 2 + (dtux - dxut) / 2 - (ux * dut + ut * dux) / 2 + ut * ux * theta3;
-		PRECISION sty = -(t * un2 * uy) / 2 + (dtuy - dyut) / 2 - (uy * dut + ut * duy) / 2 + ut * uy * theta3;
-		PRECISION stn = -un * (2 * ut2 + t2 * un2) / (2 * t) + (dtun - dnut / t2) / 2 - (un * dut + ut * dun) / 2 + ut * un * theta3;
-		PRECISION sxx = -(dxux + ux * dux) + (1 + ux * ux) * theta3;
-		PRECISION sxy = -(dxuy + dyux) / 2 - (uy * dux + ux * duy) / 2 + ux * uy * theta3;
-		PRECISION sxn = -ut * ux * un / t - (dxun + dnux / t2) / 2 - (un * dux + ux * dun) / 2 + ux * un * theta3;
-		PRECISION syy = -(dyuy + uy * duy) + (1 + uy * uy) * theta3;
-		PRECISION syn = -ut * uy * un / t - (dyun + dnuy / t2) / 2 - (un * duy + uy * dun) / 2 + uy * un * theta3;
-		PRECISION snn = -ut * (1 + 2 * t2 * un2) / t3 - dnun / t2 - un * dun + (1 / t2 + un2) * theta3;
-
-		// Vorticity tensor
-		PRECISION wtx = (dtux + dxut) / 2 + (ux * dut - ut * dux) / 2 + t * un2 * ux / 2;
-		PRECISION wty = (dtuy + dyut) / 2 + (uy * dut - ut * duy) / 2 + t * un2 * uy / 2;
-		PRECISION wtn = (t2 * dtun + 2 * t * un + dnut) / 2 + (t2 * un * dut - ut * Dun) + t3 * un * un2 / 2;
-		PRECISION wxy = (dyux - dxuy) / 2 + (uy * dux - ux * duy) / 2;
-		PRECISION wxn = (dnux - t2 * dxun) / 2 + (t2 * un * dux - ux * Dun) / 2;
-		PRECISION wyn = (dnuy - t2 * dyun) / 2 + (t2 * un * duy - uy * Dun) / 2;
-		// anti-symmetric vorticity components
-		PRECISION wxt = wtx;
-		PRECISION wyt = wty;
-		PRECISION wnt = wtn / t2;
-		PRECISION wyx = -wxy;
-		PRECISION wnx = -wxn / t2;
-		PRECISION wny = -wyn / t2;
-
-		PRECISION Pi = 0;
-#ifdef PI
+		int stride = CONST_PARAM(ncx) * CONST_PARAM(ncy);
+		dnut = (*(utvec + s + stride) - *(utvec + s - stride)) * facZ;
+		dnux = (*(uxvec + s + stride) - *(uxvec + s - stride)) * facZ;
+		dnuy = (*(uyvec + s + stride) - *(uyvec + s - stride)) * facZ;
+		dnun = (*(unvec + s + stride) - *(unvec + s - stride)) * facZ;
+	}
+
+	PRECISION ut2 = ut * ut;
+	PRECISION un2 = un * un;
+	PRECISION t2 = t * t;
+	PRECISION t3 = t * t2;
+
+	// transport coefficients
+	PRECISION T = effectiveTemperature(e_s);
+
+	PRECISION cs2 = speedOfSoundSquared(e_s);
+	PRECISION a = 0.333333f - cs2;
+	PRECISION a2 = a * a;
+	PRECISION lambda_Pipi = 1.6f * a;
+	PRECISION zetabar = bulkViscosityToEntropyDensity(T);
+	PRECISION tauPiInv = 15 * a2 * (T / zetabar);
+
+	// time derivatives of u
+	PRECISION dtut = (ut - utp) / CONST_PARAM(dtp);
+	PRECISION dtux = (ux - uxp) / CONST_PARAM(dtp);
+	PRECISION dtuy = (uy - uyp) / CONST_PARAM(dtp);
+	PRECISION dtun = (un - unp) / CONST_PARAM(dtp);
+
+	// Covariant derivatives
+	PRECISION Dut = ut * dtut + ux * dxut + uy * dyut + un * dnut + t * un * un;
+	PRECISION dut = Dut - t * un * un;
+	PRECISION dux = ut * dtux + ux * dxux + uy * dyux + un * dnux;
+	PRECISION duy = ut * dtuy + ux * dxuy + uy * dyuy + un * dnuy;
+	PRECISION dun = ut * dtun + ux * dxun + uy * dyun + un * dnun;
+	PRECISION Dun = -t2 * dun - 2 * t * ut * un;
+
+	// expansion rate
+	PRECISION theta = ut / t + dtut + dxux + dyuy + dnun;
+
+	// Velocity shear stress tensor
+	PRECISION theta3 = theta / 3;
+	PRECISION stt = -t * ut * un2 + (dtut - ut * dut) + (ut2 - 1) * theta3;
+	PRECISION stx = -(t * un2 * ux) / 2 + (dtux - dxut) / 2 - (ux * dut + ut * dux) / 2 + ut * ux * theta3;
+	PRECISION sty = -(t * un2 * uy) / 2 + (dtuy - dyut) / 2 - (uy * dut + ut * duy) / 2 + ut * uy * theta3;
+	PRECISION stn = -un * (2 * ut2 + t2 * un2) / (2 * t) + (dtun - dnut / t2) / 2 - (un * dut + ut * dun) / 2 + ut * un * theta3;
+	PRECISION sxx = -(dxux + ux * dux) + (1 + ux * ux) * theta3;
+	PRECISION sxy = -(dxuy + dyux) / 2 - (uy * dux + ux * duy) / 2 + ux * uy * theta3;
+	PRECISION sxn = -ut * ux * un / t - (dxun + dnux / t2) / 2 - (un * dux + ux * dun) / 2 + ux * un * theta3;
+	PRECISION syy = -(dyuy + uy * duy) + (1 + uy * uy) * theta3;
+	PRECISION syn = -ut * uy * un / t - (dyun + dnuy / t2) / 2 - (un * duy + uy * dun) / 2 + uy * un * theta3;
+	PRECISION snn = -ut * (1 + 2 * t2 * un2) / t3 - dnun / t2 - un * dun + (1 / t2 + un2) * theta3;
+
+	// Vorticity tensor
+	PRECISION wtx = (dtux + dxut) / 2 + (ux * dut - ut * dux) / 2 + t * un2 * ux / 2;
+	PRECISION wty = (dtuy + dyut) / 2 + (uy * dut - ut * duy) / 2 + t * un2 * uy / 2;
+	PRECISION wtn = (t2 * dtun + 2 * t * un + dnut) / 2 + (t2 * un * dut - ut * Dun) + t3 * un * un2 / 2;
+	PRECISION wxy = (dyux - dxuy) / 2 + (uy * dux - ux * duy) / 2;
+	PRECISION wxn = (dnux - t2 * dxun) / 2 + (t2 * un * dux - ux * Dun) / 2;
+	PRECISION wyn = (dnuy - t2 * dyun) / 2 + (t2 * un * duy - uy * Dun) / 2;
+	// anti-symmetric vorticity components
+	PRECISION wxt = wtx;
+	PRECISION wyt = wty;
+	PRECISION wnt = wtn / t2;
+	PRECISION wyx = -wxy;
+	PRECISION wnx = -wxn / t2;
+	PRECISION wny = -wyn / t2;
+
+	PRECISION Pi = 0;
+	if (EVOLVE_PI(MODE)) {
 		Pi = currrentVars->Pi[s];
-#endif
+	}
 
-#ifdef PIMUNU
+	if (EVOLVE_PIMUNU(MODE)) {
 		PRECISION pitt = currrentVars->pitt[s];
 		PRECISION pitx = currrentVars->pitx[s];
 		PRECISION pity = currrentVars->pity[s];
@@ -211,26 +214,93 @@ void checkValidityKernel(PRECISION t, const VALIDITY_DOMAIN * const __restrict__
 		PRECISION JJ = Jtt * Jtt - 2 * Jtx * Jtx - 2 * Jty * Jty + Jxx * Jxx + 2 * Jxy * Jxy + Jyy * Jyy - 2 * Jtn * Jtn * t2 + 2 * Jxn * Jxn * t2
 				+ 2 * Jyn * Jyn * t2 + Jnn * Jnn * t2 * t2;
 
-		v->inverseReynoldsNumberPimunu[s] = sqrtf(fabsf(pipi)) / p_s;
-		v->inverseReynoldsNumberTilde2Pimunu[s] = T / 2 / d_etabar / (e_s + p_s) * sqrtf(fabsf(JJ / ss));
-		v->inverseReynoldsNumberPi[s] = fabsf(Pi) / p_s;
-		v->inverseReynoldsNumberTilde2Pi[s] = fabsf(J / zetabar / theta) * T / (e_s + p_s);
-		v->knudsenNumberTaupi[s] = 5 * d_etabar * theta / T;
+		v->inverseReynoldsNumberPimunu[s] = sqrt(fabs(pipi)) / p_s;
+		v->inverseReynoldsNumberTilde2Pimunu[s] = T / 2 / CONST_PARAM(etabar) / (e_s + p_s) * sqrt(fabs(JJ / ss));
+		v->inverseReynoldsNumberPi[s] = fabs(Pi) / p_s;
+		v->inverseReynoldsNumberTilde2Pi[s] = fabs(J / zetabar / theta) * T / (e_s + p_s);
+		v->knudsenNumberTaupi[s] = 5 * CONST_PARAM(etabar) * theta / T;
 		v->knudsenNumberTauPi[s] = theta / tauPiInv;
-#endif
-		//================================================================================================
-		// FOR DEBUGGING PURPOSES
-		//================================================================================================
-		v->taupi[s] = 5*d_etabar/T;
-		v->dxux[s] = dxux;
-		v->dyuy[s] = dyuy;
-		v->theta[s] = theta;
 	}
+	//================================================================================================
+	// FOR DEBUGGING PURPOSES
+	//================================================================================================
+	v->taupi[s] = 5*CONST_PARAM(etabar)/T;
+	v->dxux[s] = dxux;
+	v->dyuy[s] = dyuy;
+	v->theta[s] = theta;
 }
 
+template <int MODE, int DIMS>
+__global__
+void checkValidityKernel(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	int i = blockDim.x * blockIdx.x + threadIdx.x + N_GHOST_CELLS_M;
+	int j = blockDim.y * blockIdx.y + threadIdx.y + N_GHOST_CELLS_M;
+	int k = blockDim.z * blockIdx.z + threadIdx.z + N_GHOST_CELLS_M;
+
+	if ((i < d_ncx - 2) && (j < d_ncy - 2) && (k < d_ncz - 2)) {
+		int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		checkValidityCell<MODE, DIMS>(t, v, currrentVars, e, p, u, up, s);
+	}
+}
+
+template <int MODE>
 void checkValidity(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
 		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
 		const FLUID_VELOCITY * const __restrict__ up) {
-	checkValidityKernel<<<grid, block>>>(t, v, currrentVars, e, p, u, up);
+	switch (latticeDimensions) {
+		case LATTICE_1D:
+			checkValidityKernel<MODE, LATTICE_1D><<<grid, block>>>(t, v, currrentVars, e, p, u, up);
+			return;
+		case LATTICE_2D:
+			checkValidityKernel<MODE, LATTICE_2D><<<grid, block>>>(t, v, currrentVars, e, p, u, up);
+			return;
+		default:
+			checkValidityKernel<MODE, LATTICE_3D><<<grid, block>>>(t, v, currrentVars, e, p, u, up);
+	}
+}
+
+template <int MODE, int DIMS>
+static void checkValidityInterior(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+#pragma omp parallel for collapse(2)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz - 2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy - 2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx - 2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				checkValidityCell<MODE, DIMS>(t, v, currrentVars, e, p, u, up, s);
+			}
+		}
+	}
+}
+
+template <int MODE>
+void checkValidityHost(PRECISION t, const VALIDITY_DOMAIN * const __restrict__ v, const CONSERVED_VARIABLES * const __restrict__ currrentVars,
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const FLUID_VELOCITY * const __restrict__ up) {
+	switch (latticeDimensions) {
+		case LATTICE_1D:
+			checkValidityInterior<MODE, LATTICE_1D>(t, v, currrentVars, e, p, u, up);
+			return;
+		case LATTICE_2D:
+			checkValidityInterior<MODE, LATTICE_2D>(t, v, currrentVars, e, p, u, up);
+			return;
+		default:
+			checkValidityInterior<MODE, LATTICE_3D>(t, v, currrentVars, e, p, u, up);
+	}
 }
 
+#define INSTANTIATE_VALIDITY(MODE) \
+template void checkValidity<MODE>(PRECISION t, \
+		const VALIDITY_DOMAIN * const __restrict__ v, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up); \
+template void checkValidityHost<MODE>(PRECISION t, \
+		const VALIDITY_DOMAIN * const __restrict__ v, \
+		const CONSERVED_VARIABLES * const __restrict__ currrentVars, \
+		const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p, \
+		const FLUID_VELOCITY * const __restrict__ u, const FLUID_VELOCITY * const __restrict__ up);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_VALIDITY)
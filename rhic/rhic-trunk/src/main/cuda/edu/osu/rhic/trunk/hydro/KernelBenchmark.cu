@@ -0,0 +1,243 @@
+/*
+ * KernelBenchmark.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h> // for printf
+#include <string.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/KernelBenchmark.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+#include "edu/osu/rhic/core/muscl/SemiDiscreteKurganovTadmorScheme.cuh"
+#include "edu/osu/rhic/core/muscl/HalfSiteExtrapolation.cuh"
+#include "edu/osu/rhic/core/muscl/FluxLimiter.cuh"
+#include "edu/osu/rhic/trunk/hydro/FluxFunctions.cuh"
+#include "edu/osu/rhic/trunk/hydro/SpectralRadius.cuh"
+#include "edu/osu/rhic/trunk/hydro/SourceTerms.cuh"
+#include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/harness/util/MonotonicClock.h"
+
+#define KERNEL_BENCHMARK_GATHER_X 0
+#define KERNEL_BENCHMARK_GATHER_Y 1
+#define KERNEL_BENCHMARK_GATHER_Z 2
+#define KERNEL_BENCHMARK_APPROXIMATE_DERIVATIVE 3
+#define KERNEL_BENCHMARK_FLUX 4
+#define KERNEL_BENCHMARK_SOURCE_TERMS 5
+#define KERNEL_BENCHMARK_PIMUNU_SOURCE_TERMS 6
+#define KERNEL_BENCHMARK_INFERRED_VARIABLES 7
+#define KERNEL_BENCHMARK_EOS_PRESSURE 8
+#define KERNEL_BENCHMARK_EOS_SPEED_OF_SOUND 9
+#define KERNEL_BENCHMARK_EOS_TEMPERATURE 10
+#define NUMBER_KERNEL_BENCHMARKS 11
+
+static const char * const kernelBenchmarkNames[NUMBER_KERNEL_BENCHMARKS] = {
+	"stencil_gather_x", "stencil_gather_y", "stencil_gather_z", "approximate_derivative", "flux", "load_source_terms",
+	"set_pimunu_source_terms", "inferred_variables", "eos_pressure", "eos_speed_of_sound_squared", "eos_temperature"
+};
+
+// Fastest of the repeats of the body, run for every cell c, in ns per cell
+#define TIME_PER_CELL(time, ...) \
+	for (int r = 0; r < repeats; ++r) { \
+		double start = monotonicTime(); \
+		for (int c = 0; c < numCells; ++c) { __VA_ARGS__ } \
+		double ns = 1.e6 * (monotonicTime() - start) / numCells; \
+		if (r == 0 || ns < time) time = ns; \
+	}
+
+// Arguments of setPimunuSourceTerms besides t
+struct PimunuSourceArguments
+{
+	PRECISION e, p;
+	PRECISION ut, ux, uy, un, utp, uxp, uyp, unp;
+	PRECISION pi[NUMBER_DISSIPATIVE_CURRENTS(SHEAR_BULK_HYDRO)];
+	PRECISION dxut, dyut, dnut, dxux, dyux, dnux, dxuy, dyuy, dnuy, dxun, dyun, dnun, dkvk;
+};
+
+// The conserved variable arrays in the order of the Euler step (ttt, ..., pinn, Pi)
+static void getConservedVariableArrays(const CONSERVED_VARIABLES * const q, const PRECISION ** const vars) {
+	const PRECISION * const all[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)] = {
+		q->ttt, q->ttx, q->tty, q->ttn, q->pitt, q->pitx, q->pity, q->pitn, q->pixx, q->pixy, q->pixn, q->piyy, q->piyn, q->pinn, q->Pi
+	};
+	memcpy(vars, all, sizeof(all));
+}
+
+static void gatherStencils(const PRECISION * const * const vars, int numVars, const int * const cells, int numCells, int stride,
+		PRECISION * const __restrict__ stencils) {
+	for (int c = 0; c < numCells; ++c) {
+		int s = cells[c];
+		PRECISION *I = stencils + 5 * numVars * c;
+		for (int n = 0; n < numVars; ++n) {
+			const PRECISION *v = vars[n];
+			I[5*n] = v[s - 2*stride];
+			I[5*n+1] = v[s - stride];
+			I[5*n+2] = v[s];
+			I[5*n+3] = v[s + stride];
+			I[5*n+4] = v[s + 2*stride];
+		}
+	}
+}
+
+template <int MODE>
+static void setPimunuSourceArguments(const int * const cells, int numCells, struct PimunuSourceArguments * const args) {
+	const PRECISION facX = 1 / h_dx / 2, facY = 1 / h_dy / 2, facZ = 1 / h_dz / 2;
+	const int sy = h_ncx, sz = h_ncx * h_ncy;
+	const PRECISION *vars[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)];
+	getConservedVariableArrays(q, vars);
+	for (int c = 0; c < numCells; ++c) {
+		int s = cells[c];
+		struct PimunuSourceArguments *a = &args[c];
+		a->e = e[s];
+		a->p = p[s];
+		a->ut = u->ut[s];
+		a->ux = u->ux[s];
+		a->uy = u->uy[s];
+		a->un = u->un[s];
+		a->utp = h_up->ut[s];
+		a->uxp = h_up->ux[s];
+		a->uyp = h_up->uy[s];
+		a->unp = h_up->un[s];
+		for (int n = 0; n < NUMBER_DISSIPATIVE_CURRENTS(SHEAR_BULK_HYDRO); ++n)
+			a->pi[n] = n < NUMBER_DISSIPATIVE_CURRENTS(MODE) ? vars[4 + n][s] : 0;
+		a->dxut = (u->ut[s+1] - u->ut[s-1]) * facX;
+		a->dyut = (u->ut[s+sy] - u->ut[s-sy]) * facY;
+		a->dnut = (u->ut[s+sz] - u->ut[s-sz]) * facZ;
+		a->dxux = (u->ux[s+1] - u->ux[s-1]) * facX;
+		a->dyux = (u->ux[s+sy] - u->ux[s-sy]) * facY;
+		a->dnux = (u->ux[s+sz] - u->ux[s-sz]) * facZ;
+		a->dxuy = (u->uy[s+1] - u->uy[s-1]) * facX;
+		a->dyuy = (u->uy[s+sy] - u->uy[s-sy]) * facY;
+		a->dnuy = (u->uy[s+sz] - u->uy[s-sz]) * facZ;
+		a->dxun = (u->un[s+1] - u->un[s-1]) * facX;
+		a->dyun = (u->un[s+sy] - u->un[s-sy]) * facY;
+		a->dnun = (u->un[s+sz] - u->un[s-sz]) * facZ;
+		PRECISION vx = a->ux / a->ut, vy = a->uy / a->ut, vn = a->un / a->ut;
+		a->dkvk = (a->dxux - vx * a->dxut) / a->ut + (a->dyuy - vy * a->dyut) / a->ut + (a->dnun - vn * a->dnut) / a->ut;
+	}
+}
+
+template <int MODE>
+void benchmarkKernels(PRECISION t, int repeats, const char *outputDirectory) {
+	const int numVars = NUMBER_CONSERVED_VARIABLES(MODE);
+	int numCells = h_nx * h_ny * h_nz;
+	int *cells = (int *) malloc(numCells * sizeof(int));
+	for (int c = 0; c < numCells; ++c) {
+		int k = c / (h_nx * h_ny) + N_GHOST_CELLS_M;
+		int j = (c % (h_nx * h_ny)) / h_nx + N_GHOST_CELLS_M;
+		int i = c % h_nx + N_GHOST_CELLS_M;
+		cells[c] = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+	}
+	const PRECISION *vars[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)];
+	getConservedVariableArrays(q, vars);
+
+	double times[NUMBER_KERNEL_BENCHMARKS];
+	for (int b = 0; b < NUMBER_KERNEL_BENCHMARKS; ++b) times[b] = -1;
+	volatile PRECISION sink;
+	PRECISION sum = 0;
+
+	// stencil gathers, x last so that the fluxes read its stencils
+	PRECISION *stencils = (PRECISION *) malloc(5 * numVars * numCells * sizeof(PRECISION));
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_GATHER_Y], gatherStencils(vars, numVars, cells + c, 1, h_ncx, stencils + 5 * numVars * c);)
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_GATHER_Z], gatherStencils(vars, numVars, cells + c, 1, h_ncx * h_ncy, stencils + 5 * numVars * c);)
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_GATHER_X], gatherStencils(vars, numVars, cells + c, 1, 1, stencils + 5 * numVars * c);)
+
+	// the three limited slopes of every variable of a stencil
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_APPROXIMATE_DERIVATIVE],
+		const PRECISION *I = stencils + 5 * numVars * c;
+		for (int n = 0; n < numVars; ++n)
+			sum += approximateDerivative(I[5*n], I[5*n+1], I[5*n+2]) + approximateDerivative(I[5*n+1], I[5*n+2], I[5*n+3])
+				+ approximateDerivative(I[5*n+2], I[5*n+3], I[5*n+4]);
+	)
+
+	// both interfaces of a cell, as in eulerStepXCell
+	PRECISION *H = (PRECISION *) malloc(numVars * numCells * sizeof(PRECISION));
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_FLUX],
+		PRECISION *Hc = H + numVars * c;
+		flux<MODE>(stencils + 5 * numVars * c, Hc, &rightHalfCellExtrapolationForward, &leftHalfCellExtrapolationForward,
+				&spectralRadiusX, &Fx, t, e[cells[c]]);
+		flux<MODE>(stencils + 5 * numVars * c, Hc, &rightHalfCellExtrapolationBackwards, &leftHalfCellExtrapolationBackwards,
+				&spectralRadiusX, &Fx, t, e[cells[c]]);
+	)
+	free(stencils);
+
+	// conserved variables of the cells, as the source terms and the inferred variables take them
+	PRECISION *Q = (PRECISION *) malloc(numVars * numCells * sizeof(PRECISION));
+	for (int c = 0; c < numCells; ++c)
+		for (int n = 0; n < numVars; ++n) Q[numVars * c + n] = vars[n][cells[c]];
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_SOURCE_TERMS],
+		int s = cells[c];
+		loadSourceTerms2<MODE, LATTICE_3D>(Q + numVars * c, H + numVars * c, u, h_up->ut[s], h_up->ux[s], h_up->uy[s], h_up->un[s],
+				t, e[s], p, s);
+	)
+
+	if (EVOLVE_PIMUNU(MODE)) {
+		struct PimunuSourceArguments *args = (struct PimunuSourceArguments *) malloc(numCells * sizeof(struct PimunuSourceArguments));
+		setPimunuSourceArguments<MODE>(cells, numCells, args);
+		PRECISION pimunuRHS[NUMBER_DISSIPATIVE_CURRENTS(SHEAR_BULK_HYDRO)];
+		TIME_PER_CELL(times[KERNEL_BENCHMARK_PIMUNU_SOURCE_TERMS],
+			const struct PimunuSourceArguments *a = &args[c];
+			setPimunuSourceTerms<MODE>(pimunuRHS, t, a->e, a->p, a->ut, a->ux, a->uy, a->un, a->utp, a->uxp, a->uyp, a->unp,
+					a->pi[0], a->pi[1], a->pi[2], a->pi[3], a->pi[4], a->pi[5], a->pi[6], a->pi[7], a->pi[8], a->pi[9], a->pi[10],
+					a->dxut, a->dyut, a->dnut, a->dxux, a->dyux, a->dnux, a->dxuy, a->dyuy, a->dnuy, a->dxun, a->dyun, a->dnun, a->dkvk);
+			sum += pimunuRHS[0];
+		)
+		free(args);
+	}
+
+	// the previous energy density is the initial guess of the solver
+	PRECISION *inferred = (PRECISION *) malloc(6 * numCells * sizeof(PRECISION));
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_INFERRED_VARIABLES],
+		PRECISION *v = inferred + 6 * c;
+		getInferredVariables<MODE>(t, Q + numVars * c, e[cells[c]], v, v + 1, v + 2, v + 3, v + 4, v + 5);
+	)
+	free(Q);
+
+	PRECISION *es = (PRECISION *) malloc(numCells * sizeof(PRECISION));
+	for (int c = 0; c < numCells; ++c) es[c] = e[cells[c]];
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_EOS_PRESSURE], sum += equilibriumPressure(es[c]);)
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_EOS_SPEED_OF_SOUND], sum += speedOfSoundSquared(es[c]);)
+	TIME_PER_CELL(times[KERNEL_BENCHMARK_EOS_TEMPERATURE], sum += effectiveTemperature(es[c]);)
+
+	for (int c = 0; c < numCells; ++c) sum += H[numVars * c] + inferred[6 * c];
+	sink = sum;
+
+	printf("===================================================\n");
+	printf("Host cost per cell [ns] (%d cells, t = %.3f [fm], fastest of %d, one thread)\n", numCells, t, repeats);
+	for (int b = 0; b < NUMBER_KERNEL_BENCHMARKS; ++b)
+		if (times[b] >= 0) printf("\t%-28s%.3f\n", kernelBenchmarkNames[b], times[b]);
+	printf("===================================================\n");
+
+	if (outputDirectory != NULL) {
+		char fname[255];
+		sprintf(fname, "%s/microbenchmarks.json", outputDirectory);
+		FILE *fp = fopen(fname, "w");
+		if (fp == NULL) fprintf(stderr, "Could not open %s, the microbenchmarks are not written.\n", fname);
+		else {
+			fprintf(fp, "{\n  \"precision\": \"%s\",\n  \"physics_mode\": %d,\n  \"cells\": %d,\n  \"repeats\": %d,\n  \"ns_per_cell\": {",
+					sizeof(PRECISION) == sizeof(double) ? "double" : "float", MODE, numCells, repeats);
+			bool first = true;
+			for (int b = 0; b < NUMBER_KERNEL_BENCHMARKS; ++b) {
+				if (times[b] < 0) continue;
+				fprintf(fp, "%s\n    \"%s\": %.6g", first ? "" : ",", kernelBenchmarkNames[b], times[b]);
+				first = false;
+			}
+			fprintf(fp, "\n  }\n}\n");
+			fclose(fp);
+		}
+	}
+	free(es);
+	free(inferred);
+	free(H);
+	free(cells);
+}
+
+#define INSTANTIATE_KERNEL_BENCHMARK(MODE) \
+template void benchmarkKernels<MODE>(PRECISION t, int repeats, const char *outputDirectory);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_KERNEL_BENCHMARK)
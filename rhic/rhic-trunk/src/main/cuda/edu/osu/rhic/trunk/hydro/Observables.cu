@@ -0,0 +1,185 @@
+/*
+ * Observables.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/Observables.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+static int *probeCells = NULL, *d_probeCells = NULL;
+static int numProbeCells = 0;
+// partial reductions of the blocks followed by the probe fields, allocated on first use
+static double *d_observables = NULL;
+static size_t observableBytes = 0;
+
+void setProbeCells(const int * const cells, int numCells, bool cpu) {
+	free(probeCells);
+	if (d_probeCells != NULL) cudaFree(d_probeCells);
+	probeCells = NULL;
+	d_probeCells = NULL;
+	numProbeCells = numCells;
+	if (numCells == 0) return;
+	probeCells = (int *) malloc(numCells * sizeof(int));
+	memcpy(probeCells, cells, numCells * sizeof(int));
+	if (cpu) return;
+	cudaMalloc((void **) &d_probeCells, numCells * sizeof(int));
+	cudaMemcpy(d_probeCells, cells, numCells * sizeof(int), cudaMemcpyHostToDevice);
+}
+
+__host__ __device__
+inline void readProbeCell(const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+		const FLUID_VELOCITY * const __restrict__ u, int s, double * const __restrict__ values) {
+	if (s < 0) {
+		for (int f = 0; f < PROBE_FIELDS; ++f) values[f] = 0;
+		return;
+	}
+	values[0] = e[s];
+	values[1] = p[s];
+	values[2] = u->ux[s];
+	values[3] = u->uy[s];
+	values[4] = u->un[s];
+}
+
+// blockIdx.y is the event, the probe cells are read by the blocks of the first
+__global__
+void observablesKernel(const CONSERVED_VARIABLES * const __restrict__ q, const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		const int * const __restrict__ cells, int numCells, double * const __restrict__ observables) {
+	__shared__ double r[NUM_FLUID_REDUCTIONS][OBSERVABLE_THREADS];
+
+	int eventColumns = d_ncx / gridDim.y;
+	int nx = eventColumns - N_GHOST_CELLS;
+	int i0 = blockIdx.y * eventColumns + N_GHOST_CELLS_M;
+	unsigned int nElements = nx * d_ny * d_nz;
+
+	double eMax = 0, eMin = DBL_MAX, eSum = 0, TSum = 0, tttSum = 0, entropySum = 0;
+	for (unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x; threadID < nElements; threadID += blockDim.x * gridDim.x) {
+		unsigned int k = threadID / (nx * d_ny) + N_GHOST_CELLS_M;
+		unsigned int j = (threadID % (nx * d_ny)) / nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % nx + i0;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		PRECISION es = e[s];
+		PRECISION T = effectiveTemperature(es);
+		eMax = fmax(eMax, (double) es);
+		eMin = fmin(eMin, (double) es);
+		eSum += es;
+		TSum += T;
+		tttSum += q->ttt[s];
+		entropySum += (es + p[s]) / T * u->ut[s];
+	}
+	r[0][threadIdx.x] = eMax;
+	r[1][threadIdx.x] = eMin;
+	r[2][threadIdx.x] = eSum;
+	r[3][threadIdx.x] = TSum;
+	r[4][threadIdx.x] = tttSum;
+	r[5][threadIdx.x] = entropySum;
+	__syncthreads();
+
+	for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+		if (threadIdx.x < stride) {
+			r[0][threadIdx.x] = fmax(r[0][threadIdx.x], r[0][threadIdx.x + stride]);
+			r[1][threadIdx.x] = fmin(r[1][threadIdx.x], r[1][threadIdx.x + stride]);
+			for (int n = 2; n < NUM_FLUID_REDUCTIONS; ++n) r[n][threadIdx.x] += r[n][threadIdx.x + stride];
+		}
+		__syncthreads();
+	}
+	if (threadIdx.x == 0) {
+		double *block = observables + NUM_FLUID_REDUCTIONS * (blockIdx.y * gridDim.x + blockIdx.x);
+		for (int n = 0; n < NUM_FLUID_REDUCTIONS; ++n) block[n] = r[n][0];
+	}
+
+	if (blockIdx.y == 0) {
+		double *values = observables + NUM_FLUID_REDUCTIONS * gridDim.x * gridDim.y;
+		for (int c = blockDim.x * blockIdx.x + threadIdx.x; c < numCells; c += blockDim.x * gridDim.x)
+			readProbeCell(e, p, u, cells[c], values + PROBE_FIELDS * c);
+	}
+}
+
+void computeObservables(const CONSERVED_VARIABLES * const __restrict__ q, const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		struct FluidReductions * const reductions, double * const probeValues) {
+	int numEvents = h_ensembleSize;
+	int numPartials = NUM_FLUID_REDUCTIONS * OBSERVABLE_BLOCKS * numEvents;
+	size_t bytes = (numPartials + PROBE_FIELDS * numProbeCells) * sizeof(double);
+	if (bytes > observableBytes) {
+		if (d_observables != NULL) cudaFree(d_observables);
+		cudaMalloc((void **) &d_observables, bytes);
+		observableBytes = bytes;
+	}
+
+	observablesKernel<<<dim3(OBSERVABLE_BLOCKS, numEvents), OBSERVABLE_THREADS>>>(q, e, p, u, d_probeCells, numProbeCells, d_observables);
+
+	// the remaining reduction over the blocks is done on the host
+	double *observables = (double *) malloc(bytes);
+	cudaMemcpy(observables, d_observables, bytes, cudaMemcpyDeviceToHost);
+	for (int m = 0; m < numEvents; ++m) {
+		struct FluidReductions *r = &reductions[m];
+		r->eMax = 0;
+		r->eMin = DBL_MAX;
+		r->eSum = r->TSum = r->tttSum = r->entropySum = 0;
+		for (int n = 0; n < OBSERVABLE_BLOCKS; ++n) {
+			const double *block = observables + NUM_FLUID_REDUCTIONS * (m * OBSERVABLE_BLOCKS + n);
+			r->eMax = fmax(r->eMax, block[0]);
+			r->eMin = fmin(r->eMin, block[1]);
+			r->eSum += block[2];
+			r->TSum += block[3];
+			r->tttSum += block[4];
+			r->entropySum += block[5];
+		}
+	}
+	memcpy(probeValues, observables + numPartials, PROBE_FIELDS * numProbeCells * sizeof(double));
+	free(observables);
+}
+
+void computeObservablesHost(const CONSERVED_VARIABLES * const __restrict__ q, const PRECISION * const __restrict__ e,
+		const PRECISION * const __restrict__ p, const FLUID_VELOCITY * const __restrict__ u,
+		struct FluidReductions * const reductions, double * const probeValues) {
+	int eventColumns = h_ncx / h_ensembleSize;
+	int nx = eventColumns - N_GHOST_CELLS;
+	for (int m = 0; m < h_ensembleSize; ++m) {
+		int i0 = m * eventColumns + N_GHOST_CELLS_M;
+		double eMax = 0, eMin = DBL_MAX, eSum = 0, TSum = 0, tttSum = 0, entropySum = 0;
+#pragma omp parallel for collapse(2) reduction(max:eMax) reduction(min:eMin) reduction(+:eSum,TSum,tttSum,entropySum)
+		for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+			for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+				for (int i = i0; i < i0 + nx; ++i) {
+					int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+					PRECISION es = e[s];
+					PRECISION T = effectiveTemperature(es);
+					eMax = fmax(eMax, (double) es);
+					eMin = fmin(eMin, (double) es);
+					eSum += es;
+					TSum += T;
+					tttSum += q->ttt[s];
+					entropySum += (es + p[s]) / T * u->ut[s];
+				}
+			}
+		}
+		reductions[m].eMax = eMax;
+		reductions[m].eMin = eMin;
+		reductions[m].eSum = eSum;
+		reductions[m].TSum = TSum;
+		reductions[m].tttSum = tttSum;
+		reductions[m].entropySum = entropySum;
+	}
+	for (int c = 0; c < numProbeCells; ++c) readProbeCell(e, p, u, probeCells[c], probeValues + PROBE_FIELDS * c);
+}
+
+void freeObservablesMemory() {
+	setProbeCells(NULL, 0, true);
+	if (d_observables != NULL) cudaFree(d_observables);
+	d_observables = NULL;
+	observableBytes = 0;
+}
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdio.h> // for printf
+#include <math.h>
 
 #include <cuda.h>
 #include <cuda_runtime.h>
@@ -9,95 +10,122 @@
 #include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
 #include "edu/osu/rhic/trunk/hydro/RegulateDissipativeCurrents.cuh"
 
-#ifndef IDEAL
-__global__ 
-void regulateDissipativeCurrents(PRECISION t, 
+__host__ __device__ 
+void regulateDissipativeCurrentsCell(PRECISION t, 
 CONSERVED_VARIABLES * const __restrict__ currrentVars, 
 const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
 const FLUID_VELOCITY * const __restrict__ u,
-VALIDITY_DOMAIN * const __restrict__ validityDomain
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int s
 ) {
-	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
-	if (threadID < d_nElements) {
-		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
-		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
-		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
-		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
-
-		PRECISION pitt = currrentVars->pitt[s];
-		PRECISION pitx = currrentVars->pitx[s];
-		PRECISION pity = currrentVars->pity[s];
-		PRECISION pitn = currrentVars->pitn[s];
-		PRECISION pixx = currrentVars->pixx[s];
-		PRECISION pixy = currrentVars->pixy[s];
-		PRECISION pixn = currrentVars->pixn[s];
-		PRECISION piyy = currrentVars->piyy[s];
-		PRECISION piyn = currrentVars->piyn[s];
-		PRECISION pinn = currrentVars->pinn[s];
+	PRECISION pitt = currrentVars->pitt[s];
+	PRECISION pitx = currrentVars->pitx[s];
+	PRECISION pity = currrentVars->pity[s];
+	PRECISION pitn = currrentVars->pitn[s];
+	PRECISION pixx = currrentVars->pixx[s];
+	PRECISION pixy = currrentVars->pixy[s];
+	PRECISION pixn = currrentVars->pixn[s];
+	PRECISION piyy = currrentVars->piyy[s];
+	PRECISION piyn = currrentVars->piyn[s];
+	PRECISION pinn = currrentVars->pinn[s];
 #ifdef Pi
-		PRECISION Pi = currrentVars->Pi[s];
+	PRECISION Pi = currrentVars->Pi[s];
 #else
-		PRECISION Pi = 0;
+	PRECISION Pi = 0;
 #endif
 
-		PRECISION ut = u->ut[s];
-		PRECISION ux = u->ux[s];
-		PRECISION uy = u->uy[s];
-		PRECISION un = u->un[s];
+	PRECISION ut = u->ut[s];
+	PRECISION ux = u->ux[s];
+	PRECISION uy = u->uy[s];
+	PRECISION un = u->un[s];
 
-		PRECISION e_s = e[s];
-		PRECISION p_s = p[s];
+	PRECISION e_s = e[s];
+	PRECISION p_s = p[s];
 
-		PRECISION xi0 = 0.1f;
-		PRECISION rhomax = 1.0f;
+	PRECISION xi0 = 0.1f;
+	PRECISION rhomax = 1.0f;
 
 xi0=1.0;
 rhomax=10.0;
 
-		PRECISION t2 = t*t;
+	PRECISION t2 = t*t;
 
-		PRECISION pipi = pitt*pitt-2*pitx*pitx-2*pity*pity+pixx*pixx+2*pixy*pixy+piyy*piyy-2*pitn*pitn*t2+2*pixn*pixn*t2+2*piyn*piyn*t2+pinn*pinn*t2*t2;
-		PRECISION spipi = sqrtf(fabsf(pipi+3*Pi*Pi));
-		PRECISION pimumu = pitt - pixx - piyy - pinn*t*t;
-		PRECISION piu0 = -pitn*t2*un + pitt*ut - pitx*ux - pity*uy;
-		PRECISION piu1 = -pixn*t2*un + pitx*ut - pixx*ux - pixy*uy;
-		PRECISION piu2 = -piyn*t2*un + pity*ut - pixy*ux - piyy*uy;
-		PRECISION piu3 = -pinn*t2*un + pitn*ut - pixn*ux - piyn*uy;
-		
-		PRECISION a1 = fdividef(spipi, rhomax)*rsqrtf(e_s*e_s+3*p_s*p_s);
-		PRECISION den = xi0*rhomax*spipi;
+	PRECISION pipi = pitt*pitt-2*pitx*pitx-2*pity*pity+pixx*pixx+2*pixy*pixy+piyy*piyy-2*pitn*pitn*t2+2*pixn*pixn*t2+2*piyn*piyn*t2+pinn*pinn*t2*t2;
+	PRECISION spipi = sqrt(fabs(pipi+3*Pi*Pi));
+	PRECISION pimumu = pitt - pixx - piyy - pinn*t*t;
+	PRECISION piu0 = -pitn*t2*un + pitt*ut - pitx*ux - pity*uy;
+	PRECISION piu1 = -pixn*t2*un + pitx*ut - pixx*ux - pixy*uy;
+	PRECISION piu2 = -piyn*t2*un + pity*ut - pixy*ux - piyy*uy;
+	PRECISION piu3 = -pinn*t2*un + pitn*ut - pixn*ux - piyn*uy;
+	
+	PRECISION a1 = (spipi / rhomax)*(1/sqrt(e_s*e_s+3*p_s*p_s));
+	PRECISION den = xi0*rhomax*spipi;
 ///*
-		PRECISION a2 = fdividef(pimumu, den);
-		PRECISION a3 = fdividef(piu0, den);
-		PRECISION a4 = fdividef(piu1, den);
-		PRECISION a5 = fdividef(piu2, den);
-		PRECISION a6 = fdividef(piu3, den);
+	PRECISION a2 = (pimumu / den);
+	PRECISION a3 = (piu0 / den);
+	PRECISION a4 = (piu1 / den);
+	PRECISION a5 = (piu2 / den);
+	PRECISION a6 = (piu3 / den);
 //*/
 /*
-		PRECISION a2 = fabsf(fdividef(pimumu, den));
-		PRECISION a3 = fabsf(fdividef(piu0, den));
-		PRECISION a4 = fabsf(fdividef(piu1, den));
-		PRECISION a5 = fabsf(fdividef(piu2, den));
-		PRECISION a6 = fabsf(fdividef(piu3, den));
+	PRECISION a2 = fabs((pimumu / den));
+	PRECISION a3 = fabs((piu0 / den));
+	PRECISION a4 = fabs((piu1 / den));
+	PRECISION a5 = fabs((piu2 / den));
+	PRECISION a6 = fabs((piu3 / den));
 //*/
-		PRECISION rho = fmaxf(a1,fmaxf(a2,fmaxf(a3,fmaxf(a4,fmaxf(a5,a6)))));
+	PRECISION rho = fmax(a1,fmax(a2,fmax(a3,fmax(a4,fmax(a5,a6)))));
 
-		PRECISION fac = fdividef(tanhf(rho), rho);
-		if(fabsf(rho)<1.e-7) fac = 1;
+	PRECISION fac = (tanh(rho) / rho);
+	if(fabs(rho)<1.e-7) fac = 1;
 
-		currrentVars->pitt[s] *= fac;
-		currrentVars->pitx[s] *= fac;
-		currrentVars->pity[s] *= fac;
-		currrentVars->pitn[s] *= fac;
-		currrentVars->pixx[s] *= fac;
-		currrentVars->pixy[s] *= fac;
-		currrentVars->pixn[s] *= fac;
-		currrentVars->piyy[s] *= fac;
-		currrentVars->piyn[s] *= fac;
-		currrentVars->pinn[s] *= fac;
-		// TODO: Should we regulate \Pi here?
+	currrentVars->pitt[s] *= fac;
+	currrentVars->pitx[s] *= fac;
+	currrentVars->pity[s] *= fac;
+	currrentVars->pitn[s] *= fac;
+	currrentVars->pixx[s] *= fac;
+	currrentVars->pixy[s] *= fac;
+	currrentVars->pixn[s] *= fac;
+	currrentVars->piyy[s] *= fac;
+	currrentVars->piyn[s] *= fac;
+	currrentVars->pinn[s] *= fac;
+	// TODO: Should we regulate \Pi here?
 
-		validityDomain->regulations[s] = fac;
+	if (validityDomain->regulations != NULL) validityDomain->regulations[s] = fac;
+}
+
+__global__ 
+void regulateDissipativeCurrents(PRECISION t, 
+CONSERVED_VARIABLES * const __restrict__ currrentVars, 
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u,
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int kBegin, int kEnd
+) {
+	unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x;
+	if (threadID < d_nx * d_ny * (kEnd - kBegin)) {
+		unsigned int k = threadID / (d_nx * d_ny) + kBegin;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		regulateDissipativeCurrentsCell(t, currrentVars, e, p, u, validityDomain, s);
+	}
+}
+
+void regulateDissipativeCurrentsHost(PRECISION t, 
+CONSERVED_VARIABLES * const __restrict__ currrentVars, 
+const PRECISION * const __restrict__ e, const PRECISION * const __restrict__ p,
+const FLUID_VELOCITY * const __restrict__ u,
+VALIDITY_DOMAIN * const __restrict__ validityDomain,
+int kBegin, int kEnd
+) {
+#pragma omp parallel for collapse(2)
+	for (int k = kBegin; k < kEnd; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				regulateDissipativeCurrentsCell(t, currrentVars, e, p, u, validityDomain, s);
+			}
+		}
 	}
 }
-#endif
@@ -20,9 +20,10 @@
 #include "edu/osu/rhic/trunk/eos/EquationOfState.cuh" // for bulk terms
 #include "edu/osu/rhic/trunk/hydro/TransportCoefficients.cuh"
 
-//#define USE_CARTESIAN_COORDINATES
+// USE_CARTESIAN_COORDINATES (make CARTESIAN=1) evolves the Riemann tests in Cartesian coordinates
 
-__device__
+template <int MODE>
+__host__ __device__
 void setPimunuSourceTerms(PRECISION * const __restrict__ pimunuRHS,
 PRECISION t, PRECISION e, PRECISION p,
 PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un, PRECISION utp,
@@ -39,7 +40,7 @@ PRECISION dyun, PRECISION dnun, PRECISION dkvk) {
 	 * Temperature dependent shear transport coefficients
 	 /*********************************************************/
 	PRECISION T = effectiveTemperature(e);
-	PRECISION taupiInv = 0.2f * fdividef(T, d_etabar);
+	PRECISION taupiInv = 0.2f * (T / CONST_PARAM(etabar));
 	PRECISION beta_pi = 0.2f * (e + p);
 
 	/*********************************************************\
@@ -52,7 +53,7 @@ PRECISION dyun, PRECISION dnun, PRECISION dkvk) {
 	PRECISION lambda_Pipi = 1.6f * a;
 
 	PRECISION zetabar = bulkViscosityToEntropyDensity(T);
-	PRECISION tauPiInv = 15 * a2 * fdividef(T, zetabar);
+	PRECISION tauPiInv = 15 * a2 * (T / zetabar);
 
 	PRECISION ut2 = ut * ut;
 	PRECISION un2 = un * un;
@@ -60,10 +61,10 @@ PRECISION dyun, PRECISION dnun, PRECISION dkvk) {
 	PRECISION t3 = t * t2;
 
 	// time derivatives of u
-	PRECISION dtut = (ut - utp) / d_dt;
-	PRECISION dtux = (ux - uxp) / d_dt;
-	PRECISION dtuy = (uy - uyp) / d_dt;
-	PRECISION dtun = (un - unp) / d_dt;
+	PRECISION dtut = (ut - utp) / CONST_PARAM(dtp);
+	PRECISION dtux = (ux - uxp) / CONST_PARAM(dtp);
+	PRECISION dtuy = (uy - uyp) / CONST_PARAM(dtp);
+	PRECISION dtun = (un - unp) / CONST_PARAM(dtp);
 
 	/*********************************************************\
 	 * covariant derivatives
@@ -282,13 +283,14 @@ PRECISION dyun, PRECISION dnun, PRECISION dkvk) {
 	pimunuRHS[7] = dpiyy / ut + piyy * dkvk;
 	pimunuRHS[8] = dpiyn / ut + piyn * dkvk;
 	pimunuRHS[9] = dpinn / ut + pinn * dkvk;
-#ifdef PI
-	pimunuRHS[10] = dPi / ut + Pi * dkvk;
-#endif
+	if (EVOLVE_PI(MODE)) {
+		pimunuRHS[10] = dPi / ut + Pi * dkvk;
+	}
 }
 
 /***************************************************************************************************************************************************/
-__device__
+template <int MODE>
+__host__ __device__
 void loadSourceTerms(const PRECISION * const __restrict__ I, const PRECISION * const __restrict__ J, const PRECISION * const __restrict__ K,
 		const PRECISION * const __restrict__ Q,
 		PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u,
@@ -301,34 +303,17 @@ void loadSourceTerms(const PRECISION * const __restrict__ I, const PRECISION * c
 	PRECISION ttx = Q[1];
 	PRECISION tty = Q[2];
 	PRECISION ttn = Q[3];
-#ifdef PIMUNU
-	PRECISION pitt = Q[4];
-	PRECISION pitx = Q[5];
-	PRECISION pity = Q[6];
-	PRECISION pitn = Q[7];
-	PRECISION pixx = Q[8];
-	PRECISION pixy = Q[9];
-	PRECISION pixn = Q[10];
-	PRECISION piyy = Q[11];
-	PRECISION piyn = Q[12];
-	PRECISION pinn = Q[13];
-#else
-	PRECISION pitt = 0;
-	PRECISION pitx = 0;
-	PRECISION pity = 0;
-	PRECISION pitn = 0;
-	PRECISION pixx = 0;
-	PRECISION pixy = 0;
-	PRECISION pixn = 0;
-	PRECISION piyy = 0;
-	PRECISION piyn = 0;
-	PRECISION pinn = 0;
-#endif
-#ifdef PI
-	PRECISION Pi = Q[14];
-#else
-	PRECISION Pi = 0;
-#endif
+	PRECISION pitt = EVOLVE_PIMUNU(MODE) ? Q[4] : 0;
+	PRECISION pitx = EVOLVE_PIMUNU(MODE) ? Q[5] : 0;
+	PRECISION pity = EVOLVE_PIMUNU(MODE) ? Q[6] : 0;
+	PRECISION pitn = EVOLVE_PIMUNU(MODE) ? Q[7] : 0;
+	PRECISION pixx = EVOLVE_PIMUNU(MODE) ? Q[8] : 0;
+	PRECISION pixy = EVOLVE_PIMUNU(MODE) ? Q[9] : 0;
+	PRECISION pixn = EVOLVE_PIMUNU(MODE) ? Q[10] : 0;
+	PRECISION piyy = EVOLVE_PIMUNU(MODE) ? Q[11] : 0;
+	PRECISION piyn = EVOLVE_PIMUNU(MODE) ? Q[12] : 0;
+	PRECISION pinn = EVOLVE_PIMUNU(MODE) ? Q[13] : 0;
+	PRECISION Pi = EVOLVE_PI(MODE) ? Q[14] : 0;
 	//=========================================================
 	// primary variables
 	//=========================================================
@@ -346,28 +331,28 @@ void loadSourceTerms(const PRECISION * const __restrict__ I, const PRECISION * c
 	//=========================================================
 	// spatial derivatives of primary variables
 	//=========================================================
-	PRECISION facX = 1 / d_dx / 2;
-	PRECISION facY = 1 / d_dy / 2;
-	PRECISION facZ = 1 / d_dz / 2;
+	PRECISION facX = 1 / CONST_PARAM(dx) / 2;
+	PRECISION facY = 1 / CONST_PARAM(dy) / 2;
+	PRECISION facZ = 1 / CONST_PARAM(dz) / 2;
 	// dx of u^{\mu} components
 	PRECISION dxut = (*(utvec + s + 1) - *(utvec + s - 1)) * facX;
 	PRECISION dxux = (*(uxvec + s + 1) - *(uxvec + s - 1)) * facX;
 	PRECISION dxuy = (*(uyvec + s + 1) - *(uyvec + s - 1)) * facX;
 	PRECISION dxun = (*(unvec + s + 1) - *(unvec + s - 1)) * facX;
 	// dy of u^{\mu} components
-	PRECISION dyut = (*(utvec + s + d_ncx) - *(utvec + s - d_ncx)) * facY;
-	PRECISION dyux = (*(uxvec + s + d_ncx) - *(uxvec + s - d_ncx)) * facY;
-	PRECISION dyuy = (*(uyvec + s + d_ncx) - *(uyvec + s - d_ncx)) * facY;
-	PRECISION dyun = (*(unvec + s + d_ncx) - *(unvec + s - d_ncx)) * facY;
+	PRECISION dyut = (*(utvec + s + CONST_PARAM(ncx)) - *(utvec + s - CONST_PARAM(ncx))) * facY;
+	PRECISION dyux = (*(uxvec + s + CONST_PARAM(ncx)) - *(uxvec + s - CONST_PARAM(ncx))) * facY;
+	PRECISION dyuy = (*(uyvec + s + CONST_PARAM(ncx)) - *(uyvec + s - CONST_PARAM(ncx))) * facY;
+	PRECISION dyun = (*(unvec + s + CONST_PARAM(ncx)) - *(unvec + s - CONST_PARAM(ncx))) * facY;
 	// dn of u^{\mu} components
-	int stride = d_ncx * d_ncy;
+	int stride = CONST_PARAM(ncx) * CONST_PARAM(ncy);
 	PRECISION dnut = (*(utvec + s + stride) - *(utvec + s - stride)) * facZ;
 	PRECISION dnux = (*(uxvec + s + stride) - *(uxvec + s - stride)) * facZ;
 	PRECISION dnuy = (*(uyvec + s + stride) - *(uyvec + s - stride)) * facZ;
 	PRECISION dnun = (*(unvec + s + stride) - *(unvec + s - stride)) * facZ;
 	// pressure
 	PRECISION dxp = (*(pvec + s + 1) - *(pvec + s - 1)) * facX;
-	PRECISION dyp = (*(pvec + s + d_ncx) - *(pvec + s - d_ncx)) * facY;
+	PRECISION dyp = (*(pvec + s + CONST_PARAM(ncx)) - *(pvec + s - CONST_PARAM(ncx))) * facY;
 	PRECISION dnp = (*(pvec + s + stride) - *(pvec + s - stride)) * facZ;
 
 	//=========================================================
@@ -438,7 +423,7 @@ void loadSourceTerms(const PRECISION * const __restrict__ I, const PRECISION * c
 	S[0] = -(ttt / t + t * tnn) + dkvk * (pitt - p - Pi) - vx * dxp - vy * dyp - vn * dnp;
 	S[1] = -ttx / t - dxp + dkvk * pitx;
 	S[2] = -tty / t - dyp + dkvk * pity;
-	S[3] = -3 * ttn / t - dnp / powf(t, 2.0f) + dkvk * pitn;
+	S[3] = -3 * ttn / t - dnp / pow(t, (PRECISION) 2) + dkvk * pitn;
 #ifdef USE_CARTESIAN_COORDINATES
 	S[0] = dkvk*(pitt-p-Pi) - vx*dxp - vy*dyp - vn*dnp;
 	S[1] = -dxp + dkvk*pitx;
@@ -447,38 +432,41 @@ void loadSourceTerms(const PRECISION * const __restrict__ I, const PRECISION * c
 #endif
 
 	//X
-#ifndef PI
-	S[0] += dxpitt*vx - dxpitx + dypitt*vy - dypity + dnpitt*vn - dnpitn;
-	S[1] += dxpitx*vx - dxpixx + dypitx*vy - dypixy + dnpitx*vn - dnpixn;
-	S[2] += dxpity*vx - dxpixy + dypity*vy - dypiyy + dnpity*vn - dnpiyn;
-	S[3] += dxpitn*vx - dxpixn + dypitn*vy - dypiyn + dnpitn*vn - dnpinn;
-#else
-	S[0] += dxpitt * vx - dxpitx - vx * dxPi + dypitt * vy - dypity - vy * dyPi + dnpitt * vn - dnpitn - vn * dnPi;
-	S[1] += dxpitx * vx - dxpixx + dypitx * vy - dypixy + dnpitx * vn - dnpixn - dxPi;
-	S[2] += dxpity * vx - dxpixy + dypity * vy - dypiyy + dnpity * vn - dnpiyn - dyPi;
-	S[3] += dxpitn * vx - dxpixn + dypitn * vy - dypiyn + dnpitn * vn - dnpinn - dnPi / powf(t, 2.0f);
-#endif
+	if (EVOLVE_PIMUNU(MODE)) {
+		if (!EVOLVE_PI(MODE)) {
+			S[0] += dxpitt*vx - dxpitx + dypitt*vy - dypity + dnpitt*vn - dnpitn;
+			S[1] += dxpitx*vx - dxpixx + dypitx*vy - dypixy + dnpitx*vn - dnpixn;
+			S[2] += dxpity*vx - dxpixy + dypity*vy - dypiyy + dnpity*vn - dnpiyn;
+			S[3] += dxpitn*vx - dxpixn + dypitn*vy - dypiyn + dnpitn*vn - dnpinn;
+		} else {
+			S[0] += dxpitt * vx - dxpitx - vx * dxPi + dypitt * vy - dypity - vy * dyPi + dnpitt * vn - dnpitn - vn * dnPi;
+			S[1] += dxpitx * vx - dxpixx + dypitx * vy - dypixy + dnpitx * vn - dnpixn - dxPi;
+			S[2] += dxpity * vx - dxpixy + dypity * vy - dypiyy + dnpity * vn - dnpiyn - dyPi;
+			S[3] += dxpitn * vx - dxpixn + dypitn * vy - dypiyn + dnpitn * vn - dnpinn - dnPi / pow(t, (PRECISION) 2);
+		}
+	}
 
 	//=========================================================
 	// \pi^{\mu\nu} source terms
 	//=========================================================
-#ifndef IDEAL
-	PRECISION pimunuRHS[NUMBER_DISSIPATIVE_CURRENTS];
-	setPimunuSourceTerms(pimunuRHS, t, e, p, ut, ux, uy, un, utp, uxp, uyp, unp, pitt, pitx, pity, pitn, pixx, pixy, pixn, piyy, piyn, pinn, Pi, dxut, dyut,
-			dnut, dxux, dyux, dnux, dxuy, dyuy, dnuy, dxun, dyun, dnun, dkvk);
-	for (unsigned int n = 0; n < NUMBER_DISSIPATIVE_CURRENTS; ++n)
-		S[n + 4] = pimunuRHS[n];
-#endif		
+	if (EVOLVE_PIMUNU(MODE)) {
+		PRECISION pimunuRHS[NUMBER_DISSIPATIVE_CURRENTS(SHEAR_BULK_HYDRO)];
+		setPimunuSourceTerms<MODE>(pimunuRHS, t, e, p, ut, ux, uy, un, utp, uxp, uyp, unp, pitt, pitx, pity, pitn, pixx, pixy, pixn, piyy, piyn, pinn, Pi, dxut, dyut,
+				dnut, dxux, dyux, dnux, dxuy, dyuy, dnuy, dxun, dyun, dnun, dkvk);
+		for (unsigned int n = 0; n < NUMBER_DISSIPATIVE_CURRENTS(MODE); ++n)
+			S[n + 4] = pimunuRHS[n];
+	}
 }
 /***************************************************************************************************************************************************/
 
-__device__
+template <int MODE>
+__host__ __device__
 void loadSourceTermsX(const PRECISION * const __restrict__ I,
 PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s) {
 	//=========================================================
 	// spatial derivatives of the conserved variables \pi^{\mu\nu}
 	//=========================================================
-	PRECISION facX = 1 / d_dx / 2;
+	PRECISION facX = 1 / CONST_PARAM(dx) / 2;
 	int ptr = 20; // 5 * n (with n = 4 corresponding to pitt)
 	PRECISION dxpitt = (*(I + ptr + 3) - *(I + ptr + 1)) * facX;
 	ptr += 5;
@@ -502,25 +490,26 @@ PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, i
 	// set dx terms in the source terms
 	//=========================================================
 	PRECISION vx = ux / ut;
-#ifndef PI
-	S[0] = dxpitt*vx - dxpitx;
-	S[1] = dxpitx*vx - dxpixx;
-#else
-	PRECISION dxPi = (*(I + ptr + 3) - *(I + ptr + 1)) * facX;
-	S[0] = dxpitt * vx - dxpitx - vx * dxPi;
-	S[1] = dxpitx * vx - dxpixx - dxPi;
-#endif
+	if (!EVOLVE_PI(MODE)) {
+		S[0] = dxpitt*vx - dxpitx;
+		S[1] = dxpitx*vx - dxpixx;
+	} else {
+		PRECISION dxPi = (*(I + ptr + 3) - *(I + ptr + 1)) * facX;
+		S[0] = dxpitt * vx - dxpitx - vx * dxPi;
+		S[1] = dxpitx * vx - dxpixx - dxPi;
+	}
 	S[2] = dxpity * vx - dxpixy;
 	S[3] = dxpitn * vx - dxpixn;
 }
 
-__device__
+template <int MODE>
+__host__ __device__
 void loadSourceTermsY(const PRECISION * const __restrict__ J,
 PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s) {
 	//=========================================================
 	// spatial derivatives of the conserved variables \pi^{\mu\nu}
 	//=========================================================
-	PRECISION facY = 1 / d_dy / 2;
+	PRECISION facY = 1 / CONST_PARAM(dy) / 2;
 	int ptr = 20; // 5 * n (with n = 4 corresponding to pitt)
 	PRECISION dypitt = (*(J + ptr + 3) - *(J + ptr + 1)) * facY;
 	ptr += 5;
@@ -544,25 +533,26 @@ PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, i
 	// set dy terms in the source terms
 	//=========================================================
 	PRECISION vy = uy / ut;
-#ifndef PI
-	S[0] = dypitt*vy - dypity;
-	S[2] = dypity*vy - dypiyy;
-#else
-	PRECISION dyPi = (*(J + ptr + 3) - *(J + ptr + 1)) * facY;
-	S[0] = dypitt * vy - dypity - vy * dyPi;
-	S[2] = dypity * vy - dypiyy - dyPi;
-#endif
+	if (!EVOLVE_PI(MODE)) {
+		S[0] = dypitt*vy - dypity;
+		S[2] = dypity*vy - dypiyy;
+	} else {
+		PRECISION dyPi = (*(J + ptr + 3) - *(J + ptr + 1)) * facY;
+		S[0] = dypitt * vy - dypity - vy * dyPi;
+		S[2] = dypity * vy - dypiyy - dyPi;
+	}
 	S[1] = dypitx * vy - dypixy;
 	S[3] = dypitn * vy - dypiyn;
 }
 
-__device__
+template <int MODE>
+__host__ __device__
 void loadSourceTermsZ(const PRECISION * const __restrict__ K,
 PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s, PRECISION t) {
 	//=========================================================
 	// spatial derivatives of the conserved variables \pi^{\mu\nu}
 	//=========================================================
-	PRECISION facZ = 1 / d_dz / 2;
+	PRECISION facZ = 1 / CONST_PARAM(dz) / 2;
 	int ptr = 20; // 5 * n (with n = 4 corresponding to pitt)
 	PRECISION dnpitt = (*(K + ptr + 3) - *(K + ptr + 1)) * facZ;
 	ptr += 5;
@@ -586,19 +576,20 @@ PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, i
 	// set dn terms in the source terms
 	//=========================================================
 	PRECISION vn = un / ut;
-#ifndef PI
-	S[0] = dnpitt*vn - dnpitn;
-	S[3] = dnpitn*vn - dnpinn;
-#else
-	PRECISION dnPi = (*(K + ptr + 3) - *(K + ptr + 1)) * facZ;
-	S[0] = dnpitt * vn - dnpitn - vn * dnPi;
-	S[3] = dnpitn * vn - dnpinn - dnPi / powf(t, 2);
-#endif
+	if (!EVOLVE_PI(MODE)) {
+		S[0] = dnpitt*vn - dnpitn;
+		S[3] = dnpitn*vn - dnpinn;
+	} else {
+		PRECISION dnPi = (*(K + ptr + 3) - *(K + ptr + 1)) * facZ;
+		S[0] = dnpitt * vn - dnpitn - vn * dnPi;
+		S[3] = dnpitn * vn - dnpinn - dnPi / pow(t, (PRECISION) 2);
+	}
 	S[1] = dnpitx * vn - dnpixn;
 	S[2] = dnpity * vn - dnpiyn;
 }
 
-__device__
+template <int MODE, int DIMS>
+__host__ __device__
 void loadSourceTerms2(const PRECISION * const __restrict__ Q,
 PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u,
 PRECISION utp, PRECISION uxp, PRECISION uyp, PRECISION unp,
@@ -610,34 +601,17 @@ PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, int s) {
 	PRECISION ttx = Q[1];
 	PRECISION tty = Q[2];
 	PRECISION ttn = Q[3];
-#ifdef PIMUNU
-	PRECISION pitt = Q[4];
-	PRECISION pitx = Q[5];
-	PRECISION pity = Q[6];
-	PRECISION pitn = Q[7];
-	PRECISION pixx = Q[8];
-	PRECISION pixy = Q[9];
-	PRECISION pixn = Q[10];
-	PRECISION piyy = Q[11];
-	PRECISION piyn = Q[12];
-	PRECISION pinn = Q[13];
-#else
-	PRECISION pitt = 0;
-	PRECISION pitx = 0;
-	PRECISION pity = 0;
-	PRECISION pitn = 0;
-	PRECISION pixx = 0;
-	PRECISION pixy = 0;
-	PRECISION pixn = 0;
-	PRECISION piyy = 0;
-	PRECISION piyn = 0;
-	PRECISION pinn = 0;
-#endif
-#ifdef PI
-	PRECISION Pi = Q[14];
-#else
-	PRECISION Pi = 0;
-#endif
+	PRECISION pitt = EVOLVE_PIMUNU(MODE) ? Q[4] : 0;
+	PRECISION pitx = EVOLVE_PIMUNU(MODE) ? Q[5] : 0;
+	PRECISION pity = EVOLVE_PIMUNU(MODE) ? Q[6] : 0;
+	PRECISION pitn = EVOLVE_PIMUNU(MODE) ? Q[7] : 0;
+	PRECISION pixx = EVOLVE_PIMUNU(MODE) ? Q[8] : 0;
+	PRECISION pixy = EVOLVE_PIMUNU(MODE) ? Q[9] : 0;
+	PRECISION pixn = EVOLVE_PIMUNU(MODE) ? Q[10] : 0;
+	PRECISION piyy = EVOLVE_PIMUNU(MODE) ? Q[11] : 0;
+	PRECISION piyn = EVOLVE_PIMUNU(MODE) ? Q[12] : 0;
+	PRECISION pinn = EVOLVE_PIMUNU(MODE) ? Q[13] : 0;
+	PRECISION Pi = EVOLVE_PI(MODE) ? Q[14] : 0;
 
 	//=========================================================
 	// primary variables
@@ -656,29 +630,36 @@ PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, int s) {
 	//=========================================================
 	// spatial derivatives of primary variables
 	//=========================================================
-	PRECISION facX = 1 / d_dx / 2;
-	PRECISION facY = 1 / d_dy / 2;
-	PRECISION facZ = 1 / d_dz / 2;
+	PRECISION facX = 1 / CONST_PARAM(dx) / 2;
+	PRECISION facY = 1 / CONST_PARAM(dy) / 2;
+	PRECISION facZ = 1 / CONST_PARAM(dz) / 2;
 	// dx of u^{\mu} components
 	PRECISION dxut = (*(utvec + s + 1) - *(utvec + s - 1)) * facX;
 	PRECISION dxux = (*(uxvec + s + 1) - *(uxvec + s - 1)) * facX;
 	PRECISION dxuy = (*(uyvec + s + 1) - *(uyvec + s - 1)) * facX;
 	PRECISION dxun = (*(unvec + s + 1) - *(unvec + s - 1)) * facX;
-	// dy of u^{\mu} components
-	PRECISION dyut = (*(utvec + s + d_ncx) - *(utvec + s - d_ncx)) * facY;
-	PRECISION dyux = (*(uxvec + s + d_ncx) - *(uxvec + s - d_ncx)) * facY;
-	PRECISION dyuy = (*(uyvec + s + d_ncx) - *(uyvec + s - d_ncx)) * facY;
-	PRECISION dyun = (*(unvec + s + d_ncx) - *(unvec + s - d_ncx)) * facY;
-	// dn of u^{\mu} components
-	int stride = d_ncx * d_ncy;
-	PRECISION dnut = (*(utvec + s + stride) - *(utvec + s - stride)) * facZ;
-	PRECISION dnux = (*(uxvec + s + stride) - *(uxvec + s - stride)) * facZ;
-	PRECISION dnuy = (*(uyvec + s + stride) - *(uyvec + s - stride)) * facZ;
-	PRECISION dnun = (*(unvec + s + stride) - *(unvec + s - stride)) * facZ;
 	// pressure
 	PRECISION dxp = (*(pvec + s + 1) - *(pvec + s - 1)) * facX;
-	PRECISION dyp = (*(pvec + s + d_ncx) - *(pvec + s - d_ncx)) * facY;
-	PRECISION dnp = (*(pvec + s + stride) - *(pvec + s - stride)) * facZ;
+	// the derivatives along trivial directions vanish
+	PRECISION dyut = 0, dyux = 0, dyuy = 0, dyun = 0, dyp = 0;
+	PRECISION dnut = 0, dnux = 0, dnuy = 0, dnun = 0, dnp = 0;
+	if (EVOLVE_Y(DIMS)) {
+		// dy of u^{\mu} components and pressure
+		dyut = (*(utvec + s + CONST_PARAM(ncx)) - *(utvec + s - CONST_PARAM(ncx))) * facY;
+		dyux = (*(uxvec + s + CONST_PARAM(ncx)) - *(uxvec + s - CONST_PARAM(ncx))) * facY;
+		dyuy = (*(uyvec + s + CONST_PARAM(ncx)) - *(uyvec + s - CONST_PARAM(ncx))) * facY;
+		dyun = (*(unvec + s + CONST_PARAM(ncx)) - *(unvec + s - CONST_PARAM(ncx))) * facY;
+		dyp = (*(pvec + s + CONST_PARAM(ncx)) - *(pvec + s - CONST_PARAM(ncx))) * facY;
+	}
+	if (EVOLVE_Z(DIMS)) {
+		// dn of u^{\mu} components and pressure
+		int stride = CONST_PARAM(ncx) * CONST_PARAM(ncy);
+		dnut = (*(utvec + s + stride) - *(utvec + s - stride)) * facZ;
+		dnux = (*(uxvec + s + stride) - *(uxvec + s - stride)) * facZ;
+		dnuy = (*(uyvec + s + stride) - *(uyvec + s - stride)) * facZ;
+		dnun = (*(unvec + s + stride) - *(unvec + s - stride)) * facZ;
+		dnp = (*(pvec + s + stride) - *(pvec + s - stride)) * facZ;
+	}
 
 	//=========================================================
 	// T^{\mu\nu} source terms
@@ -694,7 +675,7 @@ PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, int s) {
 	S[0] = -(ttt / t + t * tnn) + dkvk * (pitt - p - Pi) - vx * dxp - vy * dyp - vn * dnp;
 	S[1] = -ttx / t - dxp + dkvk * pitx;
 	S[2] = -tty / t - dyp + dkvk * pity;
-	S[3] = -3 * ttn / t - dnp / powf(t, 2) + dkvk * pitn;
+	S[3] = -3 * ttn / t - dnp / pow(t, (PRECISION) 2) + dkvk * pitn;
 #ifdef USE_CARTESIAN_COORDINATES
 	S[0] = dkvk*(pitt-p-Pi) - vx*dxp - vy*dyp - vn*dnp;
 	S[1] = -dxp + dkvk*pitx;
@@ -705,12 +686,38 @@ PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, int s) {
 	//=========================================================
 	// \pi^{\mu\nu} source terms
 	//=========================================================
-#ifndef IDEAL
-	PRECISION pimunuRHS[NUMBER_DISSIPATIVE_CURRENTS];
-	setPimunuSourceTerms(pimunuRHS, t, e, p, ut, ux, uy, un, utp, uxp, uyp, unp, pitt, pitx, pity, pitn, pixx, pixy, pixn, piyy, piyn, pinn, Pi, dxut, dyut,
-			dnut, dxux, dyux, dnux, dxuy, dyuy, dnuy, dxun, dyun, dnun, dkvk);
-	for (unsigned int n = 0; n < NUMBER_DISSIPATIVE_CURRENTS; ++n)
-		S[n + 4] = pimunuRHS[n];
-#endif		
+	if (EVOLVE_PIMUNU(MODE)) {
+		PRECISION pimunuRHS[NUMBER_DISSIPATIVE_CURRENTS(SHEAR_BULK_HYDRO)];
+		setPimunuSourceTerms<MODE>(pimunuRHS, t, e, p, ut, ux, uy, un, utp, uxp, uyp, unp, pitt, pitx, pity, pitn, pixx, pixy, pixn, piyy, piyn, pinn, Pi, dxut, dyut,
+				dnut, dxux, dyux, dnux, dxuy, dyuy, dnuy, dxun, dyun, dnun, dkvk);
+		for (unsigned int n = 0; n < NUMBER_DISSIPATIVE_CURRENTS(MODE); ++n)
+			S[n + 4] = pimunuRHS[n];
+	}
 }
 
+#define INSTANTIATE_SOURCE_TERMS_DIMENSIONS(MODE, DIMS) \
+template __host__ __device__ void loadSourceTerms2<MODE, DIMS>(const PRECISION * const __restrict__ Q, PRECISION * const __restrict__ S, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		PRECISION utp, PRECISION uxp, PRECISION uyp, PRECISION unp, \
+		PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, \
+		int s);
+#define INSTANTIATE_SOURCE_TERMS(MODE) \
+template __host__ __device__ void setPimunuSourceTerms<MODE>(PRECISION * const __restrict__ pimunuRHS, \
+		PRECISION t, PRECISION e, PRECISION p, \
+		PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un, PRECISION utp, PRECISION uxp, PRECISION uyp, PRECISION unp, \
+		PRECISION pitt, PRECISION pitx, PRECISION pity, PRECISION pitn, PRECISION pixx, PRECISION pixy, PRECISION pixn, \
+		PRECISION piyy, PRECISION piyn, PRECISION pinn, PRECISION Pi, \
+		PRECISION dxut, PRECISION dyut, PRECISION dnut, PRECISION dxux, PRECISION dyux, PRECISION dnux, \
+		PRECISION dxuy, PRECISION dyuy, PRECISION dnuy, PRECISION dxun, PRECISION dyun, PRECISION dnun, PRECISION dkvk); \
+template __host__ __device__ void loadSourceTerms<MODE>(const PRECISION * const __restrict__ I, const PRECISION * const __restrict__ J, const PRECISION * const __restrict__ K, \
+		const PRECISION * const __restrict__ Q, PRECISION * const __restrict__ S, \
+		const FLUID_VELOCITY * const __restrict__ u, \
+		PRECISION utp, PRECISION uxp, PRECISION uyp, PRECISION unp, \
+		PRECISION t, PRECISION e, const PRECISION * const __restrict__ pvec, \
+		int s); \
+template __host__ __device__ void loadSourceTermsX<MODE>(const PRECISION * const __restrict__ I, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s); \
+template __host__ __device__ void loadSourceTermsY<MODE>(const PRECISION * const __restrict__ J, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s); \
+template __host__ __device__ void loadSourceTermsZ<MODE>(const PRECISION * const __restrict__ K, PRECISION * const __restrict__ S, const FLUID_VELOCITY * const __restrict__ u, int s, \
+		PRECISION t); \
+INSTANTIATE_LATTICE_DIMENSIONS(INSTANTIATE_SOURCE_TERMS_DIMENSIONS, MODE)
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_SOURCE_TERMS)
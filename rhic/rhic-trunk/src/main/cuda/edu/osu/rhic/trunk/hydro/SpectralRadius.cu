@@ -14,17 +14,17 @@
 #include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
 #include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
 
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusX(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un) {
-	return fabsf(ux/ut);
+	return fabs(ux/ut);
 }
 
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusY(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un) {
-	return fabsf(uy/ut);
+	return fabs(uy/ut);
 }
 
-__device__ 
+__host__ __device__ 
 PRECISION spectralRadiusZ(PRECISION ut, PRECISION ux, PRECISION uy, PRECISION un) {
-	return fabsf(un/ut);
+	return fabs(un/ut);
 }
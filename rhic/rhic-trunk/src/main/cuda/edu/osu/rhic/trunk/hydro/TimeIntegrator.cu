@@ -0,0 +1,39 @@
+/*
+ * TimeIntegrator.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h> // for strcmp
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/TimeIntegrator.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/trunk/hydro/FullyDiscreteKurganovTadmorScheme.cuh"
+
+static const char * const timeIntegratorNames[NUMBER_TIME_INTEGRATORS] = {
+	"rk2", "ssp_rk3"
+};
+
+int findTimeIntegrator(const char *name) {
+	for (int n = 0; n < NUMBER_TIME_INTEGRATORS; ++n) {
+		if (strcmp(name, timeIntegratorNames[n]) == 0) return n;
+	}
+	return -1;
+}
+
+template <int MODE>
+const TIME_INTEGRATOR * getTimeIntegrator(int integrator) {
+	static const TIME_INTEGRATOR integrators[NUMBER_TIME_INTEGRATORS] = {
+		{ timeIntegratorNames[TIME_INTEGRATOR_RK2], 2, &twoStepRungeKutta<MODE>, &twoStepRungeKuttaHost<MODE> },
+		{ timeIntegratorNames[TIME_INTEGRATOR_SSP_RK3], 3, &threeStepRungeKutta<MODE>, &threeStepRungeKuttaHost<MODE> }
+	};
+	return &integrators[integrator];
+}
+
+#define INSTANTIATE_TIME_INTEGRATOR(MODE) \
+template const TIME_INTEGRATOR * getTimeIntegrator<MODE>(int integrator);
+INSTANTIATE_PHYSICS_MODES(INSTANTIATE_TIME_INTEGRATOR)
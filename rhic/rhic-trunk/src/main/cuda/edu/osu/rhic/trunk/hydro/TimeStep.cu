@@ -0,0 +1,113 @@
+/*
+ * TimeStep.cu
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <math.h>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "edu/osu/rhic/trunk/hydro/TimeStep.cuh"
+#include "edu/osu/rhic/trunk/hydro/SpectralRadius.cuh"
+#include "edu/osu/rhic/trunk/hydro/DynamicalVariables.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+// partial maxima of the blocks, allocated on first use
+static PRECISION *d_blockMaxima = NULL;
+
+__global__
+void maximumSpectralRadiiKernel(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const __restrict__ blockMaxima) {
+	__shared__ PRECISION ax[SPECTRAL_RADIUS_THREADS], ay[SPECTRAL_RADIUS_THREADS], az[SPECTRAL_RADIUS_THREADS];
+
+	PRECISION mx = 0, my = 0, mz = 0;
+	for (unsigned int threadID = blockDim.x * blockIdx.x + threadIdx.x; threadID < d_nElements; threadID += blockDim.x * gridDim.x) {
+		unsigned int k = threadID / (d_nx * d_ny) + N_GHOST_CELLS_M;
+		unsigned int j = (threadID % (d_nx * d_ny)) / d_nx + N_GHOST_CELLS_M;
+		unsigned int i = threadID % d_nx + N_GHOST_CELLS_M;
+		unsigned int s = columnMajorLinearIndex(i, j, k, d_ncx, d_ncy);
+		PRECISION ut = u->ut[s];
+		PRECISION ux = u->ux[s];
+		PRECISION uy = u->uy[s];
+		PRECISION un = u->un[s];
+		mx = fmax(mx, spectralRadiusX(ut, ux, uy, un));
+		my = fmax(my, spectralRadiusY(ut, ux, uy, un));
+		mz = fmax(mz, spectralRadiusZ(ut, ux, uy, un));
+	}
+	ax[threadIdx.x] = mx;
+	ay[threadIdx.x] = my;
+	az[threadIdx.x] = mz;
+	__syncthreads();
+
+	for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+		if (threadIdx.x < stride) {
+			ax[threadIdx.x] = fmax(ax[threadIdx.x], ax[threadIdx.x + stride]);
+			ay[threadIdx.x] = fmax(ay[threadIdx.x], ay[threadIdx.x + stride]);
+			az[threadIdx.x] = fmax(az[threadIdx.x], az[threadIdx.x + stride]);
+		}
+		__syncthreads();
+	}
+	if (threadIdx.x == 0) {
+		blockMaxima[3 * blockIdx.x] = ax[0];
+		blockMaxima[3 * blockIdx.x + 1] = ay[0];
+		blockMaxima[3 * blockIdx.x + 2] = az[0];
+	}
+}
+
+void maximumSpectralRadii(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const radii) {
+	const size_t bytes = 3 * SPECTRAL_RADIUS_BLOCKS * sizeof(PRECISION);
+	if (d_blockMaxima == NULL) cudaMalloc((void **) &d_blockMaxima, bytes);
+
+	maximumSpectralRadiiKernel<<<SPECTRAL_RADIUS_BLOCKS, SPECTRAL_RADIUS_THREADS>>>(u, d_blockMaxima);
+
+	// the remaining reduction over the blocks is done on the host
+	PRECISION blockMaxima[3 * SPECTRAL_RADIUS_BLOCKS];
+	cudaMemcpy(blockMaxima, d_blockMaxima, bytes, cudaMemcpyDeviceToHost);
+	radii[0] = radii[1] = radii[2] = 0;
+	for (int n = 0; n < SPECTRAL_RADIUS_BLOCKS; ++n) {
+		for (int d = 0; d < 3; ++d) radii[d] = fmax(radii[d], blockMaxima[3 * n + d]);
+	}
+}
+
+void maximumSpectralRadiiHost(const FLUID_VELOCITY * const __restrict__ u, PRECISION * const radii) {
+	PRECISION mx = 0, my = 0, mz = 0;
+#pragma omp parallel for collapse(2) reduction(max:mx,my,mz)
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				PRECISION ut = u->ut[s];
+				PRECISION ux = u->ux[s];
+				PRECISION uy = u->uy[s];
+				PRECISION un = u->un[s];
+				mx = fmax(mx, spectralRadiusX(ut, ux, uy, un));
+				my = fmax(my, spectralRadiusY(ut, ux, uy, un));
+				mz = fmax(mz, spectralRadiusZ(ut, ux, uy, un));
+			}
+		}
+	}
+	radii[0] = mx;
+	radii[1] = my;
+	radii[2] = mz;
+}
+
+void freeSpectralRadiusMemory() {
+	if (d_blockMaxima != NULL) cudaFree(d_blockMaxima);
+	d_blockMaxima = NULL;
+}
+
+double courantTimeStep(const PRECISION * const radii, double t, void * latticeParams) {
+	struct LatticeParameters * lattice = (struct LatticeParameters *) latticeParams;
+	const double spacing[3] = { lattice->latticeSpacingX, lattice->latticeSpacingY, lattice->latticeSpacingRapidity };
+
+	double dt = t;
+	for (int d = 0; d < 3; ++d) {
+		if (radii[d] > 0) dt = fmin(dt, spacing[d] / radii[d]);
+	}
+	dt *= lattice->cflNumber;
+	dt = fmax(dt, lattice->minLatticeSpacingProperTime);
+	dt = fmin(dt, lattice->maxLatticeSpacingProperTime);
+	return dt;
+}
@@ -24,7 +24,7 @@
 #define SIGMA_4 0.022
 
 // TODO: Eliminate branching.
-__device__ PRECISION bulkViscosityToEntropyDensity(PRECISION T) {
+__host__ __device__ PRECISION bulkViscosityToEntropyDensity(PRECISION T) {
 	PRECISION x = T / 1.01355;
 	if (x > 1.05)
 		return LAMBDA_1 * exp(-(x - 1) / SIGMA_1) + LAMBDA_2 * exp(-(x - 1) / SIGMA_2) + 0.001;
@@ -0,0 +1,35 @@
+/*
+ * EquationOfStateTableTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/eos/EquationOfStateTable.cuh"
+
+TEST(EquationOfStateTable, MatchesParametrization) {
+	initializeEquationOfStateTable(true);
+	for (int f = 0; f < NUMBER_EOS_TABLE_FUNCTIONS; ++f) {
+		double e;
+		EXPECT_LT(equationOfStateTableError(f, &e), 1.e-4) << eosTableFunctionNames[f] << " at e = " << e;
+	}
+}
+
+TEST(EquationOfStateTable, ExactAtNodes) {
+	initializeEquationOfStateTable(true);
+	for (int i = 0; i < EOS_TABLE_SIZE; i += EOS_TABLE_SIZE / 8) {
+		PRECISION e = (PRECISION) (EOS_TABLE_MIN_ENERGY_DENSITY
+				* pow(EOS_TABLE_MAX_ENERGY_DENSITY / EOS_TABLE_MIN_ENERGY_DENSITY, i / (double) (EOS_TABLE_SIZE - 1)));
+		PRECISION cs2 = speedOfSoundSquaredParametrized(e);
+		EXPECT_NEAR(interpolateEquationOfState(EOS_TABLE_SPEED_OF_SOUND_SQUARED, e), cs2, 1.e-5 * cs2);
+	}
+}
+
+TEST(EquationOfStateTable, FallsBackOutsideTable) {
+	initializeEquationOfStateTable(true);
+	PRECISION e = (PRECISION) (EOS_TABLE_MIN_ENERGY_DENSITY / 10);
+	EXPECT_EQ(interpolateEquationOfState(EOS_TABLE_TEMPERATURE, e), effectiveTemperatureParametrized(e));
+	EXPECT_EQ(interpolateEquationOfState(EOS_TABLE_PRESSURE, (PRECISION) 0), equilibriumPressureParametrized(0));
+}
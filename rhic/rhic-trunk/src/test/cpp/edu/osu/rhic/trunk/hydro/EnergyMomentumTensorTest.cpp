@@ -0,0 +1,69 @@
+/*
+ * EnergyMomentumTensorTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/hydro/EnergyMomentumTensor.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+
+// The default build has CONFORMAL_EOS, which solves for e in closed form; the solver is checked with the QCD EoS
+
+// Solves for the energy density of an ideal fluid cell moving with ux, from T^{\tau\tau} and T^{\tau x}
+static int recoverEnergyDensity(PRECISION e, PRECISION ux, PRECISION ePrev, PRECISION *eOut) {
+	PRECISION p = equilibriumPressureParametrized(e);
+	PRECISION ut = sqrt(1 + ux * ux);
+	PRECISION M0 = Ttt(e, p, ut, 0);
+	PRECISION M1 = Ttx(e, p, ut, ux, 0);
+	int status;
+	*eOut = solveEnergyDensity<PARAMETRIZED_EOS>(ePrev, M0, M1 * M1, 0, &status);
+	return status;
+}
+
+TEST(EnergyMomentumTensor, RecoversFluidWithinIterationCap) {
+	const PRECISION energyDensities[] = { 0.01, 1, 100 };
+	const PRECISION velocities[] = { 0, 0.5, 5 };
+	// previous energy densities far from the solution, including none at all
+	const PRECISION guesses[] = { 0, 1.e6, NAN };
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			for (int k = 0; k < 3; ++k) {
+				PRECISION e;
+				int status = recoverEnergyDensity(energyDensities[i], velocities[j], guesses[k], &e);
+				EXPECT_FALSE(status & INFERRED_VARIABLES_NOT_CONVERGED) << "e = " << energyDensities[i] << ", ux = " << velocities[j];
+				EXPECT_GE(INFERRED_VARIABLES_ITERATIONS(status), 1);
+				EXPECT_LT(INFERRED_VARIABLES_ITERATIONS(status), INFERRED_VARIABLES_MAX_ITERATIONS);
+				EXPECT_NEAR(e, energyDensities[i], 2.e-3 * energyDensities[i]);
+			}
+		}
+	}
+}
+
+TEST(EnergyMomentumTensor, BisectsWhenNewtonLeavesBracket) {
+	// from a previous energy density 15 times too large, the first Newton step of a fast cell lands at 0.67, below
+	// the bracket 0.85 = M0 - M/M0 <= e <= M0
+	PRECISION e;
+	int status = recoverEnergyDensity(1, 5, 15, &e);
+	EXPECT_TRUE(status & INFERRED_VARIABLES_BISECTED);
+	EXPECT_FALSE(status & INFERRED_VARIABLES_NOT_CONVERGED);
+	EXPECT_LT(INFERRED_VARIABLES_ITERATIONS(status), INFERRED_VARIABLES_MAX_ITERATIONS);
+	EXPECT_NEAR(e, 1, 2.e-3);
+	// Newton's method alone from the solution of the previous step
+	status = recoverEnergyDensity(1, 5, 1, &e);
+	EXPECT_FALSE(status & INFERRED_VARIABLES_BISECTED);
+	EXPECT_LE(INFERRED_VARIABLES_ITERATIONS(status), 2);
+}
+
+TEST(EnergyMomentumTensor, StopsAtIterationCap) {
+	// |M| > M0^2 has no root with e > 0: the bracket closes in on e = 0, which the relative tolerance never accepts
+	int status;
+	PRECISION e = solveEnergyDensity<PARAMETRIZED_EOS>(0.5, 1, 1.5, 0, &status);
+	EXPECT_TRUE(status & INFERRED_VARIABLES_NOT_CONVERGED);
+	EXPECT_TRUE(status & INFERRED_VARIABLES_BISECTED);
+	EXPECT_EQ(INFERRED_VARIABLES_ITERATIONS(status), INFERRED_VARIABLES_MAX_ITERATIONS);
+	EXPECT_GE(e, 0);
+	EXPECT_LT(e, 1.e-3);
+}
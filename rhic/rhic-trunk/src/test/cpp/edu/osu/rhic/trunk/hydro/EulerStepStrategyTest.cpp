@@ -0,0 +1,143 @@
+/*
+ * EulerStepStrategyTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+#include <string.h>
+
+#include "edu/osu/rhic/trunk/hydro/EulerStepStrategy.cuh"
+#include "edu/osu/rhic/trunk/hydro/EulerStep.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+TEST(EulerStepStrategy, SpecializedForLatticeDimensions) {
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = 201;
+	lattice.numLatticePointsY = 1;
+	lattice.numLatticePointsRapidity = 1;
+	EXPECT_EQ(LATTICE_1D, getLatticeDimensions(&lattice));
+	lattice.numLatticePointsY = 80;
+	EXPECT_EQ(LATTICE_2D, getLatticeDimensions(&lattice));
+	lattice.numLatticePointsRapidity = 13;
+	EXPECT_EQ(LATTICE_3D, getLatticeDimensions(&lattice));
+	// a single transverse row with rapidity points is evolved as 3D
+	lattice.numLatticePointsY = 1;
+	EXPECT_EQ(LATTICE_3D, getLatticeDimensions(&lattice));
+
+	int dimensions = latticeDimensions;
+	latticeDimensions = LATTICE_2D;
+	EXPECT_TRUE(getEulerStepStrategy<SHEAR_HYDRO>(EULER_STEP_FUSED)->host == (&eulerStepFusedHost<SHEAR_HYDRO, LATTICE_2D>));
+	latticeDimensions = LATTICE_3D;
+	EXPECT_TRUE(getEulerStepStrategy<SHEAR_HYDRO>(EULER_STEP_FUSED)->host == (&eulerStepFusedHost<SHEAR_HYDRO, LATTICE_3D>));
+	latticeDimensions = dimensions;
+}
+
+// A smooth field of the cell (i, j), the same in every rapidity plane, that varies in y only with dependsOnY
+static PRECISION field(int n, int i, int j, bool dependsOnY) {
+	return (PRECISION) (sin(0.7 * i + 1.3 * n) + (dependsOnY ? cos(0.9 * j + 0.4 * n) : 0));
+}
+
+static void getConservedVariableArrays(const CONSERVED_VARIABLES *c, PRECISION **arrays) {
+	PRECISION *components[] = {c->ttt, c->ttx, c->tty, c->ttn, c->pitt, c->pitx, c->pity, c->pitn, c->pixx, c->pixy,
+			c->pixn, c->piyy, c->piyn, c->pinn, c->Pi};
+	memcpy(arrays, components, sizeof(components));
+}
+
+/*
+ * One Euler step of every strategy on an nx x ny x 1 lattice, ghost cells included, whose fields are the same
+ * in every rapidity plane (and in every y row unless dependsOnY), once specialized for the lattice dimensions
+ * and once treating the lattice as 3D. The derivatives and fluxes left out by the specialization vanish, so
+ * the updated conserved variables must be the same.
+ */
+static void expectSameEulerStepAs3D(int nx, int ny, bool dependsOnY) {
+	int savedPhysicsMode = physicsMode;
+	int savedDimensions = latticeDimensions;
+	physicsMode = SHEAR_BULK_HYDRO;
+
+	struct LatticeParameters lattice;
+	lattice.numLatticePointsX = nx;
+	lattice.numLatticePointsY = ny;
+	lattice.numLatticePointsRapidity = 1;
+	int dimensions = getLatticeDimensions(&lattice);
+
+	h_nx = nx; h_ny = ny; h_nz = 1;
+	h_ncx = nx + N_GHOST_CELLS; h_ncy = ny + N_GHOST_CELLS; h_ncz = 1 + N_GHOST_CELLS;
+	h_nElements = h_nx * h_ny * h_nz;
+	h_nCompElements = h_ncx * h_ncy * h_ncz;
+	h_dx = h_dy = h_dz = (PRECISION) 0.1;
+	h_dt = h_dtp = (PRECISION) 0.01;
+	h_etabar = (PRECISION) 0.2;
+	int len = h_nCompElements;
+
+	CONSERVED_VARIABLES *current = allocateIntermidateConservedVarHostMemory(len);
+	CONSERVED_VARIABLES *updated = allocateIntermidateConservedVarHostMemory(len);
+	CONSERVED_VARIABLES *updated3D = allocateIntermidateConservedVarHostMemory(len);
+	FLUID_VELOCITY *velocity = allocateIntermidateFluidVelocityHostMemory(len);
+	FLUID_VELOCITY *previousVelocity = allocateIntermidateFluidVelocityHostMemory(len);
+	PRECISION *energyDensity = (PRECISION *) calloc(len, sizeof(PRECISION));
+	PRECISION *pressure = (PRECISION *) calloc(len, sizeof(PRECISION));
+
+	PRECISION t = (PRECISION) 0.6;
+	PRECISION *currentArrays[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)];
+	PRECISION *updatedArrays[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)];
+	PRECISION *updated3DArrays[NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO)];
+	getConservedVariableArrays(current, currentArrays);
+	getConservedVariableArrays(updated, updatedArrays);
+	getConservedVariableArrays(updated3D, updated3DArrays);
+	for (int k = 0; k < h_ncz; ++k) {
+		for (int j = 0; j < h_ncy; ++j) {
+			for (int i = 0; i < h_ncx; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				energyDensity[s] = 10 + field(0, i, j, dependsOnY);
+				pressure[s] = energyDensity[s] / 3;
+				FLUID_VELOCITY *velocities[] = {velocity, previousVelocity};
+				for (int v = 0; v < 2; ++v) {
+					velocities[v]->ux[s] = (PRECISION) 0.2 * field(1 + v, i, j, dependsOnY);
+					velocities[v]->uy[s] = (PRECISION) 0.2 * field(3 + v, i, j, dependsOnY);
+					velocities[v]->un[s] = (PRECISION) 0.1 * field(5 + v, i, j, dependsOnY);
+					velocities[v]->ut[s] = sqrt(1 + velocities[v]->ux[s] * velocities[v]->ux[s]
+							+ velocities[v]->uy[s] * velocities[v]->uy[s] + t * t * velocities[v]->un[s] * velocities[v]->un[s]);
+				}
+				for (int n = 0; n < NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO); ++n)
+					currentArrays[n][s] = (n == 0 ? 15 : (n < 4 ? 1 : (PRECISION) 0.1)) * field(7 + n, i, j, dependsOnY) + (n == 0 ? 20 : 0);
+			}
+		}
+	}
+
+	for (int strategy = 0; strategy < NUMBER_EULER_STEP_STRATEGIES; ++strategy) {
+		latticeDimensions = dimensions;
+		getEulerStepStrategy<SHEAR_BULK_HYDRO>(strategy)->host(t, current, updated, energyDensity, pressure, velocity, previousVelocity);
+		latticeDimensions = LATTICE_3D;
+		getEulerStepStrategy<SHEAR_BULK_HYDRO>(strategy)->host(t, current, updated3D, energyDensity, pressure, velocity, previousVelocity);
+		for (int n = 0; n < NUMBER_CONSERVED_VARIABLES(SHEAR_BULK_HYDRO); ++n) {
+			for (int j = N_GHOST_CELLS_M; j < ny + N_GHOST_CELLS_M; ++j) {
+				for (int i = N_GHOST_CELLS_M; i < nx + N_GHOST_CELLS_M; ++i) {
+					int s = columnMajorLinearIndex(i, j, N_GHOST_CELLS_M, h_ncx, h_ncy);
+					EXPECT_EQ(updated3DArrays[n][s], updatedArrays[n][s]) << getEulerStepStrategyName(strategy)
+							<< ", " << getLatticeDimensionsName(dimensions) << ", variable " << n << ", cell (" << i << ", " << j << ")";
+				}
+			}
+		}
+	}
+
+	freeIntermidateConservedVarHostMemory(current);
+	freeIntermidateConservedVarHostMemory(updated);
+	freeIntermidateConservedVarHostMemory(updated3D);
+	freeIntermidateFluidVelocityHostMemory(velocity);
+	freeIntermidateFluidVelocityHostMemory(previousVelocity);
+	free(energyDensity);
+	free(pressure);
+	physicsMode = savedPhysicsMode;
+	latticeDimensions = savedDimensions;
+}
+
+TEST(EulerStepStrategy, BoostInvariantStepMatches3D) {
+	expectSameEulerStepAs3D(7, 6, true);
+}
+
+TEST(EulerStepStrategy, UniformInYStepMatches3D) {
+	expectSameEulerStepAs3D(9, 1, false);
+}
@@ -0,0 +1,93 @@
+/*
+ * ObservablesTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/hydro/Observables.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+TEST(Observables, ReductionsOfEachEventSkipGhostCells) {
+	// two events of 3 x 2 x 1 cells packed side by side
+	int ncx = h_ncx, ncy = h_ncy, ncz = h_ncz, ensembleSize = h_ensembleSize;
+	h_ncx = 2 * (3 + N_GHOST_CELLS);
+	h_ncy = 2 + N_GHOST_CELLS;
+	h_ncz = 1 + N_GHOST_CELLS;
+	h_ensembleSize = 2;
+	int len = h_ncx * h_ncy * h_ncz;
+
+	CONSERVED_VARIABLES q;
+	FLUID_VELOCITY u;
+	PRECISION *e = (PRECISION *) calloc(len, sizeof(PRECISION));
+	PRECISION *p = (PRECISION *) calloc(len, sizeof(PRECISION));
+	q.ttt = (PRECISION *) calloc(len, sizeof(PRECISION));
+	u.ut = (PRECISION *) calloc(len, sizeof(PRECISION));
+	u.ux = (PRECISION *) calloc(len, sizeof(PRECISION));
+	u.uy = (PRECISION *) calloc(len, sizeof(PRECISION));
+	u.un = (PRECISION *) calloc(len, sizeof(PRECISION));
+	// the ghost cells hold a larger energy density than any physical cell
+	for (int s = 0; s < len; ++s) {
+		e[s] = 1000;
+		p[s] = 1000;
+		u.ut[s] = 1;
+	}
+	double T0 = 0, T1 = 0;
+	for (int m = 0; m < 2; ++m) {
+		for (int j = 0; j < 2; ++j) {
+			for (int i = 0; i < 3; ++i) {
+				int s = columnMajorLinearIndex(i + N_GHOST_CELLS_M + m * (3 + N_GHOST_CELLS), j + N_GHOST_CELLS_M, N_GHOST_CELLS_M, h_ncx, h_ncy);
+				e[s] = (m + 1) * (1 + i + 3 * j);
+				p[s] = e[s] / 3;
+				q.ttt[s] = 2 * e[s];
+				u.ut[s] = 2;
+				u.ux[s] = i;
+				if (m == 0) T0 += effectiveTemperature(e[s]);
+				else T1 += effectiveTemperature(e[s]);
+			}
+		}
+	}
+	int cells[3] = { columnMajorLinearIndex(1 + N_GHOST_CELLS_M + (3 + N_GHOST_CELLS), N_GHOST_CELLS_M, N_GHOST_CELLS_M, h_ncx, h_ncy), -1, 0 };
+	setProbeCells(cells, 3, true);
+
+	struct FluidReductions r[2];
+	double values[3 * PROBE_FIELDS];
+	computeObservablesHost(&q, e, p, &u, r, values);
+	EXPECT_EQ(6, r[0].eMax);
+	EXPECT_EQ(1, r[0].eMin);
+	EXPECT_EQ(21, r[0].eSum);
+	EXPECT_NEAR(T0, r[0].TSum, 1.e-6 * T0);
+	EXPECT_EQ(42, r[0].tttSum);
+	EXPECT_EQ(12, r[1].eMax);
+	EXPECT_EQ(2, r[1].eMin);
+	EXPECT_EQ(42, r[1].eSum);
+	EXPECT_NEAR(T1, r[1].TSum, 1.e-6 * T1);
+	// s u^tau = 2 (4/3) e / T
+	double entropy = 0;
+	for (int n = 1; n <= 6; ++n) entropy += 2 * (4./3) * 2 * n / effectiveTemperature((PRECISION) (2 * n));
+	EXPECT_NEAR(entropy, r[1].entropySum, 1.e-5 * entropy);
+	// the second cell of the second event, a cell of another process and a ghost cell
+	EXPECT_EQ(4, values[0]);
+	EXPECT_FLOAT_EQ(4./3, values[1]);
+	EXPECT_EQ(1, values[2]);
+	for (int f = 0; f < PROBE_FIELDS; ++f) EXPECT_EQ(0, values[PROBE_FIELDS + f]);
+	EXPECT_EQ(1000, values[2 * PROBE_FIELDS]);
+
+	freeObservablesMemory();
+	free(e);
+	free(p);
+	free(q.ttt);
+	free(u.ut);
+	free(u.ux);
+	free(u.uy);
+	free(u.un);
+	h_ncx = ncx;
+	h_ncy = ncy;
+	h_ncz = ncz;
+	h_ensembleSize = ensembleSize;
+}
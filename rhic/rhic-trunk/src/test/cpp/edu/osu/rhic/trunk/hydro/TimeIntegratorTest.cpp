@@ -0,0 +1,129 @@
+/*
+ * TimeIntegratorTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+#include <string.h>
+
+#include "edu/osu/rhic/trunk/hydro/TimeIntegrator.cuh"
+#include "edu/osu/rhic/trunk/hydro/FullyDiscreteKurganovTadmorScheme.cuh"
+#include "edu/osu/rhic/trunk/hydro/GhostCells.cuh"
+#include "edu/osu/rhic/trunk/eos/EquationOfState.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/hydro/HydroParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+TEST(TimeIntegrator, FindByName) {
+	EXPECT_EQ(TIME_INTEGRATOR_RK2, findTimeIntegrator("rk2"));
+	EXPECT_EQ(TIME_INTEGRATOR_SSP_RK3, findTimeIntegrator("ssp_rk3"));
+	EXPECT_EQ(-1, findTimeIntegrator("rk4"));
+
+	EXPECT_EQ(2, getTimeIntegrator<IDEAL_HYDRO>(TIME_INTEGRATOR_RK2)->eulerSteps);
+	EXPECT_EQ(3, getTimeIntegrator<IDEAL_HYDRO>(TIME_INTEGRATOR_SSP_RK3)->eulerSteps);
+	EXPECT_TRUE(getTimeIntegrator<SHEAR_HYDRO>(TIME_INTEGRATOR_SSP_RK3)->host == &threeStepRungeKuttaHost<SHEAR_HYDRO>);
+}
+
+TEST(TimeIntegrator, ConvexCombinationSkipsGhostCells) {
+	h_ncx = 3 + N_GHOST_CELLS;
+	h_ncy = 2 + N_GHOST_CELLS;
+	h_ncz = 1 + N_GHOST_CELLS;
+	int len = h_ncx * h_ncy * h_ncz;
+
+	CONSERVED_VARIABLES q, Q;
+	PRECISION *components[8];
+	for (int n = 0; n < 8; ++n) components[n] = (PRECISION *) calloc(len, sizeof(PRECISION));
+	q.ttt = components[0]; q.ttx = components[1]; q.tty = components[2]; q.ttn = components[3];
+	Q.ttt = components[4]; Q.ttx = components[5]; Q.tty = components[6]; Q.ttn = components[7];
+	for (int s = 0; s < len; ++s) {
+		q.ttt[s] = 3;
+		q.ttx[s] = -1;
+		Q.ttt[s] = 6;
+		Q.ttx[s] = 2;
+	}
+
+	// second stage of SSP-RK3, in place
+	convexCombinationHost<IDEAL_HYDRO>(0.75, &q, &Q, &Q);
+	for (int k = 0; k < h_ncz; ++k) {
+		for (int j = 0; j < h_ncy; ++j) {
+			for (int i = 0; i < h_ncx; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				bool interior = i >= N_GHOST_CELLS_M && i < h_ncx-2 && j >= N_GHOST_CELLS_M && j < h_ncy-2
+						&& k >= N_GHOST_CELLS_M && k < h_ncz-2;
+				EXPECT_FLOAT_EQ(interior ? 3.75 : 6, Q.ttt[s]);
+				EXPECT_FLOAT_EQ(interior ? -0.25 : 2, Q.ttx[s]);
+			}
+		}
+	}
+	for (int n = 0; n < 8; ++n) free(components[n]);
+}
+
+/*
+ * Evolves a homogeneous ideal fluid at rest, i.e. Bjorken flow, on a small 3D lattice with the host
+ * backend and returns the energy density of the center cell at t0 + steps * dt.
+ */
+static PRECISION evolveBjorkenFlowHost(int integrator, PRECISION e0, double t0, double dt, int steps) {
+	const int n = 3;
+	struct LatticeParameters lattice;
+	memset(&lattice, 0, sizeof(lattice));
+	lattice.numLatticePointsX = n;
+	lattice.numLatticePointsY = n;
+	lattice.numLatticePointsRapidity = n;
+	lattice.numComputationalLatticePointsX = n + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsY = n + N_GHOST_CELLS;
+	lattice.numComputationalLatticePointsRapidity = n + N_GHOST_CELLS;
+	lattice.latticeSpacingX = 0.1;
+	lattice.latticeSpacingY = 0.1;
+	lattice.latticeSpacingRapidity = 0.1;
+	lattice.latticeSpacingProperTime = dt;
+	lattice.ensembleSize = 1;
+	struct HydroParameters hydro;
+	memset(&hydro, 0, sizeof(hydro));
+	hydro.initialProperTimePoint = t0;
+	hydro.physicsMode = IDEAL_HYDRO;
+
+	initializeHostConstantParameters(&lattice, NULL, &hydro);
+	int len = h_nCompElements;
+	allocateHostMemory(len);
+	for (int s = 0; s < len; ++s) {
+		e[s] = e0;
+		p[s] = equilibriumPressure(e0);
+		u->ut[s] = 1;
+	}
+	setConservedVariables(t0, &lattice);
+	setGhostCellsHost<IDEAL_HYDRO>(q, e, p, u);
+	allocateIntermediateHostMemory(len);
+
+	const TIME_INTEGRATOR *timeIntegrator = getTimeIntegrator<IDEAL_HYDRO>(integrator);
+	double t = t0;
+	for (int step = 0; step < steps; ++step) {
+		timeIntegrator->host(t, dt, q, h_Q);
+		setCurrentConservedVariablesHost();
+		t += dt;
+	}
+	PRECISION center = e[columnMajorLinearIndex(n/2 + N_GHOST_CELLS_M, n/2 + N_GHOST_CELLS_M, n/2 + N_GHOST_CELLS_M, h_ncx, h_ncy)];
+
+	freeIntermediateHostMemory();
+	freeHostMemory();
+	return center;
+}
+
+TEST(TimeIntegrator, HostBackendFollowsBjorkenFlow) {
+	int savedPhysicsMode = physicsMode;
+	int savedDimensions = latticeDimensions;
+	physicsMode = IDEAL_HYDRO;
+	latticeDimensions = LATTICE_3D;
+
+	const PRECISION e0 = 30;
+	const double t0 = 0.5, dt = 0.005;
+	const int steps = 100;
+	// ideal conformal fluid: e = e0 (t0/t)^(4/3), up to the time discretization error (about 1e-5 for rk2)
+	double exact = e0 * pow(t0 / (t0 + steps * dt), 4./3);
+	EXPECT_NEAR(exact, evolveBjorkenFlowHost(TIME_INTEGRATOR_RK2, e0, t0, dt, steps), 2e-5 * exact);
+	EXPECT_NEAR(exact, evolveBjorkenFlowHost(TIME_INTEGRATOR_SSP_RK3, e0, t0, dt, steps), 2e-5 * exact);
+
+	physicsMode = savedPhysicsMode;
+	latticeDimensions = savedDimensions;
+}
@@ -0,0 +1,83 @@
+/*
+ * TimeStepTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/hydro/TimeStep.cuh"
+#include "edu/osu/rhic/harness/lattice/LatticeParameters.h"
+#include "edu/osu/rhic/harness/init/CudaConfiguration.cuh"
+
+static void setLattice(struct LatticeParameters *lattice) {
+	lattice->numLatticePointsX = 4;
+	lattice->numLatticePointsY = 3;
+	lattice->numLatticePointsRapidity = 2;
+	lattice->numComputationalLatticePointsX = 4 + N_GHOST_CELLS;
+	lattice->numComputationalLatticePointsY = 3 + N_GHOST_CELLS;
+	lattice->numComputationalLatticePointsRapidity = 2 + N_GHOST_CELLS;
+	lattice->latticeSpacingX = 0.1;
+	lattice->latticeSpacingY = 0.2;
+	lattice->latticeSpacingRapidity = 0.5;
+	lattice->latticeSpacingProperTime = 0.01;
+	lattice->adaptiveTimeStep = 1;
+	lattice->cflNumber = 0.25;
+	lattice->minLatticeSpacingProperTime = 0.001;
+	lattice->maxLatticeSpacingProperTime = 0.05;
+}
+
+TEST(TimeStep, CourantCondition) {
+	struct LatticeParameters lattice;
+	setLattice(&lattice);
+	// limited by the x direction
+	PRECISION radii[3] = { 0.5, 0.5, 0.1 };
+	EXPECT_NEAR(0.25 * 0.1 / 0.5, courantTimeStep(radii, 1, &lattice), 1.e-7);
+	// a fluid at rest is limited by the expansion time
+	PRECISION rest[3] = { 0, 0, 0 };
+	EXPECT_NEAR(0.25 * 0.1, courantTimeStep(rest, 0.1, &lattice), 1.e-9);
+	// bounds
+	EXPECT_EQ(0.05, courantTimeStep(rest, 1, &lattice));
+	PRECISION fast[3] = { 100, 0, 0 };
+	EXPECT_EQ(0.001, courantTimeStep(fast, 1, &lattice));
+}
+
+TEST(TimeStep, MaximumSpectralRadiiSkipsGhostCells) {
+	struct LatticeParameters lattice;
+	setLattice(&lattice);
+	h_ncx = lattice.numComputationalLatticePointsX;
+	h_ncy = lattice.numComputationalLatticePointsY;
+	h_ncz = lattice.numComputationalLatticePointsRapidity;
+	int len = h_ncx * h_ncy * h_ncz;
+
+	FLUID_VELOCITY velocity;
+	PRECISION *components[4];
+	for (int n = 0; n < 4; ++n) components[n] = (PRECISION *) calloc(len, sizeof(PRECISION));
+	velocity.ut = components[0];
+	velocity.ux = components[1];
+	velocity.uy = components[2];
+	velocity.un = components[3];
+	for (int s = 0; s < len; ++s) {
+		velocity.ut[s] = 2;
+		// ghost cells are faster than any physical cell
+		velocity.ux[s] = 1.9;
+	}
+	for (int k = N_GHOST_CELLS_M; k < h_ncz-2; ++k) {
+		for (int j = N_GHOST_CELLS_M; j < h_ncy-2; ++j) {
+			for (int i = N_GHOST_CELLS_M; i < h_ncx-2; ++i) {
+				int s = columnMajorLinearIndex(i, j, k, h_ncx, h_ncy);
+				velocity.ux[s] = 0.1 * (i - N_GHOST_CELLS_M);
+				velocity.uy[s] = -0.2 * (j - N_GHOST_CELLS_M);
+				velocity.un[s] = 0.5 * (k - N_GHOST_CELLS_M);
+			}
+		}
+	}
+
+	PRECISION radii[3];
+	maximumSpectralRadiiHost(&velocity, radii);
+	EXPECT_FLOAT_EQ(0.3 / 2, radii[0]);
+	EXPECT_FLOAT_EQ(0.4 / 2, radii[1]);
+	EXPECT_FLOAT_EQ(0.5 / 2, radii[2]);
+	for (int n = 0; n < 4; ++n) free(components[n]);
+}
@@ -0,0 +1,46 @@
+/*
+ * AnalyticSolutionsTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+#include "edu/osu/rhic/trunk/ic/AnalyticSolutions.h"
+#include "edu/osu/rhic/trunk/ic/InitialConditions.h"
+
+TEST(AnalyticSolutions, GubserFlowStartsFromItsInitialCondition) {
+	double e0 = 13.8997;
+	double x = 0.7, y = -1.3;
+	// as in setIdealGubserInitialCondition
+	double T = 1.9048812623618392/pow(1 + pow(1 - pow(x,2) - pow(y,2),2) + 2*(1 + pow(x,2) + pow(y,2)),0.3333333333333333);
+	EXPECT_NEAR(e0 * pow(T,4), idealGubserEnergyDensity(e0, 1, x, y), 1.e-12);
+	// the center cools as (t (1 + t^2)^2)^(-4/3), boost invariantly at early times
+	double t = 2;
+	EXPECT_NEAR(pow(4 / (t * pow(1 + t*t, 2)), 4/3.), idealGubserEnergyDensity(e0, t, 0, 0) / idealGubserEnergyDensity(e0, 1, 0, 0), 1.e-12);
+	EXPECT_NEAR(idealGubserEnergyDensity(e0, t, x, y), idealGubserEnergyDensity(e0, t, -y, x), 1.e-12);
+}
+
+TEST(AnalyticSolutions, RiemannProblemConservesEnergy) {
+	double eL = SOD_SHOCK_TUBE_LEFT_ENERGY_DENSITY, eR = SOD_SHOCK_TUBE_RIGHT_ENERGY_DENSITY;
+	double t = 2;
+	EXPECT_EQ(eL, riemannProblemEnergyDensity(eL, eR, 0, 0));
+	EXPECT_EQ(eR, riemannProblemEnergyDensity(eL, eR, 0, 1.e-3));
+	EXPECT_EQ(eL, riemannProblemEnergyDensity(eL, eR, t, -0.6 * t));
+	EXPECT_EQ(eR, riemannProblemEnergyDensity(eL, eR, t, 0.99 * t));
+
+	// T^{tt} = (e + p) u^t u^t - p summed over [-L, L], with the fluid velocity of the rarefaction wave and of the
+	// plateau behind the shock from the Riemann invariant, is that of the initial state
+	double L = 3, dx = 1.e-4;
+	double sum = 0;
+	bool shocked = false;
+	for (double x = -L + dx/2; x < L; x += dx) {
+		double e = riemannProblemEnergyDensity(eL, eR, t, x);
+		double v = e == eR ? 0 : tanh(-sqrt(3.) / 4 * log(e / eL));
+		shocked = shocked || e == eR;
+		sum += (4 * e / 3) / (1 - v * v) - e / 3;
+	}
+	EXPECT_TRUE(shocked);
+	EXPECT_NEAR(L * (eL + eR), sum * dx, 1.e-4 * L * eL);
+}